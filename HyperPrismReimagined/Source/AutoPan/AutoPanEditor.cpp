@@ -5,6 +5,8 @@
 
 #include "AutoPanEditor.h"
 
+namespace HyperPrismAutoPanUI
+{
 //==============================================================================
 // XYPad Implementation (matching Compressor style)
 //==============================================================================
@@ -158,6 +160,7 @@ void PanPositionMeter::paint(juce::Graphics& g)
 
 void PanPositionMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("PanPositionMeter::timerCallback");
     float newPanPosition = processor.getPanPosition();
     lfoPhase = processor.getLFOPhase();
     
@@ -208,9 +211,10 @@ float PanPositionMeter::getWaveformValue(float phase, int waveformType)
 // AutoPanEditor Implementation
 //==============================================================================
 AutoPanEditor::AutoPanEditor(AutoPanProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), panPositionMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), panPositionMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(AutoPanProcessor::RATE_ID);
@@ -348,6 +352,7 @@ AutoPanEditor::~AutoPanEditor()
 
 void AutoPanEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("AutoPanEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -394,7 +399,7 @@ void AutoPanEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -681,4 +686,6 @@ void AutoPanEditor::updateXYPadLabel()
 void AutoPanEditor::assignParameterToXYPad(const juce::String& parameterID, bool assignToX)
 {
     // This method is no longer used - replaced by toggle functionality in showParameterMenu
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismAutoPanUI
\ No newline at end of file
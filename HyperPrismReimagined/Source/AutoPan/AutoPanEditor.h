@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "AutoPanProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismAutoPanUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -159,5 +162,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoPanEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismAutoPanUI
+
+using HyperPrismAutoPanUI::AutoPanEditor;
\ No newline at end of file
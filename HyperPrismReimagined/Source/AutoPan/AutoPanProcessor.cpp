@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "AutoPanProcessor.h"
-#include "AutoPanEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "AutoPanEditor.h"
+#endif
 
 //==============================================================================
 // LFO Implementation
@@ -169,6 +171,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout AutoPanProcessor::createPara
 //==============================================================================
 void AutoPanProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     juce::ignoreUnused(samplesPerBlock);
     
     // Prepare LFO
@@ -205,6 +208,8 @@ bool AutoPanProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 
 void AutoPanProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
 {
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("AutoPan::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -221,6 +226,7 @@ void AutoPanProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
 
 void AutoPanProcessor::processAutoPan(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("AutoPan::processAutoPan");
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
     
@@ -243,6 +249,7 @@ void AutoPanProcessor::processAutoPan(juce::AudioBuffer<float>& buffer)
     float leftLevelSum = 0.0f;
     float rightLevelSum = 0.0f;
     float lfoSum = 0.0f;
+    float panValue = 0.0f;
     
     for (int sample = 0; sample < numSamples; ++sample)
     {
@@ -254,7 +261,7 @@ void AutoPanProcessor::processAutoPan(juce::AudioBuffer<float>& buffer)
         float phasedLFO = std::sin(std::asin(lfoSample) + phaseRadians);
         
         // Apply depth
-        float panValue = phasedLFO * depth;
+        panValue = phasedLFO * depth;
         
         // Calculate pan gains
         float leftGain, rightGain;
@@ -293,8 +300,8 @@ void AutoPanProcessor::processAutoPan(juce::AudioBuffer<float>& buffer)
     rightLevel.store(rightLevelSum / numSamples);
     lfoValue.store(lfoSum / numSamples);
     
-    // Update pan position (average of last pan value)
-    panPosition.store(lfo.getNextSample() * depth);
+    // Update pan position (last pan value; reading the LFO again would advance it)
+    panPosition.store(panValue);
     
     // Update LFO phase
     lfoPhase.store(lfo.getPhase());
@@ -313,7 +320,11 @@ void AutoPanProcessor::calculatePanGains(float panValue, float& leftGain, float&
 //==============================================================================
 juce::AudioProcessorEditor* AutoPanProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new AutoPanEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -328,4 +339,9 @@ void AutoPanProcessor::setStateInformation(const void* data, int sizeInBytes)
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void AutoPanProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
 }
\ No newline at end of file
@@ -5,6 +5,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/HyperPrismTrace.h"
 
 class LFO
 {
@@ -41,7 +44,7 @@ private:
     void updatePhaseIncrement();
 };
 
-class AutoPanProcessor : public juce::AudioProcessor
+class AutoPanProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -58,7 +61,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Auto Pan"; }
@@ -98,6 +105,12 @@ public:
     float getPanPosition() const { return panPosition.load(); }
     float getLFOPhase() const { return lfoPhase.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -129,5 +142,8 @@ private:
     std::atomic<float> panPosition { 0.0f };
     std::atomic<float> lfoPhase { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoPanProcessor)
 };
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "BandPassProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismBandPassUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -125,5 +128,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BandPassEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismBandPassUI
+
+using HyperPrismBandPassUI::BandPassEditor;
\ No newline at end of file
@@ -3,14 +3,32 @@
 //==============================================================================
 
 #include "BandPassProcessor.h"
-#include "BandPassEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "BandPassEditor.h"
+#endif
+
+namespace
+{
+    using Param = BandPassProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        boolParameter(Param::bypass, "bypass", "Bypass", false),
+        floatParameter(Param::centerFreq, "centerFreq", "Center Frequency", 100.0f, 10000.0f, 1.0f, 0.3f, 1000.0f, 0, " Hz"),
+        floatParameter(Param::bandwidth, "bandwidth", "Bandwidth", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, 1, " %"),
+        floatParameter(Param::gain, "gain", "Gain", -24.0f, 24.0f, 0.1f, 1.0f, 0.0f, 1, " dB"),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 100.0f, 1, " %")
+    }}};
+
+    static_assert(parameterTable.isValid(), "BandPass parameter table out of step with BandPassProcessor::Param");
+}
 
 // Parameter IDs
-const juce::String BandPassProcessor::BYPASS_ID = "bypass";
-const juce::String BandPassProcessor::CENTER_FREQ_ID = "centerFreq";
-const juce::String BandPassProcessor::BANDWIDTH_ID = "bandwidth";
-const juce::String BandPassProcessor::GAIN_ID = "gain";
-const juce::String BandPassProcessor::MIX_ID = "mix";
+const juce::String BandPassProcessor::BYPASS_ID = parameterTable[Param::bypass].id;
+const juce::String BandPassProcessor::CENTER_FREQ_ID = parameterTable[Param::centerFreq].id;
+const juce::String BandPassProcessor::BANDWIDTH_ID = parameterTable[Param::bandwidth].id;
+const juce::String BandPassProcessor::GAIN_ID = parameterTable[Param::gain].id;
+const juce::String BandPassProcessor::MIX_ID = parameterTable[Param::mix].id;
 
 //==============================================================================
 BandPassProcessor::BandPassProcessor()
@@ -24,7 +42,8 @@ BandPassProcessor::BandPassProcessor()
                      #endif
                        ),
 #endif
-    valueTreeState(*this, nullptr, "PARAMETERS", createParameterLayout())
+    valueTreeState(*this, nullptr, "PARAMETERS", HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(valueTreeState, parameterTable)
 {
 }
 
@@ -35,7 +54,7 @@ BandPassProcessor::~BandPassProcessor()
 //==============================================================================
 const juce::String BandPassProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Band-Pass Filter";
 }
 
 bool BandPassProcessor::acceptsMidi() const
@@ -96,6 +115,7 @@ void BandPassProcessor::changeProgramName(int, const juce::String&)
 //==============================================================================
 void BandPassProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     juce::dsp::ProcessSpec spec;
@@ -106,22 +126,16 @@ void BandPassProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     highPassFilter.prepare(spec);
     lowPassFilter.prepare(spec);
     
-    // Initialize smoothed values
-    const float smoothTime = 0.005f; // 5ms smoothing for real-time response
-    centerFreqSmoothed.reset(sampleRate, smoothTime);
-    bandwidthSmoothed.reset(sampleRate, smoothTime);
-    gainSmoothed.reset(sampleRate, smoothTime);
-    mixSmoothed.reset(sampleRate, smoothTime);
-    
-    // Set initial values
-    centerFreqSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(CENTER_FREQ_ID));
-    bandwidthSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(BANDWIDTH_ID));
-    gainSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(GAIN_ID));
-    mixSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(MIX_ID));
-    
     updateFilters();
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.005; // 5ms smoothing for real-time response
+    gainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    gainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(parameterValues.get(Param::gain)));
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void BandPassProcessor::releaseResources()
@@ -151,8 +165,13 @@ bool BandPassProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 }
 #endif
 
-void BandPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void BandPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("BandPass::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -160,18 +179,14 @@ void BandPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    const auto values = parameterValues.snapshot();
+
     // Check bypass
-    if (*valueTreeState.getRawParameterValue(BYPASS_ID) > 0.5f)
+    if (values.isOn(Param::bypass))
         return;
 
-    // Update smoothed parameters
-    centerFreqSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(CENTER_FREQ_ID));
-    bandwidthSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(BANDWIDTH_ID));
-    gainSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(GAIN_ID));
-    mixSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(MIX_ID));
-
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
 
     // Always update filters to ensure real-time parameter changes
     updateFilters();
@@ -184,39 +199,36 @@ void BandPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
     lowPassFilter.process(context);
 
     // Apply gain
-    float currentGain = juce::Decibels::decibelsToGain(valueTreeState.getRawParameterValue(GAIN_ID)->load());
+    const int numSamples = buffer.getNumSamples();
+    gainRamp.setTarget(juce::Decibels::decibelsToGain(values[Param::gain]));
+    mixRamp.setTarget(values[Param::mix] * 0.01f); // Convert percentage to ratio
+    const auto* gains = gainRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
+
     for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= currentGain;
-        }
-    }
+        HyperPrismLargeBlocks::applyGain(buffer.getWritePointer(channel), gains, gainRamp.isConstant(), numSamples);
 
     // Mix dry and wet signals
-    float mixValue = valueTreeState.getRawParameterValue(MIX_ID)->load() * 0.01f; // Convert percentage to ratio
-    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* wetData = buffer.getWritePointer(channel);
-        auto* dryData = dryBuffer.getReadPointer(channel);
-        
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            wetData[sample] = dryData[sample] * (1.0f - mixValue) + wetData[sample] * mixValue;
-        }
-    }
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumOutputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 //==============================================================================
 bool BandPassProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* BandPassProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new BandPassEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -235,11 +247,19 @@ void BandPassProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void BandPassProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", gainRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+}
+
 //==============================================================================
 void BandPassProcessor::updateFilters()
 {
-    float centerFreq = valueTreeState.getRawParameterValue(CENTER_FREQ_ID)->load();
-    float bandwidth = valueTreeState.getRawParameterValue(BANDWIDTH_ID)->load();
+    HYPERPRISM_TRACE_SCOPE("BandPass::updateFilters");
+    float centerFreq = parameterValues.get(Param::centerFreq);
+    float bandwidth = parameterValues.get(Param::bandwidth);
     
     // Calculate cutoff frequencies from center frequency and bandwidth
     // Bandwidth in octaves: bandwidth = log2(f2/f1)
@@ -261,37 +281,3 @@ void BandPassProcessor::updateFilters()
     *highPassFilter.state = *hpCoeffs;
     *lowPassFilter.state = *lpCoeffs;
 }
-
-juce::AudioProcessorValueTreeState::ParameterLayout BandPassProcessor::createParameterLayout()
-{
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID, "Bypass", false));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        CENTER_FREQ_ID, "Center Frequency", 
-        juce::NormalisableRange<float>(100.0f, 10000.0f, 1.0f, 0.3f), 1000.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 0) + " Hz"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        BANDWIDTH_ID, "Bandwidth", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 50.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        GAIN_ID, "Gain", 
-        juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " dB"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID, "Mix", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 100.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    return { parameters.begin(), parameters.end() };
-}
\ No newline at end of file
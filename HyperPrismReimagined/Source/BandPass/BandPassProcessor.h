@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-class BandPassProcessor : public juce::AudioProcessor
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/ParameterTable.h"
+#include "../DSP/ParameterRamp.h"
+
+class BandPassProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -56,9 +62,19 @@ public:
     static const juce::String GAIN_ID;
     static const juce::String MIX_ID;
 
+    // Parameters in layout order, indexing the table in BandPassProcessor.cpp
+    enum class Param { bypass, centerFreq, bandwidth, gain, mix, count };
+
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState valueTreeState;
+    HyperPrismParameters::Values<Param> parameterValues;
     
     // Filter processing - using two filters (high-pass + low-pass = band-pass)
     using FilterType = juce::dsp::IIR::Filter<float>;
@@ -67,18 +83,19 @@ private:
     juce::dsp::ProcessorDuplicator<FilterType, CoefficientsType> highPassFilter;
     juce::dsp::ProcessorDuplicator<FilterType, CoefficientsType> lowPassFilter;
     
-    // Parameter smoothing
-    juce::SmoothedValue<float> centerFreqSmoothed;
-    juce::SmoothedValue<float> bandwidthSmoothed;
-    juce::SmoothedValue<float> gainSmoothed;
-    juce::SmoothedValue<float> mixSmoothed;
+    // Gain and mix ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp gainRamp;
+    HyperPrismDSP::ParameterRamp mixRamp;
     
     double currentSampleRate = 44100.0;
 
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
 
     void updateFilters();
-    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BandPassProcessor)
 };
\ No newline at end of file
@@ -3,14 +3,32 @@
 //==============================================================================
 
 #include "BandRejectProcessor.h"
-#include "BandRejectEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "BandRejectEditor.h"
+#endif
+
+namespace
+{
+    using Param = BandRejectProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        boolParameter(Param::bypass, "bypass", "Bypass", false),
+        floatParameter(Param::centerFreq, "centerFreq", "Center Frequency", 20.0f, 20000.0f, 1.0f, 0.3f, 1000.0f, 0, " Hz"),
+        floatParameter(Param::q, "q", "Q", 0.1f, 20.0f, 0.01f, 0.5f, 1.0f, 2),
+        floatParameter(Param::gain, "gain", "Gain", -24.0f, 24.0f, 0.1f, 1.0f, 0.0f, 1, " dB"),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 100.0f, 1, " %")
+    }}};
+
+    static_assert(parameterTable.isValid(), "BandReject parameter table out of step with BandRejectProcessor::Param");
+}
 
 // Parameter IDs
-const juce::String BandRejectProcessor::BYPASS_ID = "bypass";
-const juce::String BandRejectProcessor::CENTER_FREQ_ID = "centerFreq";
-const juce::String BandRejectProcessor::Q_ID = "q";
-const juce::String BandRejectProcessor::GAIN_ID = "gain";
-const juce::String BandRejectProcessor::MIX_ID = "mix";
+const juce::String BandRejectProcessor::BYPASS_ID = parameterTable[Param::bypass].id;
+const juce::String BandRejectProcessor::CENTER_FREQ_ID = parameterTable[Param::centerFreq].id;
+const juce::String BandRejectProcessor::Q_ID = parameterTable[Param::q].id;
+const juce::String BandRejectProcessor::GAIN_ID = parameterTable[Param::gain].id;
+const juce::String BandRejectProcessor::MIX_ID = parameterTable[Param::mix].id;
 
 //==============================================================================
 BandRejectProcessor::BandRejectProcessor()
@@ -24,7 +42,8 @@ BandRejectProcessor::BandRejectProcessor()
                      #endif
                        ),
 #endif
-    valueTreeState(*this, nullptr, "PARAMETERS", createParameterLayout())
+    valueTreeState(*this, nullptr, "PARAMETERS", HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(valueTreeState, parameterTable)
 {
 }
 
@@ -35,7 +54,7 @@ BandRejectProcessor::~BandRejectProcessor()
 //==============================================================================
 const juce::String BandRejectProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Band-Reject Filter";
 }
 
 bool BandRejectProcessor::acceptsMidi() const
@@ -96,6 +115,7 @@ void BandRejectProcessor::changeProgramName(int, const juce::String&)
 //==============================================================================
 void BandRejectProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     juce::dsp::ProcessSpec spec;
@@ -105,22 +125,16 @@ void BandRejectProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     
     notchFilter.prepare(spec);
     
-    // Initialize smoothed values
-    const float smoothTime = 0.005f; // 5ms smoothing for real-time response
-    centerFreqSmoothed.reset(sampleRate, smoothTime);
-    qSmoothed.reset(sampleRate, smoothTime);
-    gainSmoothed.reset(sampleRate, smoothTime);
-    mixSmoothed.reset(sampleRate, smoothTime);
-    
-    // Set initial values
-    centerFreqSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(CENTER_FREQ_ID)->load());
-    qSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(Q_ID)->load());
-    gainSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(GAIN_ID)->load());
-    mixSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(MIX_ID)->load());
-    
     updateFilter();
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.005; // 5ms smoothing for real-time response
+    gainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    gainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(parameterValues.get(Param::gain)));
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void BandRejectProcessor::releaseResources()
@@ -149,8 +163,13 @@ bool BandRejectProcessor::isBusesLayoutSupported(const BusesLayout& layouts) con
 }
 #endif
 
-void BandRejectProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void BandRejectProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("BandReject::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -158,18 +177,14 @@ void BandRejectProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    const auto values = parameterValues.snapshot();
+
     // Check bypass
-    if (valueTreeState.getRawParameterValue(BYPASS_ID)->load() > 0.5f)
+    if (values.isOn(Param::bypass))
         return;
 
-    // Update smoothed parameters
-    centerFreqSmoothed.setTargetValue(valueTreeState.getRawParameterValue(CENTER_FREQ_ID)->load());
-    qSmoothed.setTargetValue(valueTreeState.getRawParameterValue(Q_ID)->load());
-    gainSmoothed.setTargetValue(valueTreeState.getRawParameterValue(GAIN_ID)->load());
-    mixSmoothed.setTargetValue(valueTreeState.getRawParameterValue(MIX_ID)->load());
-
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
 
     // Always update filter to ensure real-time parameter changes
     updateFilter();
@@ -180,39 +195,36 @@ void BandRejectProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     notchFilter.process(context);
 
     // Apply gain
-    float currentGain = juce::Decibels::decibelsToGain(valueTreeState.getRawParameterValue(GAIN_ID)->load());
+    const int numSamples = buffer.getNumSamples();
+    gainRamp.setTarget(juce::Decibels::decibelsToGain(values[Param::gain]));
+    mixRamp.setTarget(values[Param::mix] * 0.01f); // Convert percentage to ratio
+    const auto* gains = gainRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
+
     for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= currentGain;
-        }
-    }
+        HyperPrismLargeBlocks::applyGain(buffer.getWritePointer(channel), gains, gainRamp.isConstant(), numSamples);
 
     // Mix dry and wet signals
-    float mixValue = valueTreeState.getRawParameterValue(MIX_ID)->load() * 0.01f; // Convert percentage to ratio
-    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* wetData = buffer.getWritePointer(channel);
-        auto* dryData = dryBuffer.getReadPointer(channel);
-        
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            wetData[sample] = dryData[sample] * (1.0f - mixValue) + wetData[sample] * mixValue;
-        }
-    }
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumOutputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 //==============================================================================
 bool BandRejectProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* BandRejectProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new BandRejectEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -231,11 +243,19 @@ void BandRejectProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void BandRejectProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", gainRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+}
+
 //==============================================================================
 void BandRejectProcessor::updateFilter()
 {
-    float centerFreq = valueTreeState.getRawParameterValue(CENTER_FREQ_ID)->load();
-    float q = valueTreeState.getRawParameterValue(Q_ID)->load();
+    HYPERPRISM_TRACE_SCOPE("BandReject::updateFilter");
+    float centerFreq = parameterValues.get(Param::centerFreq);
+    float q = parameterValues.get(Param::q);
     
     // Clamp frequency to valid range
     centerFreq = juce::jlimit(20.0f, static_cast<float>(currentSampleRate * 0.45), centerFreq);
@@ -244,37 +264,3 @@ void BandRejectProcessor::updateFilter()
     auto coefficients = CoefficientsType::makeNotch(currentSampleRate, centerFreq, q);
     *notchFilter.state = *coefficients;
 }
-
-juce::AudioProcessorValueTreeState::ParameterLayout BandRejectProcessor::createParameterLayout()
-{
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID, "Bypass", false));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        CENTER_FREQ_ID, "Center Frequency", 
-        juce::NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.3f), 1000.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 0) + " Hz"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        Q_ID, "Q", 
-        juce::NormalisableRange<float>(0.1f, 20.0f, 0.01f, 0.5f), 1.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 2); }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        GAIN_ID, "Gain", 
-        juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " dB"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID, "Mix", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 100.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    return { parameters.begin(), parameters.end() };
-}
\ No newline at end of file
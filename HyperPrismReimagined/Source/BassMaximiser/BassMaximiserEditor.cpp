@@ -5,6 +5,8 @@
 
 #include "BassMaximiserEditor.h"
 
+namespace HyperPrismBassMaximiserUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // BassMaximiserEditor Implementation
 //==============================================================================
 BassMaximiserEditor::BassMaximiserEditor(BassMaximiserProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(FREQUENCY_ID);
@@ -226,6 +229,7 @@ BassMaximiserEditor::~BassMaximiserEditor()
 
 void BassMaximiserEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("BassMaximiserEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -272,7 +276,7 @@ void BassMaximiserEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -561,4 +565,6 @@ void BassMaximiserEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismBassMaximiserUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "BassMaximiserProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismBassMaximiserUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -142,5 +145,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BassMaximiserEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismBassMaximiserUI
+
+using HyperPrismBassMaximiserUI::BassMaximiserEditor;
\ No newline at end of file
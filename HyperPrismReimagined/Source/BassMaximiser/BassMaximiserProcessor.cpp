@@ -1,5 +1,7 @@
 #include "BassMaximiserProcessor.h"
-#include "BassMaximiserEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "BassMaximiserEditor.h"
+#endif
 
 BassMaximiserProcessor::BassMaximiserProcessor()
     : AudioProcessor(BusesProperties()
@@ -37,7 +39,7 @@ BassMaximiserProcessor::~BassMaximiserProcessor()
 
 const juce::String BassMaximiserProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Bass Maximiser";
 }
 
 bool BassMaximiserProcessor::acceptsMidi() const
@@ -97,6 +99,7 @@ void BassMaximiserProcessor::changeProgramName(int index, const juce::String& ne
 
 void BassMaximiserProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     currentBlockSize = samplesPerBlock;
     
@@ -115,7 +118,8 @@ void BassMaximiserProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
     updateFilters();
     
     // Initialize sub-harmonic buffer
-    subHarmonicBuffer.setSize(2, samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    subHarmonicBuffer.setSize(2, scratchCapacity);
     subHarmonicBuffer.clear();
     
     // Initialize bass processing arrays
@@ -126,8 +130,8 @@ void BassMaximiserProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
     bassLevelSmoother.reset(sampleRate, 0.1);
     bassLevelSmoother.setCurrentAndTargetValue(0.0f);
     
-    outputGainSmoother.reset(sampleRate, 0.05);
-    outputGainSmoother.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(outputGainParam->get()));
+    outputGainRamp.prepare(sampleRate, 0.05, scratchCapacity);
+    outputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputGainParam->get()));
 }
 
 void BassMaximiserProcessor::releaseResources()
@@ -145,6 +149,11 @@ bool BassMaximiserProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
 
 void BassMaximiserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("BassMaximiser::processBlock");
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -165,15 +174,16 @@ void BassMaximiserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     float tightness = tightnessParam->get() / 100.0f;
     bool phaseInvert = phaseInvertParam->get();
     
-    // Update output gain smoother
-    outputGainSmoother.setTargetValue(juce::Decibels::decibelsToGain(outputGainParam->get()));
-    
     // Clear sub-harmonic buffer
     subHarmonicBuffer.clear();
     
     float totalBassLevel = 0.0f;
     int numSamples = buffer.getNumSamples();
     
+    // Render the output gain ramp, shared by both channels
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(outputGainParam->get()));
+    const auto* outputGains = outputGainRamp.process(numSamples);
+    
     // Process each channel
     for (int channel = 0; channel < juce::jmin(totalNumInputChannels, 2); ++channel)
     {
@@ -206,15 +216,15 @@ void BassMaximiserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
             // Combine bass, sub-harmonics, and high frequencies
             float output = processedBass + (subHarmonic * harmonics) + highSignal;
             
-            // Apply output gain
-            output *= outputGainSmoother.getNextValue();
-            
             channelData[sample] = output;
             
             // Accumulate bass level for metering (only channel 0 for stereo linking)
             if (channel == 0)
                 totalBassLevel += processedBass * processedBass;
         }
+        
+        // Apply output gain
+        HyperPrismLargeBlocks::applyGain(channelData, outputGains, outputGainRamp.isConstant(), numSamples);
     }
     
     // Update bass level meter (RMS)
@@ -225,12 +235,20 @@ void BassMaximiserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
 
 bool BassMaximiserProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* BassMaximiserProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new BassMaximiserEditor(*this);
+   #endif
 }
 
 void BassMaximiserProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -248,8 +266,18 @@ void BassMaximiserProcessor::setStateInformation(const void* data, int sizeInByt
             apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void BassMaximiserProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("sub-harmonic buffer", subHarmonicBuffer);
+    footprint.add("envelope state", bassEnvelopes);
+    footprint.add("envelope state", bassGainReduction);
+    footprint.add("parameter ramps", outputGainRamp.getAllocatedBytes());
+}
+
 void BassMaximiserProcessor::updateFilters()
 {
+    HYPERPRISM_TRACE_SCOPE("BassMaximiser::updateFilters");
     float frequency = frequencyParam->get();
     
     // Create low-pass filter coefficients for bass isolation
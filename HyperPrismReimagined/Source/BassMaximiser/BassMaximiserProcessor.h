@@ -1,8 +1,13 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 
-class BassMaximiserProcessor : public juce::AudioProcessor
+class BassMaximiserProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     BassMaximiserProcessor();
@@ -48,6 +53,12 @@ public:
     // Get the AudioProcessorValueTreeState
     juce::AudioProcessorValueTreeState& getValueTreeState() { return apvts; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Parameter state
     juce::AudioProcessorValueTreeState apvts;
@@ -63,6 +74,7 @@ private:
     
     // Sub-harmonic generation
     juce::AudioBuffer<float> subHarmonicBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
     float subHarmonicPhase[2] = {0.0f, 0.0f};
     
     // Bass compression/limiting (tightness control)
@@ -73,8 +85,8 @@ private:
     std::atomic<float> currentBassLevel { 0.0f };
     juce::LinearSmoothedValue<float> bassLevelSmoother;
     
-    // Output gain smoothing
-    juce::LinearSmoothedValue<float> outputGainSmoother;
+    // Output gain ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp outputGainRamp;
     
     // Helper functions
     void updateFilters();
@@ -83,5 +95,8 @@ private:
                                float tightness, float frequency);
     float calculateRMS(const float* buffer, int numSamples);
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BassMaximiserProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,228 @@
+//==============================================================================
+// HyperPrism Reimagined - Benchmark Harness Common Helpers Implementation
+//==============================================================================
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    //==============================================================================
+    Stimulus parseStimulus(const juce::String& name)
+    {
+        if (name.equalsIgnoreCase("sine"))    return Stimulus::sine;
+        if (name.equalsIgnoreCase("sweep"))   return Stimulus::sweep;
+        if (name.equalsIgnoreCase("impulse")) return Stimulus::impulse;
+        if (name.equalsIgnoreCase("silence")) return Stimulus::silence;
+        if (name.isEmpty() || name.equalsIgnoreCase("noise"))
+            return Stimulus::noise;
+
+        juce::ConsoleApplication::fail("Unknown signal '" + name + "' (expected noise, sine, sweep, impulse or silence)");
+        return Stimulus::noise;
+    }
+
+    juce::String getStimulusName(Stimulus stimulus)
+    {
+        switch (stimulus)
+        {
+            case Stimulus::noise:   return "noise";
+            case Stimulus::sine:    return "sine";
+            case Stimulus::sweep:   return "sweep";
+            case Stimulus::impulse: return "impulse";
+            case Stimulus::silence: return "silence";
+        }
+
+        return {};
+    }
+
+    //==============================================================================
+    void StimulusGenerator::prepare(Stimulus type, double newSampleRate, juce::int64 seed)
+    {
+        stimulus = type;
+        sampleRate = newSampleRate;
+        randomSeed = seed;
+        reset();
+    }
+
+    void StimulusGenerator::reset()
+    {
+        samplePosition = 0;
+        phase = 0.0;
+        random.setSeed(randomSeed);
+    }
+
+    void StimulusGenerator::fill(juce::AudioBuffer<float>& buffer)
+    {
+        const int numSamples = buffer.getNumSamples();
+        const int numChannels = buffer.getNumChannels();
+
+        if (numChannels == 0)
+            return;
+
+        auto* left = buffer.getWritePointer(0);
+
+        switch (stimulus)
+        {
+            case Stimulus::noise:
+                for (int i = 0; i < numSamples; ++i)
+                    left[i] = (random.nextFloat() * 2.0f - 1.0f) * 0.25f;
+                break;
+
+            case Stimulus::sine:
+            {
+                const double increment = juce::MathConstants<double>::twoPi * 1000.0 / sampleRate;
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    left[i] = static_cast<float>(0.5 * std::sin(phase));
+                    phase = std::fmod(phase + increment, juce::MathConstants<double>::twoPi);
+                }
+                break;
+            }
+
+            case Stimulus::sweep:
+            {
+                const double sweepLength = 4.0 * sampleRate;
+                const double ratio = std::log(20000.0 / 20.0);
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const double t = static_cast<double>((samplePosition + i) % static_cast<juce::int64>(sweepLength)) / sweepLength;
+                    const double frequency = 20.0 * std::exp(ratio * t);
+                    left[i] = static_cast<float>(0.5 * std::sin(phase));
+                    phase = std::fmod(phase + juce::MathConstants<double>::twoPi * frequency / sampleRate,
+                                      juce::MathConstants<double>::twoPi);
+                }
+                break;
+            }
+
+            case Stimulus::impulse:
+            {
+                const auto period = juce::jmax(static_cast<juce::int64>(1), static_cast<juce::int64>(sampleRate * 0.5));
+                for (int i = 0; i < numSamples; ++i)
+                    left[i] = ((samplePosition + i) % period) == 0 ? 1.0f : 0.0f;
+                break;
+            }
+
+            case Stimulus::silence:
+                buffer.clear();
+                break;
+        }
+
+        // Decorrelate the right channel slightly so stereo processors have something to work on
+        for (int channel = 1; channel < numChannels; ++channel)
+        {
+            auto* data = buffer.getWritePointer(channel);
+            if (stimulus == Stimulus::noise)
+            {
+                for (int i = 0; i < numSamples; ++i)
+                    data[i] = (random.nextFloat() * 2.0f - 1.0f) * 0.25f;
+            }
+            else
+            {
+                juce::FloatVectorOperations::copyWithMultiply(data, left, 0.8f, numSamples);
+            }
+        }
+
+        samplePosition += numSamples;
+    }
+
+    //==============================================================================
+    RunConfig parseRunConfig(const juce::ArgumentList& args)
+    {
+        RunConfig config;
+
+        if (args.containsOption("--effects"))
+        {
+            config.effects.addTokens(args.getValueForOption("--effects"), ",", {});
+            config.effects.trim();
+            config.effects.removeEmptyStrings();
+        }
+
+        if (config.effects.isEmpty())
+            for (const auto& effect : HyperPrismRegistry::getAllEffects())
+                config.effects.add(effect.name);
+
+        for (const auto& name : config.effects)
+            if (HyperPrismRegistry::findEffect(name) == nullptr)
+                juce::ConsoleApplication::fail("Unknown effect '" + name + "'");
+
+        if (args.containsOption("--rates"))
+        {
+            for (const auto& token : juce::StringArray::fromTokens(args.getValueForOption("--rates"), ",", {}))
+                if (token.getDoubleValue() > 0.0)
+                    config.sampleRates.add(token.getDoubleValue());
+        }
+
+        if (config.sampleRates.isEmpty())
+            config.sampleRates = { 44100.0, 48000.0, 96000.0, 192000.0 };
+
+        if (args.containsOption("--blocks"))
+        {
+            for (const auto& token : juce::StringArray::fromTokens(args.getValueForOption("--blocks"), ",", {}))
+                if (token.getIntValue() > 0)
+                    config.blockSizes.add(token.getIntValue());
+        }
+
+        if (config.blockSizes.isEmpty())
+            config.blockSizes = { 32, 64, 128, 256, 512, 1024, 2048 };
+
+        if (args.containsOption("--seconds"))
+            config.secondsPerRun = juce::jmax(0.01, args.getValueForOption("--seconds").getDoubleValue());
+
+        if (args.containsOption("--signal"))
+            config.stimulus = parseStimulus(args.getValueForOption("--signal"));
+
+        return config;
+    }
+
+    std::unique_ptr<juce::AudioProcessor> createEffectOrFail(const juce::String& name)
+    {
+        auto processor = HyperPrismRegistry::createEffect(name);
+
+        if (processor == nullptr)
+            juce::ConsoleApplication::fail("Unknown effect '" + name + "'");
+
+        return processor;
+    }
+
+    void prepareProcessor(juce::AudioProcessor& processor, double sampleRate, int blockSize, bool nonRealtime)
+    {
+        processor.setPlayConfigDetails(2, 2, sampleRate, blockSize);
+        processor.setNonRealtime(nonRealtime);
+        processor.prepareToPlay(sampleRate, blockSize);
+    }
+
+    //==============================================================================
+    double ticksToNanoseconds(juce::int64 ticks)
+    {
+        return static_cast<double>(ticks) * 1.0e9 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+    }
+
+    juce::var loadJson(const juce::File& file)
+    {
+        if (! file.existsAsFile())
+            juce::ConsoleApplication::fail("File not found: " + file.getFullPathName());
+
+        juce::var json;
+        auto result = juce::JSON::parse(file.loadFileAsString(), json);
+
+        if (result.failed())
+            juce::ConsoleApplication::fail("Could not parse " + file.getFullPathName() + ": " + result.getErrorMessage());
+
+        return json;
+    }
+
+    void saveJson(const juce::var& json, const juce::File& file)
+    {
+        if (! file.replaceWithText(juce::JSON::toString(json)))
+            juce::ConsoleApplication::fail("Could not write " + file.getFullPathName());
+    }
+
+    juce::String padRight(const juce::String& text, int width)
+    {
+        return text + juce::String::repeatedString(" ", juce::jmax(0, width - text.length()));
+    }
+
+    juce::String padLeft(const juce::String& text, int width)
+    {
+        return juce::String::repeatedString(" ", juce::jmax(0, width - text.length())) + text;
+    }
+}
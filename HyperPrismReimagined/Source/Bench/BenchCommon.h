@@ -0,0 +1,79 @@
+//==============================================================================
+// HyperPrism Reimagined - Benchmark Harness Common Helpers
+// Stimulus generation, option parsing and JSON output shared by every mode
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Shared/EffectRegistry.h"
+
+namespace HyperPrismBench
+{
+    //==============================================================================
+    // Synthetic input signals
+    //==============================================================================
+    enum class Stimulus
+    {
+        noise,      // White noise at -12 dBFS
+        sine,       // 1 kHz sine at -6 dBFS
+        sweep,      // Logarithmic 20 Hz - 20 kHz sweep, repeating every 4 seconds
+        impulse,    // One full-scale impulse every 0.5 seconds
+        silence
+    };
+
+    Stimulus parseStimulus(const juce::String& name);
+    juce::String getStimulusName(Stimulus stimulus);
+
+    // Generates a continuous stereo test signal block by block
+    class StimulusGenerator
+    {
+    public:
+        void prepare(Stimulus type, double sampleRate, juce::int64 seed = 0x48505246);
+        void reset();
+        void fill(juce::AudioBuffer<float>& buffer);
+
+    private:
+        Stimulus stimulus = Stimulus::noise;
+        double sampleRate = 44100.0;
+        juce::int64 samplePosition = 0;
+        double phase = 0.0;
+        juce::int64 randomSeed = 0;
+        juce::Random random;
+    };
+
+    //==============================================================================
+    // Run configuration shared by all modes
+    //==============================================================================
+    struct RunConfig
+    {
+        juce::StringArray effects;
+        juce::Array<double> sampleRates;
+        juce::Array<int> blockSizes;
+        double secondsPerRun = 2.0;
+        Stimulus stimulus = Stimulus::noise;
+    };
+
+    // Reads --effects, --rates, --blocks, --seconds and --signal, falling back to
+    // every effect, 44.1/48/96/192 kHz and 32..2048 sample blocks
+    RunConfig parseRunConfig(const juce::ArgumentList& args);
+
+    // Fails the console application with a message if an effect name is unknown
+    std::unique_ptr<juce::AudioProcessor> createEffectOrFail(const juce::String& name);
+
+    // Sets up a stereo in/out layout and calls prepareToPlay like a host would;
+    // nonRealtime prepares it the way a host does for an offline bounce
+    void prepareProcessor(juce::AudioProcessor& processor, double sampleRate, int blockSize, bool nonRealtime = false);
+
+    //==============================================================================
+    // Timing and output
+    //==============================================================================
+    double ticksToNanoseconds(juce::int64 ticks);
+
+    juce::var loadJson(const juce::File& file);
+    void saveJson(const juce::var& json, const juce::File& file);
+
+    // Minimal fixed-width table printing for console reports
+    juce::String padRight(const juce::String& text, int width);
+    juce::String padLeft(const juce::String& text, int width);
+}
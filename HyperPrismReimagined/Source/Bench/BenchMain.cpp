@@ -0,0 +1,127 @@
+//==============================================================================
+// HyperPrism Reimagined - Headless Benchmark Harness Entry Point
+// Runs the 32 processors without a host or editor
+//==============================================================================
+
+#include <JuceHeader.h>
+#include "ThroughputBenchmark.h"
+#include "RealtimeSafetyCheck.h"
+#include "TailLatencyBenchmark.h"
+#include "ScalingBenchmark.h"
+#include "GoldenRender.h"
+#include "ParameterFuzzer.h"
+#include "MemoryReport.h"
+#include "LargeBlockBenchmark.h"
+#include "RackTilingBenchmark.h"
+
+int main(int argc, char* argv[])
+{
+    // APVTS relies on timers, so a message manager has to exist even though nothing is shown
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "HyperPrismBench - headless processor benchmarks", true);
+    app.addVersionCommand("--version|-v", "HyperPrismBench 1.0.0");
+
+    app.addCommand({ "--list",
+                     "--list",
+                     "Lists the effect names accepted by --effects",
+                     {},
+                     [](const juce::ArgumentList&)
+                     {
+                         for (const auto& effect : HyperPrismRegistry::getAllEffects())
+                             std::cout << effect.name << std::endl;
+                     } });
+
+    app.addCommand({ "--throughput",
+                     "--throughput [--effects=Delay,Vocoder] [--rates=44100,96000] [--blocks=64,512] [--seconds=2] "
+                     "[--signal=noise|sine|sweep|impulse|silence] [--save=file.json] [--compare=file.json] [--tolerance=5]",
+                     "Measures ns/sample and real-time factor of processBlock",
+                     "Renders the chosen signal through every effect at each sample rate and block size. "
+                     "--save writes a JSON baseline; --compare reports the change against one and exits "
+                     "with code 2 if any configuration got slower than --tolerance percent.",
+                     HyperPrismBench::runThroughputCommand });
+
+    app.addCommand({ "--rt-check",
+                     "--rt-check [--effects=..] [--rates=..] [--blocks=..] [--seconds=1] [--seed=n] [--report=file.json] [--verbose]",
+                     "Flags heap allocation and mutex locks inside processBlock",
+                     "Runs every effect under randomised parameter automation with global operator new/delete "
+                     "(and pthread_mutex_lock on Linux) intercepted while processBlock executes. Prints each "
+                     "offending call site per effect and exits with code 3 if anything was found.",
+                     HyperPrismBench::runRealtimeSafetyCommand });
+
+    app.addCommand({ "--latency",
+                     "--latency [--effects=..] [--rates=..] [--blocks=..] [--seconds=5] [--seed=n] [--worst=5] [--histogram] [--save=file.json]",
+                     "Per-block processBlock timing percentiles under parameter automation",
+                     "Times every processBlock call while parameters sweep and jump, then reports p50/p99/p99.9/max "
+                     "against the block's real-time budget. The slowest blocks are listed with the parameter "
+                     "changes that went into them; --histogram prints the log2 duration distribution.",
+                     HyperPrismBench::runTailLatencyCommand });
+
+    app.addCommand({ "--scaling",
+                     "--scaling [--effects=..] [--instances=1,8,64,128,256,512] [--rates=48000] [--blocks=256] [--seconds=0.5] "
+                     "[--max-memory=2048] [--save=file.json]",
+                     "Per-instance cost as the number of instances in one process grows",
+                     "Creates N instances of each effect and processes one block on each in turn per host cycle. "
+                     "Reports heap state per instance, ns/sample per instance, slowdown against the smallest N, "
+                     "working set and 4 KiB page count against the L2/L3 sizes, and the N where cost first rises "
+                     "more than 25%. Instance counts whose working set exceeds --max-memory MB are skipped.",
+                     HyperPrismBench::runScalingCommand });
+
+    app.addCommand({ "--golden",
+                     "--golden[=dir] [--record] [--effects=..] [--seconds=0.5] [--tolerance-db=n] [--strict] [--report=file.json] [--verbose]",
+                     "Compares renders of every effect against stored reference renders",
+                     "Renders noise, sweep and impulse stimuli at 48 kHz / 512 through each effect with its default "
+                     "parameters and two fixed pseudo-random parameter sets. --record writes the renders to dir as "
+                     "32-bit float WAV and adds their hashes, peaks and RMS levels to dir/manifest.json; otherwise "
+                     "they are compared against dir using each effect's tolerance (bit-exact, -120 dB or -90 dB "
+                     "peak error), against the WAV where one exists and the manifest entry where not, and the error "
+                     "spectrum is printed per octave for failures. dir defaults to the repository's Golden folder. "
+                     "Renders with no reference are skipped with a warning. Exits with code 4 if anything "
+                     "differs, or with --strict, if any reference is missing.",
+                     HyperPrismBench::runGoldenCommand });
+
+    app.addCommand({ "--fuzz",
+                     "--fuzz [--effects=..] [--seed=n] [--iterations=20] [--blocks-per-case=400] [--case-seed=n] "
+                     "[--no-oversize] [--budget] [--report=file.json] [--verbose]",
+                     "Randomised parameter automation stress test",
+                     "Runs each effect through seeded cases with a random sample rate and prepared block size, "
+                     "random block sizes (including 1 and blocks larger than prepared), parameter sweeps, jumps and "
+                     "extremes, and hot, tiny, DC and silent input, followed by a silent tail. Flags NaN/Inf output, "
+                     "peaks above +24 dBFS, subnormal output, feedback that does not decay, and silence costing far "
+                     "more than signal. Over-budget blocks are reported, and fail the run with --budget. Every finding "
+                     "prints a --case-seed line that reproduces it; exits with code 5 on failure.",
+                     HyperPrismBench::runFuzzCommand });
+
+    app.addCommand({ "--memory",
+                     "--memory [--effects=..] [--rates=44100,48000,88200,96000,192000] [--blocks=512] [--instances=n] [--suite] [--save=file.json]",
+                     "Heap held by each effect after prepareToPlay, by component",
+                     "Creates and prepares each effect at every sample rate and prints the components it reports "
+                     "(delay lines, lookahead and scratch buffers, ...) next to the heap growth actually measured. "
+                     "The difference is listed as unattributed: the parameter tree, JUCE internals and third-party "
+                     "state the processor cannot see into. Ends with the largest components at the highest rate and "
+                     "the total for --instances copies of every listed effect. --suite also measures a Suite "
+                     "instance with each effect active, against the standalone effect.",
+                     HyperPrismBench::runMemoryCommand });
+
+    app.addCommand({ "--large-blocks",
+                     "--large-blocks [--effects=..] [--rates=48000] [--realtime-block=512] [--offline-block=65536] "
+                     "[--seconds=10] [--signal=noise] [--save=file.json]",
+                     "Offline bounce throughput against the realtime path",
+                     "Measures each effect twice: prepared for realtime and fed --realtime-block samples at a time, "
+                     "then prepared non-realtime, as a host does for a bounce, and fed --offline-block samples at a "
+                     "time. Prints ns/sample for both, the speedup and its geometric mean over all effects.",
+                     HyperPrismBench::runLargeBlockCommand });
+
+    app.addCommand({ "--rack-tiling",
+                     "--rack-tiling [--effects=Pan,AutoPan,QuasiStereo,MSMatrix] [--rates=48000] "
+                     "[--blocks=64,256,512,1024,2048,4096,8192,16384,65536] [--seconds=2] [--signal=noise] [--save=file.json]",
+                     "Tiled against serial Rack stages per block size",
+                     "Builds a Rack whose chain is the listed lightweight stereo effects (all of them by default) and "
+                     "times it with the stage forced tile by tile and forced slot by slot at every block size. Prints "
+                     "ns/sample for both, the speedup, which one the Rack's block-size threshold picks, and the "
+                     "smallest block from which tiling won at every larger size.",
+                     HyperPrismBench::runRackTilingCommand });
+
+    return app.findAndRunCommand(argc, argv);
+}
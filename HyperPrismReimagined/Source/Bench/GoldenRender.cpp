@@ -0,0 +1,525 @@
+//==============================================================================
+// HyperPrism Reimagined - Golden-Output Regression Implementation
+//==============================================================================
+
+#include "GoldenRender.h"
+#include "ParameterAutomation.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        static constexpr double renderSampleRate = 48000.0;
+        static constexpr int renderBlockSize = 512;
+        static constexpr int spectrumSize = 4096;
+        static constexpr int spectrumOrder = 12;
+        static constexpr int numSpectrumBands = 10;     // Octaves centred 31.25 Hz ... 16 kHz
+        static constexpr float bitExact = -std::numeric_limits<float>::infinity();
+
+        //==============================================================================
+        // How far each effect's output may move before a change counts as audible.
+        // Pure gain/matrix processors must stay bit-exact; filters and dynamics get
+        // -120 dB; anything with feedback, modulation, resampling or strong
+        // nonlinearity amplifies rounding differences and gets -90 dB.
+        float getToleranceDb(const juce::String& effect)
+        {
+            static const juce::StringArray bitExactEffects { "Pan", "MSMatrix" };
+
+            static const juce::StringArray looseEffects { "Chorus", "Delay", "Echo", "Flanger", "FrequencyShifter",
+                                                          "HarmonicExciter", "HyperPhaser", "MultiDelay", "Phaser",
+                                                          "PitchChanger", "QuasiStereo", "Reverb", "RingModulator",
+                                                          "SingleDelay", "SonicDecimator", "TubeTapeSaturation",
+                                                          "Vibrato", "Vocoder" };
+
+            if (bitExactEffects.contains(effect))   return bitExact;
+            if (looseEffects.contains(effect))      return -90.0f;
+            return -120.0f;
+        }
+
+        // Parameters that would make a render non-repeatable (system random sources)
+        // are held at a fixed normalised value in every parameter set
+        std::map<juce::String, float> getPinnedParameters(const juce::String& effect)
+        {
+            if (effect == "AutoPan")        return { { "waveform", 0.5f } };   // Square, never Random
+            if (effect == "SonicDecimator") return { { "dither", 0.0f } };
+            return {};
+        }
+
+        juce::String getParameterID(juce::AudioProcessorParameter& parameter)
+        {
+            if (auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(&parameter))
+                return withID->paramID;
+
+            return parameter.getName(64);
+        }
+
+        //==============================================================================
+        // "default" leaves every parameter where the processor puts it; "seed1" and
+        // "seed2" set each non-bypass parameter to a fixed pseudo-random value
+        const juce::StringArray parameterSets { "default", "seed1", "seed2" };
+        const std::vector<Stimulus> stimuli { Stimulus::noise, Stimulus::sweep, Stimulus::impulse };
+
+        void applyParameterSet(juce::AudioProcessor& processor, const juce::String& effect, int setIndex)
+        {
+            const auto pinned = getPinnedParameters(effect);
+            juce::Random random(static_cast<juce::int64>(setIndex) * 7919);
+
+            for (auto* parameter : processor.getParameters())
+            {
+                // Non-automatable parameters (the background thread switch) change
+                // how a processor runs, not what it renders
+                if (parameter->getName(64).containsIgnoreCase("bypass") || ! parameter->isAutomatable())
+                    continue;
+
+                const auto pin = pinned.find(getParameterID(*parameter));
+
+                if (pin != pinned.end())
+                    ParameterAutomation::setFromHost(*parameter, pin->second);
+                else if (setIndex > 0)
+                    ParameterAutomation::setFromHost(*parameter, random.nextFloat());
+            }
+        }
+
+        juce::AudioBuffer<float> render(const juce::String& effect, int setIndex, Stimulus stimulus, double seconds)
+        {
+            auto processor = createEffectOrFail(effect);
+            prepareProcessor(*processor, renderSampleRate, renderBlockSize);
+            applyParameterSet(*processor, effect, setIndex);
+
+            StimulusGenerator generator;
+            generator.prepare(stimulus, renderSampleRate);
+
+            const int totalSamples = static_cast<int>(seconds * renderSampleRate);
+            juce::AudioBuffer<float> output(2, totalSamples);
+            juce::AudioBuffer<float> block(2, renderBlockSize);
+            juce::MidiBuffer midi;
+
+            for (int position = 0; position < totalSamples; position += renderBlockSize)
+            {
+                const int numSamples = juce::jmin(renderBlockSize, totalSamples - position);
+                block.setSize(2, numSamples, false, false, true);
+                generator.fill(block);
+                processor->processBlock(block, midi);
+
+                for (int channel = 0; channel < 2; ++channel)
+                    output.copyFrom(channel, position, block, channel, 0, numSamples);
+            }
+
+            processor->releaseResources();
+            return output;
+        }
+
+        //==============================================================================
+        juce::File getReferenceFile(const juce::File& directory, const juce::String& effect, int setIndex, Stimulus stimulus)
+        {
+            return directory.getChildFile(effect)
+                            .getChildFile(parameterSets[setIndex] + "-" + getStimulusName(stimulus) + ".wav");
+        }
+
+        // 32-bit float WAV, so the reference holds exactly what processBlock produced
+        bool writeWav(const juce::File& file, const juce::AudioBuffer<float>& buffer)
+        {
+            file.getParentDirectory().createDirectory();
+            file.deleteFile();
+
+            std::unique_ptr<juce::OutputStream> stream = file.createOutputStream();
+            if (stream == nullptr)
+                return false;
+
+            juce::WavAudioFormat wav;
+            std::unique_ptr<juce::AudioFormatWriter> writer(wav.createWriterFor(stream.get(), renderSampleRate,
+                                                                                static_cast<unsigned int>(buffer.getNumChannels()),
+                                                                                32, {}, 0));
+            if (writer == nullptr)
+                return false;
+
+            stream.release();   // Now owned by the writer
+            return writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+        }
+
+        bool readWav(const juce::File& file, juce::AudioBuffer<float>& buffer)
+        {
+            juce::AudioFormatManager formats;
+            formats.registerBasicFormats();
+
+            std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+            if (reader == nullptr)
+                return false;
+
+            buffer.setSize(static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples));
+            return reader->read(&buffer, 0, buffer.getNumSamples(), 0, true, true);
+        }
+
+        //==============================================================================
+        // The manifest is what the repository keeps: a hash of each render plus
+        // its per-channel peak and RMS. The WAVs stay local (the directory's
+        // .gitignore drops them) and give the full comparison where present.
+        const juce::String manifestName = "manifest.json";
+
+        juce::String getReferenceKey(const juce::String& effect, int setIndex, Stimulus stimulus)
+        {
+            return effect + "/" + parameterSets[setIndex] + "-" + getStimulusName(stimulus);
+        }
+
+        // 64-bit FNV-1a over the raw float samples, channel by channel
+        juce::String hashSamples(const juce::AudioBuffer<float>& buffer)
+        {
+            juce::uint64 hash = 0xcbf29ce484222325ull;
+
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                const auto* bytes = reinterpret_cast<const juce::uint8*>(buffer.getReadPointer(channel));
+                const auto numBytes = sizeof(float) * static_cast<size_t>(buffer.getNumSamples());
+
+                for (size_t i = 0; i < numBytes; ++i)
+                    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+            }
+
+            return juce::String::toHexString(static_cast<juce::int64>(hash)).paddedLeft('0', 16);
+        }
+
+        juce::var makeFingerprint(const juce::AudioBuffer<float>& buffer)
+        {
+            juce::Array<juce::var> peaks, levels;
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                peaks.add(buffer.getMagnitude(channel, 0, buffer.getNumSamples()));
+                levels.add(buffer.getRMSLevel(channel, 0, buffer.getNumSamples()));
+            }
+
+            auto* object = new juce::DynamicObject();
+            object->setProperty("hash", hashSamples(buffer));
+            object->setProperty("samples", buffer.getNumSamples());
+            object->setProperty("peak", peaks);
+            object->setProperty("rms", levels);
+            return juce::var(object);
+        }
+
+        //==============================================================================
+        struct Comparison
+        {
+            bool lengthMatches = true;
+            float maxError = 0.0f;
+            float maxErrorDb = bitExact;
+            float rmsErrorDb = bitExact;
+            int firstDifference = -1;
+            std::array<float, numSpectrumBands> bandErrorDb {};
+        };
+
+        float toDecibels(float gain)
+        {
+            return gain > 0.0f ? 20.0f * std::log10(gain) : bitExact;
+        }
+
+        // Averaged Hann-windowed power spectrum of the error, folded into octave bands
+        std::array<float, numSpectrumBands> getErrorSpectrum(const juce::AudioBuffer<float>& error)
+        {
+            juce::dsp::FFT fft(spectrumOrder);
+            juce::dsp::WindowingFunction<float> window(static_cast<size_t>(spectrumSize), juce::dsp::WindowingFunction<float>::hann, false);
+            std::vector<float> frame(2 * spectrumSize);
+            std::array<double, numSpectrumBands> power {};
+            int numFrames = 0;
+
+            for (int channel = 0; channel < error.getNumChannels(); ++channel)
+            {
+                for (int start = 0; start + spectrumSize <= error.getNumSamples(); start += spectrumSize / 2)
+                {
+                    std::fill(frame.begin(), frame.end(), 0.0f);
+                    std::copy(error.getReadPointer(channel, start), error.getReadPointer(channel, start) + spectrumSize, frame.begin());
+                    window.multiplyWithWindowingTable(frame.data(), static_cast<size_t>(spectrumSize));
+                    fft.performFrequencyOnlyForwardTransform(frame.data());
+
+                    for (int bin = 1; bin < spectrumSize / 2; ++bin)
+                    {
+                        const double frequency = bin * renderSampleRate / spectrumSize;
+                        const int band = juce::jlimit(0, numSpectrumBands - 1,
+                                                      static_cast<int>(std::floor(std::log2(frequency / 31.25) + 0.5)));
+                        const double magnitude = frame[static_cast<size_t>(bin)] * 2.0 / (spectrumSize * 0.5);
+                        power[static_cast<size_t>(band)] += magnitude * magnitude;
+                    }
+
+                    ++numFrames;
+                }
+            }
+
+            std::array<float, numSpectrumBands> bands {};
+            for (size_t band = 0; band < bands.size(); ++band)
+                bands[band] = numFrames > 0 ? toDecibels(static_cast<float>(std::sqrt(power[band] / numFrames))) : bitExact;
+
+            return bands;
+        }
+
+        Comparison compare(const juce::AudioBuffer<float>& reference, const juce::AudioBuffer<float>& rendered)
+        {
+            Comparison result;
+            result.lengthMatches = reference.getNumChannels() == rendered.getNumChannels()
+                                   && reference.getNumSamples() == rendered.getNumSamples();
+
+            const int numChannels = juce::jmin(reference.getNumChannels(), rendered.getNumChannels());
+            const int numSamples = juce::jmin(reference.getNumSamples(), rendered.getNumSamples());
+
+            juce::AudioBuffer<float> error(juce::jmax(1, numChannels), juce::jmax(1, numSamples));
+            error.clear();
+            double sumOfSquares = 0.0;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                const auto* expected = reference.getReadPointer(channel);
+                const auto* actual = rendered.getReadPointer(channel);
+                auto* difference = error.getWritePointer(channel);
+
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    // NaN where the reference has a number (or vice versa) is always a failure
+                    if (std::isnan(actual[i]) || std::isnan(expected[i]))
+                    {
+                        if (std::isnan(actual[i]) != std::isnan(expected[i]))
+                        {
+                            result.maxError = std::numeric_limits<float>::infinity();
+                            result.firstDifference = result.firstDifference < 0 ? i : juce::jmin(result.firstDifference, i);
+                        }
+
+                        continue;
+                    }
+
+                    difference[i] = actual[i] - expected[i];
+                    const auto magnitude = std::abs(difference[i]);
+                    result.maxError = juce::jmax(result.maxError, magnitude);
+
+                    if (magnitude > 0.0f && (result.firstDifference < 0 || i < result.firstDifference))
+                        result.firstDifference = i;
+
+                    sumOfSquares += static_cast<double>(magnitude) * magnitude;
+                }
+            }
+
+            result.maxErrorDb = toDecibels(result.maxError);
+            result.rmsErrorDb = toDecibels(static_cast<float>(std::sqrt(sumOfSquares / juce::jmax(1, numChannels * numSamples))));
+
+            if (result.maxError > 0.0f)
+                result.bandErrorDb = getErrorSpectrum(error);
+            else
+                result.bandErrorDb.fill(bitExact);
+
+            return result;
+        }
+
+        // Without the reference samples the error itself cannot be measured, but
+        // it cannot be smaller than the change in any channel's peak or RMS. A
+        // different hash therefore fails only when that lower bound is already
+        // beyond the tolerance; bit-exact effects need the hash to match.
+        Comparison compareFingerprint(const juce::var& reference, const juce::AudioBuffer<float>& rendered)
+        {
+            Comparison result;
+            const auto* peaks = reference["peak"].getArray();
+            const auto* levels = reference["rms"].getArray();
+
+            result.lengthMatches = peaks != nullptr && levels != nullptr
+                                   && peaks->size() == rendered.getNumChannels()
+                                   && levels->size() == rendered.getNumChannels()
+                                   && static_cast<int>(reference["samples"]) == rendered.getNumSamples();
+
+            if (! result.lengthMatches || reference["hash"].toString() == hashSamples(rendered))
+                return result;
+
+            float bound = std::numeric_limits<float>::min();
+            for (int channel = 0; channel < rendered.getNumChannels(); ++channel)
+            {
+                const auto peak = rendered.getMagnitude(channel, 0, rendered.getNumSamples());
+                const auto level = rendered.getRMSLevel(channel, 0, rendered.getNumSamples());
+
+                if (std::isnan(peak) || std::isnan(level))
+                    bound = std::numeric_limits<float>::infinity();
+                else
+                    bound = juce::jmax(bound, std::abs(peak - static_cast<float>((*peaks)[channel])),
+                                              std::abs(level - static_cast<float>((*levels)[channel])));
+            }
+
+            result.maxError = bound;
+            result.maxErrorDb = toDecibels(bound);
+            result.rmsErrorDb = result.maxErrorDb;
+            return result;
+        }
+
+        juce::String formatDb(float decibels)
+        {
+            return std::isinf(decibels) && decibels < 0.0f ? juce::String("exact") : juce::String(decibels, 1);
+        }
+
+        juce::String describeSpectrum(const Comparison& comparison)
+        {
+            juce::StringArray parts;
+            for (int band = 0; band < numSpectrumBands; ++band)
+            {
+                const auto centre = 31.25 * std::exp2(band);
+                const auto label = centre >= 1000.0 ? juce::String(centre / 1000.0, 1) + "k" : juce::String(juce::roundToInt(centre));
+                parts.add(label + ":" + formatDb(comparison.bandErrorDb[static_cast<size_t>(band)]));
+            }
+            return parts.joinIntoString(" ");
+        }
+    }
+
+    void runGoldenCommand(const juce::ArgumentList& args)
+    {
+        auto config = parseRunConfig(args);
+
+        const auto directory = args.getValueForOption("--golden").isNotEmpty() ? args.getFileForOption("--golden")
+                                                                              : juce::File(HYPERPRISM_GOLDEN_DIR);
+        const auto manifestFile = directory.getChildFile(manifestName);
+        auto manifest = manifestFile.existsAsFile() ? loadJson(manifestFile) : juce::var();
+
+        // Verification renders as long as the references were recorded
+        if (! args.containsOption("--seconds"))
+            config.secondsPerRun = manifest.hasProperty("seconds") ? static_cast<double>(manifest["seconds"]) : 0.5;
+
+        const bool recording = args.containsOption("--record");
+        const bool verbose = args.containsOption("--verbose");
+        const bool strict = args.containsOption("--strict");
+        const bool overrideTolerance = args.containsOption("--tolerance-db");
+        const float toleranceOverride = args.getValueForOption("--tolerance-db").getFloatValue();
+
+        if (recording)
+        {
+            // Recording a subset of effects keeps the others' entries, unless
+            // the render length changed under them
+            if (! juce::approximatelyEqual(static_cast<double>(manifest["seconds"]), config.secondsPerRun)
+                || manifest["renders"].getDynamicObject() == nullptr)
+            {
+                auto* root = new juce::DynamicObject();
+                root->setProperty("sampleRate", renderSampleRate);
+                root->setProperty("blockSize", renderBlockSize);
+                root->setProperty("seconds", config.secondsPerRun);
+                root->setProperty("renders", juce::var(new juce::DynamicObject()));
+                manifest = juce::var(root);
+            }
+
+            auto* renders = manifest["renders"].getDynamicObject();
+            int numWritten = 0;
+
+            for (const auto& effect : config.effects)
+            {
+                for (int setIndex = 0; setIndex < parameterSets.size(); ++setIndex)
+                {
+                    for (auto stimulus : stimuli)
+                    {
+                        const auto file = getReferenceFile(directory, effect, setIndex, stimulus);
+                        const auto rendered = render(effect, setIndex, stimulus, config.secondsPerRun);
+
+                        if (! writeWav(file, rendered))
+                            juce::ConsoleApplication::fail("Could not write " + file.getFullPathName());
+
+                        renders->setProperty(getReferenceKey(effect, setIndex, stimulus), makeFingerprint(rendered));
+
+                        ++numWritten;
+                    }
+                }
+
+                std::cout << "Recorded " << effect << std::endl;
+            }
+
+            saveJson(manifest, manifestFile);
+            std::cout << numWritten << " reference renders written to " << directory.getFullPathName() << std::endl
+                      << "Commit " << manifestFile.getFullPathName() << " with the change that moved them" << std::endl;
+            return;
+        }
+
+        std::cout << padRight("Effect", 22) << padRight("Set", 9) << padRight("Signal", 9)
+                  << padLeft("tolerance", 10) << padLeft("max dB", 9) << padLeft("rms dB", 9) << "  result" << std::endl;
+
+        juce::Array<juce::var> jsonResults;
+        int numFailures = 0, numMissing = 0;
+
+        for (const auto& effect : config.effects)
+        {
+            const float tolerance = overrideTolerance ? toleranceOverride : getToleranceDb(effect);
+
+            for (int setIndex = 0; setIndex < parameterSets.size(); ++setIndex)
+            {
+                for (auto stimulus : stimuli)
+                {
+                    const auto file = getReferenceFile(directory, effect, setIndex, stimulus);
+                    const auto fingerprint = manifest["renders"][juce::Identifier(getReferenceKey(effect, setIndex, stimulus))];
+                    juce::AudioBuffer<float> reference;
+
+                    // The full comparison where the WAV was recorded locally,
+                    // otherwise the committed fingerprint
+                    const bool haveSamples = file.existsAsFile() && readWav(file, reference);
+
+                    if (! haveSamples && ! fingerprint.isObject())
+                    {
+                        std::cout << padRight(effect, 22) << padRight(parameterSets[setIndex], 9)
+                                  << padRight(getStimulusName(stimulus), 9)
+                                  << (strict ? "  FAIL (no reference)" : "  skipped (no reference)") << std::endl;
+                        ++numMissing;
+                        continue;
+                    }
+
+                    const auto rendered = render(effect, setIndex, stimulus, config.secondsPerRun);
+                    const auto comparison = haveSamples ? compare(reference, rendered) : compareFingerprint(fingerprint, rendered);
+                    const bool passed = comparison.lengthMatches
+                                        && (std::isinf(tolerance) ? juce::exactlyEqual(comparison.maxError, 0.0f)
+                                                                  : comparison.maxErrorDb <= tolerance);
+
+                    numFailures += passed ? 0 : 1;
+
+                    std::cout << padRight(effect, 22) << padRight(parameterSets[setIndex], 9)
+                              << padRight(getStimulusName(stimulus), 9)
+                              << padLeft(formatDb(tolerance), 10)
+                              << padLeft(formatDb(comparison.maxErrorDb), 9)
+                              << padLeft(formatDb(comparison.rmsErrorDb), 9)
+                              << (passed ? "  ok" : comparison.lengthMatches ? "  FAIL" : "  FAIL (length)")
+                              << (haveSamples ? "" : " (hash)") << std::endl;
+
+                    if ((! passed || verbose) && comparison.maxError > 0.0f && haveSamples)
+                    {
+                        std::cout << "      first difference at sample " << comparison.firstDifference
+                                  << "; error spectrum (dBFS per octave) " << describeSpectrum(comparison) << std::endl;
+                    }
+
+                    auto* object = new juce::DynamicObject();
+                    object->setProperty("effect", effect);
+                    object->setProperty("parameterSet", parameterSets[setIndex]);
+                    object->setProperty("signal", getStimulusName(stimulus));
+                    object->setProperty("toleranceDb", std::isinf(tolerance) ? juce::var("exact") : juce::var(tolerance));
+                    object->setProperty("maxErrorDb", std::isinf(comparison.maxErrorDb) ? juce::var("exact") : juce::var(comparison.maxErrorDb));
+                    object->setProperty("rmsErrorDb", std::isinf(comparison.rmsErrorDb) ? juce::var("exact") : juce::var(comparison.rmsErrorDb));
+                    object->setProperty("firstDifference", comparison.firstDifference);
+                    object->setProperty("comparedWith", haveSamples ? "samples" : "hash");
+                    object->setProperty("passed", passed);
+
+                    juce::Array<juce::var> spectrum;
+                    for (auto band : comparison.bandErrorDb)
+                        spectrum.add(std::isinf(band) ? juce::var() : juce::var(band));
+                    object->setProperty("errorSpectrumOctavesDb", spectrum);
+
+                    jsonResults.add(juce::var(object));
+                }
+            }
+        }
+
+        if (args.containsOption("--report"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("references", directory.getFullPathName());
+            root->setProperty("failures", numFailures);
+            root->setProperty("missing", numMissing);
+            root->setProperty("missingIsFailure", strict);
+            root->setProperty("results", jsonResults);
+
+            auto file = args.getFileForOption("--report");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved golden report to " << file.getFullPathName() << std::endl;
+        }
+
+        std::cout << std::endl << numFailures << " failed, " << numMissing << (strict ? " missing" : " skipped") << std::endl;
+
+        // Renders nobody has recorded yet catch nothing either way; they warn
+        // rather than fail unless --strict asks for a complete manifest
+        if (numMissing > 0 && ! strict)
+            std::cout << "Warning: " << numMissing << " renders have no reference and were not checked; "
+                      << "record them with --golden --record" << std::endl;
+
+        if (numFailures > 0 || (strict && numMissing > 0))
+            juce::ConsoleApplication::fail("Output differs from the reference renders", 4);
+    }
+}
@@ -0,0 +1,16 @@
+//==============================================================================
+// HyperPrism Reimagined - Golden-Output Regression
+// Renders fixed stimuli through every effect with fixed parameter sets and
+// compares the result against stored reference renders
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --golden[=dir] [--record] [--effects=..] [--seconds=0.5] [--tolerance-db=n]
+    //              [--strict] [--report=file.json] [--verbose]
+    void runGoldenCommand(const juce::ArgumentList& args);
+}
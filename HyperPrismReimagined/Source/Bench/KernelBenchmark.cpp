@@ -0,0 +1,476 @@
+//==============================================================================
+// HyperPrism Reimagined - DSP Kernel Micro-Benchmarks
+// Times the per-sample building blocks of the processors in isolation and
+// reports cycles/sample, so kernel changes can be judged on their own
+//==============================================================================
+
+#include <JuceHeader.h>
+#include "BenchCommon.h"
+#include "../DSP/Biquad.h"
+#include "../DSP/ControlSignal.h"
+#include "../DSP/DelayLine.h"
+#include "../DSP/EnvelopeFollower.h"
+#include "../DSP/Lfo.h"
+#include "../HyperPhaser/HyperPhaserProcessor.h"
+#include "../RingModulator/RingModulatorProcessor.h"
+#include "../Shared/CoefficientCache.h"
+#include "../TubeTapeSaturation/TubeTapeSaturationProcessor.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+//==============================================================================
+// Befriended by the processors above to reach their private kernels
+//==============================================================================
+struct HyperPrismKernelAccess
+{
+    static float tanhSaturation(TubeTapeSaturationProcessor& processor, float input, float amount)
+    {
+        return processor.tanhSaturation(input, amount);
+    }
+
+    static float generateWaveform(RingModulatorProcessor& processor, float phase, int waveformType)
+    {
+        return processor.generateWaveform(phase, waveformType);
+    }
+
+    static float calculateAllpassCoefficient(HyperPhaserProcessor& processor, float frequency)
+    {
+        return processor.calculateAllpassCoefficient(frequency);
+    }
+};
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        static constexpr int blockSize = 4096;
+        static constexpr double sampleRate = 48000.0;
+
+        // Runs one block of the kernel and returns something derived from every output
+        using KernelFunction = std::function<float(const float* input, int numSamples)>;
+
+        struct Kernel
+        {
+            juce::String name;
+            KernelFunction run;
+        };
+
+        struct KernelResult
+        {
+            juce::String name;
+            double nanosecondsPerSample = 0.0;
+            double cyclesPerSample = 0.0;         // Median
+            double minCyclesPerSample = 0.0;
+        };
+
+        // Keeps results observable so the optimiser can't drop the work
+        volatile float sink = 0.0f;
+
+        //==============================================================================
+        // x86 reads the time-stamp counter (reference cycles at the nominal clock);
+        // elsewhere cycles are estimated from elapsed time and the reported CPU speed
+        bool hasCycleCounter()
+        {
+           #if JUCE_INTEL
+            return true;
+           #else
+            return false;
+           #endif
+        }
+
+        juce::uint64 readCycleCounter()
+        {
+           #if JUCE_INTEL
+            return static_cast<juce::uint64>(__rdtsc());
+           #else
+            return 0;
+           #endif
+        }
+
+        //==============================================================================
+        std::vector<Kernel> createKernels()
+        {
+            std::vector<Kernel> kernels;
+
+            // Modulated delay times like the processors' LFOs produce, generated up front
+            auto makeDelayTimes = [](float centreMs, float depthMs, float rateHz)
+            {
+                auto times = std::make_shared<std::vector<float>>(static_cast<size_t>(blockSize));
+                for (int i = 0; i < blockSize; ++i)
+                    (*times)[static_cast<size_t>(i)] = static_cast<float>(sampleRate / 1000.0) * (centreMs + depthMs * std::sin(juce::MathConstants<float>::twoPi * rateHz * static_cast<float>(i / sampleRate)));
+                return times;
+            };
+
+            // Read then push with feedback, as Chorus and Flanger (linear) and Vibrato (cubic) do
+            auto addModulatedDelay = [&kernels, &makeDelayTimes](const juce::String& name, float maxDelayMs, float centreMs, float depthMs, float rateHz, float feedback, bool cubic)
+            {
+                auto delayLine = std::make_shared<HyperPrismDSP::DelayLine>();
+                delayLine->prepare(static_cast<int>(maxDelayMs * 0.001 * sampleRate));
+                auto times = makeDelayTimes(centreMs, depthMs, rateHz);
+
+                kernels.push_back({ name, [delayLine, times, feedback, cubic](const float* input, int numSamples)
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                    {
+                        const auto delaySamples = (*times)[static_cast<size_t>(i)];
+                        const auto delayed = cubic ? delayLine->readCubic(delaySamples) : delayLine->readLinear(delaySamples);
+                        delayLine->push(input[i] + delayed * feedback);
+                        sum += delayed;
+                    }
+                    return sum;
+                } });
+            };
+
+            addModulatedDelay("DelayLine::readLinear (Chorus)", 100.0f, 20.0f, 5.0f, 1.5f, 0.3f, false);
+            addModulatedDelay("DelayLine::readLinear (Flanger)", 50.0f, 3.0f, 2.0f, 0.5f, 0.5f, false);
+            addModulatedDelay("DelayLine::readCubic (Vibrato)", 100.0f, 5.0f, 3.0f, 5.0f, 0.0f, true);
+
+            // A fixed delay a block at a time, as Reverb's pre-delay runs
+            {
+                auto delayLine = std::make_shared<HyperPrismDSP::DelayLine>();
+                delayLine->prepare(static_cast<int>(0.5 * sampleRate), blockSize);
+                auto output = std::make_shared<std::vector<float>>(static_cast<size_t>(blockSize));
+
+                kernels.push_back({ "DelayLine::pushBlock/readBlock", [delayLine, output](const float* input, int numSamples)
+                {
+                    delayLine->pushBlock(input, numSamples);
+                    delayLine->readBlock(output->data(), static_cast<int>(0.02 * sampleRate), numSamples);
+
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += (*output)[static_cast<size_t>(i)];
+                    return sum;
+                } });
+            }
+
+            {
+                auto lfo = std::make_shared<HyperPrismDSP::SineLfo>();
+                lfo->setFrequency(1.5f, sampleRate);
+
+                kernels.push_back({ "SineLfo::getNextSample", [lfo](const float*, int numSamples)
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += lfo->getNextSample();
+                    return sum;
+                } });
+            }
+
+            {
+                auto lfo = std::make_shared<HyperPrismDSP::SineLfo>();
+                lfo->setFrequency(1.5f, sampleRate);
+                auto output = std::make_shared<std::vector<float>>(static_cast<size_t>(blockSize));
+
+                kernels.push_back({ "SineLfo::process (block)", [lfo, output](const float*, int numSamples)
+                {
+                    lfo->process(output->data(), numSamples);
+
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += (*output)[static_cast<size_t>(i)];
+                    return sum;
+                } });
+            }
+
+            // Low cut + high cut per channel as in Chorus/Flanger/Delay, then a four-stage cascade
+            for (int numStages : { 2, 4 })
+            {
+                auto filters = std::make_shared<std::vector<juce::IIRFilter>>(static_cast<size_t>(numStages));
+                for (int stage = 0; stage < numStages; ++stage)
+                {
+                    (*filters)[static_cast<size_t>(stage)].setCoefficients(stage % 2 == 0 ? juce::IIRCoefficients::makeHighPass(sampleRate, 80.0, 0.707)
+                                                                                           : juce::IIRCoefficients::makeLowPass(sampleRate, 8000.0, 0.707));
+                }
+
+                kernels.push_back({ "IIRFilter::processSingleSampleRaw x" + juce::String(numStages), [filters](const float* input, int numSamples)
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                    {
+                        float sample = input[i];
+                        for (auto& filter : *filters)
+                            sample = filter.processSingleSampleRaw(sample);
+                        sum += sample;
+                    }
+                    return sum;
+                } });
+            }
+
+            // The same low cut + high cut on the Biquad those effects now run, with fixed
+            // coefficients and gliding to a new set every ramp, the worst case under automation
+            for (bool gliding : { false, true })
+            {
+                auto filters = std::make_shared<std::array<HyperPrismDSP::Biquad, 2>>();
+                const auto settings = std::array<HyperPrismCoefficients::CutFilters, 2> { HyperPrismCoefficients::makeCutFilters(sampleRate, 80.0f, 8000.0f),
+                                                                                          HyperPrismCoefficients::makeCutFilters(sampleRate, 120.0f, 6000.0f) };
+                (*filters)[0].setCoefficients(settings[0].lowCut);
+                (*filters)[1].setCoefficients(settings[0].highCut);
+
+                kernels.push_back({ juce::String("Biquad::processSample x2") + (gliding ? " (gliding)" : ""),
+                                    [filters, settings, gliding, toggle = 0](const float* input, int numSamples) mutable
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                    {
+                        if (gliding && i % HyperPrismCoefficients::rampSamples == 0)
+                        {
+                            toggle ^= 1;
+                            (*filters)[0].rampTo(settings[static_cast<size_t>(toggle)].lowCut, HyperPrismCoefficients::rampSamples);
+                            (*filters)[1].rampTo(settings[static_cast<size_t>(toggle)].highCut, HyperPrismCoefficients::rampSamples);
+                        }
+
+                        float sample = input[i];
+                        for (auto& filter : *filters)
+                            sample = filter.processSample(sample);
+                        sum += sample;
+                    }
+                    return sum;
+                } });
+            }
+
+            {
+                auto processor = std::make_shared<TubeTapeSaturationProcessor>();
+                prepareProcessor(*processor, sampleRate, blockSize);
+
+                kernels.push_back({ "TubeTapeSaturation::tanhSaturation", [processor](const float* input, int numSamples)
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += HyperPrismKernelAccess::tanhSaturation(*processor, input[i] * 4.0f, 2.5f);
+                    return sum;
+                } });
+            }
+
+            {
+                auto processor = std::make_shared<RingModulatorProcessor>();
+                prepareProcessor(*processor, sampleRate, blockSize);
+
+                // Phases as the processor feeds them: accumulating, wrapped at 2 pi
+                auto phases = std::make_shared<std::vector<float>>(static_cast<size_t>(blockSize));
+                for (int i = 0; i < blockSize; ++i)
+                    (*phases)[static_cast<size_t>(i)] = std::fmod(juce::MathConstants<float>::twoPi * 440.0f * static_cast<float>(i / sampleRate),
+                                                                  juce::MathConstants<float>::twoPi);
+
+                const char* waveformNames[] = { "sine", "triangle", "square", "saw" };
+
+                for (int waveform = 0; waveform < 4; ++waveform)
+                {
+                    kernels.push_back({ juce::String("RingModulator::generateWaveform (") + waveformNames[waveform] + ")",
+                                        [processor, phases, waveform](const float*, int numSamples)
+                    {
+                        float sum = 0.0f;
+                        for (int i = 0; i < numSamples; ++i)
+                            sum += HyperPrismKernelAccess::generateWaveform(*processor, (*phases)[static_cast<size_t>(i)], waveform);
+                        return sum;
+                    } });
+                }
+            }
+
+            {
+                auto processor = std::make_shared<HyperPhaserProcessor>();
+                prepareProcessor(*processor, sampleRate, blockSize);
+
+                auto frequencies = std::make_shared<std::vector<float>>(static_cast<size_t>(blockSize));
+                for (int i = 0; i < blockSize; ++i)
+                    (*frequencies)[static_cast<size_t>(i)] = 100.0f + 7900.0f * static_cast<float>(i) / blockSize;
+
+                kernels.push_back({ "HyperPhaser::calculateAllpassCoefficient", [processor, frequencies](const float*, int numSamples)
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += HyperPrismKernelAccess::calculateAllpassCoefficient(*processor, (*frequencies)[static_cast<size_t>(i)]);
+                    return sum;
+                } });
+
+                // The whole sweep, LFO through exp2 to coefficient, at each Modulation
+                // Quality interval; "every 1" is the audio-rate cost
+                for (int interval : HyperPrismModulation::controlIntervals)
+                {
+                    auto sweep = std::make_shared<HyperPrismDSP::ControlSignal>();
+                    sweep->prepare(interval, blockSize);
+                    auto lfo = std::make_shared<HyperPrismDSP::SineLfo>();
+                    lfo->setFrequency(0.5f, sampleRate);
+
+                    kernels.push_back({ "ControlSignal (HyperPhaser sweep, every " + juce::String(interval) + ")",
+                                        [processor, sweep, lfo](const float*, int numSamples)
+                    {
+                        const auto* coefficients = sweep->process(numSamples, [&](int)
+                        {
+                            const float lfoValue = lfo->getNextSample(sweep->getInterval());
+                            return HyperPrismKernelAccess::calculateAllpassCoefficient(*processor, 1000.0f * std::exp2f(lfoValue));
+                        });
+
+                        float sum = 0.0f;
+                        for (int i = 0; i < numSamples; ++i)
+                            sum += coefficients[i];
+                        return sum;
+                    } });
+                }
+            }
+
+            // Level detection with NoiseGate's defaults: 1 ms attack, 100 ms release
+            {
+                auto envelope = std::make_shared<HyperPrismDSP::EnvelopeFollower>();
+                envelope->setPoles(HyperPrismDSP::poleForTime(1.0f, sampleRate), HyperPrismDSP::poleForTime(100.0f, sampleRate));
+
+                kernels.push_back({ "EnvelopeFollower::process", [envelope](const float* input, int numSamples)
+                {
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += envelope->process(std::abs(input[i]));
+                    return sum;
+                } });
+            }
+
+            {
+                auto envelope = std::make_shared<HyperPrismDSP::EnvelopeFollower>();
+                envelope->setPoles(HyperPrismDSP::poleForTime(1.0f, sampleRate), HyperPrismDSP::poleForTime(100.0f, sampleRate));
+                auto levels = std::make_shared<std::vector<float>>(static_cast<size_t>(blockSize));
+
+                kernels.push_back({ "EnvelopeFollower::process (block)", [envelope, levels](const float* input, int numSamples)
+                {
+                    auto* data = levels->data();
+                    for (int i = 0; i < numSamples; ++i)
+                        data[i] = std::abs(input[i]);
+
+                    envelope->process(data, data, numSamples);
+
+                    float sum = 0.0f;
+                    for (int i = 0; i < numSamples; ++i)
+                        sum += data[i];
+                    return sum;
+                } });
+            }
+
+            return kernels;
+        }
+
+        //==============================================================================
+        KernelResult measureKernel(const Kernel& kernel, const std::vector<float>& input, int repeats)
+        {
+            const double megahertz = juce::SystemStats::getCpuSpeedInMegahertz();
+
+            for (int i = 0; i < 8; ++i)
+                sink = sink + kernel.run(input.data(), blockSize);
+
+            std::vector<double> nanoseconds, cycles;
+
+            for (int i = 0; i < repeats; ++i)
+            {
+                const auto startTicks = juce::Time::getHighResolutionTicks();
+                const auto startCycles = readCycleCounter();
+
+                sink = sink + kernel.run(input.data(), blockSize);
+
+                const auto endCycles = readCycleCounter();
+                const auto elapsed = ticksToNanoseconds(juce::Time::getHighResolutionTicks() - startTicks);
+
+                nanoseconds.push_back(elapsed / blockSize);
+                cycles.push_back(hasCycleCounter() ? static_cast<double>(endCycles - startCycles) / blockSize
+                                                   : elapsed * megahertz * 1.0e-3 / blockSize);
+            }
+
+            std::sort(nanoseconds.begin(), nanoseconds.end());
+            std::sort(cycles.begin(), cycles.end());
+
+            KernelResult result;
+            result.name = kernel.name;
+            result.nanosecondsPerSample = nanoseconds[nanoseconds.size() / 2];
+            result.cyclesPerSample = cycles[cycles.size() / 2];
+            result.minCyclesPerSample = cycles.front();
+            return result;
+        }
+
+        void runKernelCommand(const juce::ArgumentList& args)
+        {
+            const int repeats = args.containsOption("--repeats") ? juce::jmax(1, args.getValueForOption("--repeats").getIntValue()) : 200;
+
+            juce::StringArray filters;
+            if (args.containsOption("--kernels"))
+                filters.addTokens(args.getValueForOption("--kernels"), ",", {});
+            filters.removeEmptyStrings();
+
+            // Same noise stimulus the whole-plugin benchmarks use
+            juce::AudioBuffer<float> noise(2, blockSize);
+            StimulusGenerator generator;
+            generator.prepare(Stimulus::noise, sampleRate);
+            generator.fill(noise);
+            const std::vector<float> input(noise.getReadPointer(0), noise.getReadPointer(0) + blockSize);
+
+            std::cout << "Cycles: " << (hasCycleCounter() ? "time-stamp counter" : "estimated from "
+                                                           + juce::String(juce::SystemStats::getCpuSpeedInMegahertz()) + " MHz")
+                      << ", " << repeats << " x " << blockSize << " samples per kernel, median reported" << std::endl << std::endl;
+
+            std::cout << padRight("Kernel", 48) << padLeft("ns/sample", 11) << padLeft("cyc/sample", 12)
+                      << padLeft("min cyc", 10) << std::endl;
+
+            juce::Array<juce::var> jsonResults;
+
+            for (const auto& kernel : createKernels())
+            {
+                if (! filters.isEmpty())
+                {
+                    bool matches = false;
+                    for (const auto& filter : filters)
+                        matches = matches || kernel.name.containsIgnoreCase(filter.trim());
+
+                    if (! matches)
+                        continue;
+                }
+
+                const auto result = measureKernel(kernel, input, repeats);
+
+                std::cout << padRight(result.name, 48)
+                          << padLeft(juce::String(result.nanosecondsPerSample, 3), 11)
+                          << padLeft(juce::String(result.cyclesPerSample, 2), 12)
+                          << padLeft(juce::String(result.minCyclesPerSample, 2), 10) << std::endl;
+
+                auto* object = new juce::DynamicObject();
+                object->setProperty("kernel", result.name);
+                object->setProperty("nsPerSample", result.nanosecondsPerSample);
+                object->setProperty("cyclesPerSample", result.cyclesPerSample);
+                object->setProperty("minCyclesPerSample", result.minCyclesPerSample);
+                jsonResults.add(juce::var(object));
+            }
+
+            if (args.containsOption("--save"))
+            {
+                auto* root = new juce::DynamicObject();
+                root->setProperty("machine", juce::SystemStats::getComputerName());
+                root->setProperty("cpu", juce::SystemStats::getCpuModel());
+                root->setProperty("cycleCounter", hasCycleCounter());
+                root->setProperty("results", jsonResults);
+
+                auto file = args.getFileForOption("--save");
+                saveJson(juce::var(root), file);
+                std::cout << "Saved kernel report to " << file.getFullPathName() << std::endl;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // The processors own APVTS instances, which need a message manager
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "HyperPrismKernelBench - DSP kernel micro-benchmarks", true);
+    app.addVersionCommand("--version|-v", "HyperPrismKernelBench 1.0.0");
+
+    app.addDefaultCommand({ "--run",
+                            "[--kernels=Chorus,IIR] [--repeats=200] [--save=file.json]",
+                            "Times each DSP kernel over 4096-sample blocks and reports cycles/sample",
+                            "Each kernel runs on its own, outside any processBlock, with a fixed 48 kHz noise input. "
+                            "--kernels keeps only kernels whose name contains one of the given strings.",
+                            HyperPrismBench::runKernelCommand });
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,89 @@
+//==============================================================================
+// HyperPrism Reimagined - Large-Block Benchmark Implementation
+//==============================================================================
+
+#include "LargeBlockBenchmark.h"
+#include "ThroughputBenchmark.h"
+#include "../Shared/LargeBlocks.h"
+
+namespace HyperPrismBench
+{
+    void runLargeBlockCommand(const juce::ArgumentList& args)
+    {
+        auto config = parseRunConfig(args);
+
+        // One rate is enough to compare the two paths; long runs so that a
+        // 65536-sample block is timed more than a handful of times
+        if (! args.containsOption("--rates"))
+            config.sampleRates = { 48000.0 };
+
+        if (! args.containsOption("--seconds"))
+            config.secondsPerRun = 10.0;
+
+        const auto realtimeBlock = args.containsOption("--realtime-block")
+                                       ? juce::jmax(1, args.getValueForOption("--realtime-block").getIntValue())
+                                       : 512;
+        const auto offlineBlock = args.containsOption("--offline-block")
+                                      ? juce::jmax(1, args.getValueForOption("--offline-block").getIntValue())
+                                      : HyperPrismLargeBlocks::offlineBlockCapacity;
+
+        std::cout << "Realtime: " << realtimeBlock << "-sample blocks; offline: non-realtime, "
+                  << offlineBlock << "-sample blocks" << std::endl << std::endl;
+
+        std::cout << padRight("Effect", 22) << padLeft("Rate", 8) << padLeft("RT ns/smp", 12)
+                  << padLeft("Off ns/smp", 12) << padLeft("Speedup", 10) << std::endl;
+
+        juce::Array<juce::var> rows;
+        double logSpeedupSum = 0.0;
+        int numMeasured = 0;
+
+        for (const auto& effect : config.effects)
+        {
+            for (auto sampleRate : config.sampleRates)
+            {
+                const auto realtime = measureThroughput(effect, sampleRate, realtimeBlock,
+                                                        config.secondsPerRun, config.stimulus, false);
+                const auto offline = measureThroughput(effect, sampleRate, offlineBlock,
+                                                       config.secondsPerRun, config.stimulus, true);
+
+                const auto speedup = realtime.nanosecondsPerSample / juce::jmax(1.0e-9, offline.nanosecondsPerSample);
+                logSpeedupSum += std::log(speedup);
+                ++numMeasured;
+
+                std::cout << padRight(effect, 22)
+                          << padLeft(juce::String(juce::roundToInt(sampleRate)), 8)
+                          << padLeft(juce::String(realtime.nanosecondsPerSample, 2), 12)
+                          << padLeft(juce::String(offline.nanosecondsPerSample, 2), 12)
+                          << padLeft(juce::String(speedup, 2) + "x", 10) << std::endl;
+
+                auto* object = new juce::DynamicObject();
+                object->setProperty("effect", effect);
+                object->setProperty("sampleRate", sampleRate);
+                object->setProperty("realtimeNsPerSample", realtime.nanosecondsPerSample);
+                object->setProperty("offlineNsPerSample", offline.nanosecondsPerSample);
+                object->setProperty("speedup", speedup);
+                rows.add(juce::var(object));
+            }
+        }
+
+        if (numMeasured > 0)
+            std::cout << std::endl << "Geometric mean speedup: "
+                      << juce::String(std::exp(logSpeedupSum / numMeasured), 2) << "x" << std::endl;
+
+        if (args.containsOption("--save"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("version", 1);
+            root->setProperty("created", juce::Time::getCurrentTime().toISO8601(true));
+            root->setProperty("cpu", juce::SystemStats::getCpuModel());
+            root->setProperty("signal", getStimulusName(config.stimulus));
+            root->setProperty("realtimeBlock", realtimeBlock);
+            root->setProperty("offlineBlock", offlineBlock);
+            root->setProperty("results", rows);
+
+            auto file = args.getFileForOption("--save");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved results to " << file.getFullPathName() << std::endl;
+        }
+    }
+}
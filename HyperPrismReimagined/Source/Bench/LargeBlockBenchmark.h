@@ -0,0 +1,16 @@
+//==============================================================================
+// HyperPrism Reimagined - Large-Block Benchmark
+// Offline bounce throughput (non-realtime, 65536-sample blocks) against the
+// realtime path for every effect
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --large-blocks [--effects=a,b] [--rates=48000] [--realtime-block=512]
+    //                [--offline-block=65536] [--seconds=10] [--signal=type] [--save=file.json]
+    void runLargeBlockCommand(const juce::ArgumentList& args);
+}
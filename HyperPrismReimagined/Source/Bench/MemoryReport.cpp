@@ -0,0 +1,274 @@
+//==============================================================================
+// HyperPrism Reimagined - Memory Footprint Report Implementation
+//==============================================================================
+
+#include "MemoryReport.h"
+#include "RealtimeSafetyCheck.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Suite/SuiteProcessor.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        static constexpr int numLargestComponents = 10;
+
+        struct RateFootprint
+        {
+            double sampleRate = 0.0;
+            HyperPrismMemory::Footprint footprint;
+            juce::int64 measuredBytes = 0;      // Heap growth from creating and preparing the instance
+        };
+
+        struct EffectFootprints
+        {
+            juce::String effect;
+            std::vector<RateFootprint> rates;
+        };
+
+        RateFootprint measureFootprint(const juce::String& effect, double sampleRate, int blockSize)
+        {
+            RateFootprint result;
+            result.sampleRate = sampleRate;
+
+            const auto before = RealtimeTracker::getLiveHeapBytes();
+
+            auto processor = createEffectOrFail(effect);
+            prepareProcessor(*processor, sampleRate, blockSize);
+
+            result.measuredBytes = juce::jmax(static_cast<juce::int64>(0), RealtimeTracker::getLiveHeapBytes() - before);
+
+            if (auto* reporter = dynamic_cast<const HyperPrismMemory::Reporter*>(processor.get()))
+                reporter->describeMemory(result.footprint);
+
+            return result;
+        }
+
+        // The effect as the active one of a Suite instance; the difference from
+        // the standalone measurement is what the Suite costs per instance
+        juce::int64 measureSuiteHeap(const juce::String& effect, double sampleRate, int blockSize)
+        {
+            const auto& allEffects = HyperPrismRegistry::getAllEffects();
+            const auto index = std::find_if(allEffects.begin(), allEffects.end(),
+                                            [&](const auto& info) { return info.name.equalsIgnoreCase(effect); });
+
+            const auto before = RealtimeTracker::getLiveHeapBytes();
+
+            SuiteProcessor suite;
+            suite.setActiveEffect(static_cast<int>(std::distance(allEffects.begin(), index)));
+            prepareProcessor(suite, sampleRate, blockSize);
+
+            return juce::jmax(static_cast<juce::int64>(0), RealtimeTracker::getLiveHeapBytes() - before);
+        }
+
+        // Measured heap the processor could not attribute: the parameter tree,
+        // JUCE internals and any components it listed as untracked
+        juce::int64 getUnattributedBytes(const RateFootprint& rate)
+        {
+            return rate.measuredBytes - static_cast<juce::int64>(rate.footprint.getTotalBytes());
+        }
+
+        juce::String formatSigned(juce::int64 bytes)
+        {
+            return bytes < 0 ? "-" : HyperPrismMemory::formatBytes(static_cast<size_t>(bytes));
+        }
+
+        void printEffect(const EffectFootprints& result, int instances)
+        {
+            static constexpr int nameWidth = 28;
+            static constexpr int columnWidth = 13;
+
+            std::cout << result.effect << std::endl;
+
+            std::cout << "  " << padRight("component", nameWidth);
+            for (const auto& rate : result.rates)
+                std::cout << padLeft(juce::String(rate.sampleRate / 1000.0, 1) + " kHz", columnWidth);
+            std::cout << std::endl;
+
+            // Rows in the order the processor listed its components
+            for (const auto& component : result.rates.front().footprint.getComponents())
+            {
+                if (! component.isTracked)
+                    continue;
+
+                std::cout << "  " << padRight(component.name, nameWidth);
+
+                for (const auto& rate : result.rates)
+                {
+                    size_t bytes = 0;
+                    for (const auto& other : rate.footprint.getComponents())
+                        if (other.name == component.name)
+                            bytes = other.bytes;
+
+                    std::cout << padLeft(HyperPrismMemory::formatBytes(bytes), columnWidth);
+                }
+
+                std::cout << std::endl;
+            }
+
+            auto printRow = [&](const juce::String& name, std::function<juce::String(const RateFootprint&)> cell)
+            {
+                std::cout << "  " << padRight(name, nameWidth);
+                for (const auto& rate : result.rates)
+                    std::cout << padLeft(cell(rate), columnWidth);
+                std::cout << std::endl;
+            };
+
+            printRow("reported total", [](const RateFootprint& rate) { return HyperPrismMemory::formatBytes(rate.footprint.getTotalBytes()); });
+            printRow("measured heap", [](const RateFootprint& rate) { return HyperPrismMemory::formatBytes(static_cast<size_t>(rate.measuredBytes)); });
+
+            auto untracked = result.rates.front().footprint.getUntrackedNames();
+            untracked.insert(0, "parameters");
+            printRow("unattributed", [](const RateFootprint& rate) { return formatSigned(getUnattributedBytes(rate)); });
+            std::cout << "    (" << untracked.joinIntoString(", ") << ", JUCE internals)" << std::endl;
+
+            if (instances > 1)
+                printRow("x " + juce::String(instances) + " instances", [instances](const RateFootprint& rate)
+                {
+                    return HyperPrismMemory::formatBytes(static_cast<size_t>(juce::jmax(rate.measuredBytes,
+                                                         static_cast<juce::int64>(rate.footprint.getTotalBytes())) * instances));
+                });
+
+            std::cout << std::endl;
+        }
+
+        juce::var toJson(const EffectFootprints& result)
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty("effect", result.effect);
+
+            juce::Array<juce::var> rates;
+            for (const auto& rate : result.rates)
+            {
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty("sampleRate", rate.sampleRate);
+                entry->setProperty("reportedBytes", static_cast<juce::int64>(rate.footprint.getTotalBytes()));
+                entry->setProperty("measuredBytes", rate.measuredBytes);
+
+                auto* components = new juce::DynamicObject();
+                for (const auto& component : rate.footprint.getComponents())
+                    components->setProperty(component.name, component.isTracked ? juce::var(static_cast<juce::int64>(component.bytes))
+                                                                                : juce::var("untracked"));
+                entry->setProperty("components", juce::var(components));
+
+                rates.add(juce::var(entry));
+            }
+            object->setProperty("rates", rates);
+
+            return juce::var(object);
+        }
+    }
+
+    void runMemoryCommand(const juce::ArgumentList& args)
+    {
+        auto config = parseRunConfig(args);
+        if (! args.containsOption("--rates"))   config.sampleRates = { 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 };
+        if (! args.containsOption("--blocks"))  config.blockSizes = { 512 };
+
+        const int instances = args.containsOption("--instances") ? juce::jmax(1, args.getValueForOption("--instances").getIntValue()) : 1;
+        const int blockSize = config.blockSizes.getFirst();
+
+        RealtimeTracker::initialise();
+
+        std::cout << "Heap per instance after prepareToPlay at " << blockSize << "-sample blocks" << std::endl << std::endl;
+
+        std::vector<EffectFootprints> results;
+        juce::Array<juce::var> jsonResults;
+
+        for (const auto& effect : config.effects)
+        {
+            EffectFootprints result;
+            result.effect = effect;
+
+            for (auto sampleRate : config.sampleRates)
+                result.rates.push_back(measureFootprint(effect, sampleRate, blockSize));
+
+            printEffect(result, instances);
+            jsonResults.add(toJson(result));
+            results.push_back(std::move(result));
+        }
+
+        // The biggest single components at the highest rate, where they are worst
+        struct LargestComponent
+        {
+            juce::String effect, name;
+            size_t bytes = 0;
+        };
+
+        std::vector<LargestComponent> largest;
+        juce::int64 sessionTotal = 0;
+
+        for (const auto& result : results)
+        {
+            const auto& highest = result.rates.back();
+            sessionTotal += juce::jmax(highest.measuredBytes, static_cast<juce::int64>(highest.footprint.getTotalBytes()));
+
+            for (const auto& component : highest.footprint.getComponents())
+                if (component.isTracked && component.name != "processor object")
+                    largest.push_back({ result.effect, component.name, component.bytes });
+        }
+
+        std::sort(largest.begin(), largest.end(), [](const auto& a, const auto& b) { return a.bytes > b.bytes; });
+
+        if (! results.empty())
+        {
+            std::cout << "Largest components at " << juce::String(config.sampleRates.getLast() / 1000.0, 1) << " kHz" << std::endl;
+
+            for (size_t i = 0; i < largest.size() && i < static_cast<size_t>(numLargestComponents); ++i)
+                std::cout << "  " << padRight(largest[i].effect, 22) << padRight(largest[i].name, 28)
+                          << padLeft(HyperPrismMemory::formatBytes(largest[i].bytes), 12) << std::endl;
+
+            std::cout << std::endl << (instances > 1 ? juce::String(instances) + " instances" : juce::String("One instance"))
+                      << " of each listed effect: "
+                      << HyperPrismMemory::formatBytes(static_cast<size_t>(sessionTotal) * static_cast<size_t>(instances)) << std::endl;
+        }
+
+        juce::Array<juce::var> jsonSuite;
+
+        if (args.containsOption("--suite") && ! results.empty())
+        {
+            const auto sampleRate = config.sampleRates.getLast();
+
+            // One throwaway instance first, so process-wide statics (the registry,
+            // shared threads) are not charged to the first effect measured
+            measureSuiteHeap(results.front().effect, sampleRate, blockSize);
+
+            std::cout << std::endl << "Suite instance against a standalone instance at "
+                      << juce::String(sampleRate / 1000.0, 1) << " kHz" << std::endl
+                      << "  " << padRight("active effect", 22) << padLeft("standalone", 13)
+                      << padLeft("Suite", 13) << padLeft("overhead", 13) << std::endl;
+
+            for (const auto& result : results)
+            {
+                const auto standalone = result.rates.back().measuredBytes;
+                const auto suite = measureSuiteHeap(result.effect, sampleRate, blockSize);
+
+                std::cout << "  " << padRight(result.effect, 22)
+                          << padLeft(HyperPrismMemory::formatBytes(static_cast<size_t>(standalone)), 13)
+                          << padLeft(HyperPrismMemory::formatBytes(static_cast<size_t>(suite)), 13)
+                          << padLeft(formatSigned(suite - standalone), 13) << std::endl;
+
+                auto* object = new juce::DynamicObject();
+                object->setProperty("effect", result.effect);
+                object->setProperty("sampleRate", sampleRate);
+                object->setProperty("standaloneBytes", standalone);
+                object->setProperty("suiteBytes", suite);
+                jsonSuite.add(juce::var(object));
+            }
+        }
+
+        if (args.containsOption("--save"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("blockSize", blockSize);
+            root->setProperty("results", jsonResults);
+
+            if (! jsonSuite.isEmpty())
+                root->setProperty("suite", jsonSuite);
+
+            auto file = args.getFileForOption("--save");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved memory report to " << file.getFullPathName() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+//==============================================================================
+// HyperPrism Reimagined - Memory Footprint Report
+// Prints the heap each effect holds after prepareToPlay, broken down by the
+// components the processor reports, across sample rates
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --memory [--effects=..] [--rates=44100,48000,88200,96000,192000] [--blocks=512]
+    //          [--instances=n] [--suite] [--save=file.json]
+    void runMemoryCommand(const juce::ArgumentList& args);
+}
@@ -0,0 +1,120 @@
+//==============================================================================
+// HyperPrism Reimagined - Randomised Parameter Automation Implementation
+//==============================================================================
+
+#include "ParameterAutomation.h"
+
+namespace HyperPrismBench
+{
+    ParameterAutomation::ParameterAutomation(juce::AudioProcessor& p, juce::int64 seed)
+        : processor(p), random(seed)
+    {
+        rebuildLanes();
+    }
+
+    void ParameterAutomation::setIncludeBypass(bool shouldInclude)
+    {
+        includeBypass = shouldInclude;
+        rebuildLanes();
+    }
+
+    void ParameterAutomation::rebuildLanes()
+    {
+        lanes.clear();
+
+        for (auto* parameter : processor.getParameters())
+        {
+            if (! includeBypass && parameter->getName(64).containsIgnoreCase("bypass"))
+                continue;
+
+            // Hosts cannot automate these either
+            if (! parameter->isAutomatable())
+                continue;
+
+            Lane lane;
+            lane.parameter = parameter;
+            lane.sweeps = random.nextBool();
+            lane.phase = random.nextDouble();
+            lane.periodSeconds = 0.1 + random.nextDouble() * 2.0;
+            lanes.push_back(lane);
+        }
+    }
+
+    void ParameterAutomation::advance(int blockSize, double sampleRate)
+    {
+        const double blockSeconds = blockSize / sampleRate;
+
+        for (auto& lane : lanes)
+        {
+            if (lane.sweeps)
+            {
+                // Triangle sweep across the whole normalised range
+                lane.phase = std::fmod(lane.phase + blockSeconds / lane.periodSeconds, 1.0);
+                const auto value = static_cast<float>(lane.phase < 0.5 ? lane.phase * 2.0 : 2.0 - lane.phase * 2.0);
+                setFromHost(*lane.parameter, value);
+            }
+            else if (random.nextFloat() < 0.05f)
+            {
+                setFromHost(*lane.parameter, random.nextFloat());
+            }
+        }
+    }
+
+    void ParameterAutomation::setFromHost(juce::AudioProcessorParameter& parameter, float normalisedValue)
+    {
+        parameter.setValue(juce::jlimit(0.0f, 1.0f, normalisedValue));
+        parameter.sendValueChangedMessageToListeners(parameter.getValue());
+    }
+
+    std::vector<float> ParameterAutomation::getSnapshot() const
+    {
+        std::vector<float> snapshot;
+        snapshot.reserve(lanes.size());
+
+        for (const auto& lane : lanes)
+            snapshot.push_back(lane.parameter->getValue());
+
+        return snapshot;
+    }
+
+    juce::String ParameterAutomation::describeSnapshot(const std::vector<float>& snapshot) const
+    {
+        juce::StringArray parts;
+
+        for (size_t i = 0; i < lanes.size() && i < snapshot.size(); ++i)
+        {
+            auto* parameter = lanes[i].parameter;
+            parts.add(parameter->getName(32) + "=" + parameter->getText(snapshot[i], 32));
+        }
+
+        return parts.joinIntoString(", ");
+    }
+
+    juce::var ParameterAutomation::snapshotToJson(const std::vector<float>& snapshot) const
+    {
+        auto* object = new juce::DynamicObject();
+
+        for (size_t i = 0; i < lanes.size() && i < snapshot.size(); ++i)
+            object->setProperty(lanes[i].parameter->getName(64), snapshot[i]);
+
+        return juce::var(object);
+    }
+
+    juce::String ParameterAutomation::describeChanges(const std::vector<float>& before,
+                                                      const std::vector<float>& after) const
+    {
+        juce::StringArray parts;
+
+        for (size_t i = 0; i < lanes.size() && i < before.size() && i < after.size(); ++i)
+        {
+            if (juce::exactlyEqual(before[i], after[i]))
+                continue;
+
+            auto* parameter = lanes[i].parameter;
+            parts.add(parameter->getName(32) + ": " + parameter->getText(before[i], 32)
+                      + " -> " + parameter->getText(after[i], 32));
+        }
+
+        return parts.isEmpty() ? juce::String("(no change)") : parts.joinIntoString(", ");
+    }
+}
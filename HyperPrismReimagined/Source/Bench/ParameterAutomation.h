@@ -0,0 +1,54 @@
+//==============================================================================
+// HyperPrism Reimagined - Randomised Parameter Automation
+// Drives a processor's parameters between blocks the way a host would
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismBench
+{
+    class ParameterAutomation
+    {
+    public:
+        ParameterAutomation(juce::AudioProcessor& processor, juce::int64 seed);
+
+        // Bypass parameters are left alone by default so the DSP path is exercised
+        void setIncludeBypass(bool shouldInclude);
+
+        // Moves parameters for the next block: some sweep continuously, others jump
+        void advance(int blockSize, double sampleRate);
+
+        // Applies a normalised value exactly as a plugin wrapper does for host automation
+        static void setFromHost(juce::AudioProcessorParameter& parameter, float normalisedValue);
+
+        // Current normalised values, one per automated parameter
+        std::vector<float> getSnapshot() const;
+
+        // "Name=text, Name=text" using each parameter's own value-to-text conversion
+        juce::String describeSnapshot(const std::vector<float>& snapshot) const;
+        juce::var snapshotToJson(const std::vector<float>& snapshot) const;
+
+        // "Name: old -> new" for every parameter that differs between two snapshots
+        juce::String describeChanges(const std::vector<float>& before, const std::vector<float>& after) const;
+
+        int getNumParameters() const { return static_cast<int>(lanes.size()); }
+
+    private:
+        struct Lane
+        {
+            juce::AudioProcessorParameter* parameter = nullptr;
+            bool sweeps = false;
+            double phase = 0.0;
+            double periodSeconds = 1.0;
+        };
+
+        void rebuildLanes();
+
+        juce::AudioProcessor& processor;
+        juce::Random random;
+        bool includeBypass = false;
+        std::vector<Lane> lanes;
+    };
+}
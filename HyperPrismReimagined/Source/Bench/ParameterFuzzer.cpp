@@ -0,0 +1,438 @@
+//==============================================================================
+// HyperPrism Reimagined - Parameter Automation Fuzzer Implementation
+//==============================================================================
+
+#include "ParameterFuzzer.h"
+#include "ParameterAutomation.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        static constexpr float overloadLevel = 16.0f;           // +24 dBFS
+        static constexpr float runawayLevel = 0.5f;             // RMS still above -6 dBFS after the silent tail
+        static constexpr double silentTailSeconds = 2.0;
+        static constexpr double denormalSlowdown = 4.0;         // Silent blocks this much slower than active ones
+
+        const double fuzzSampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 };
+        const int fuzzBlockSizes[] = { 32, 64, 128, 256, 512, 1024 };
+
+        enum class InputMode
+        {
+            noise, sine, sweep, impulse, silence, hot, tiny, dc
+        };
+
+        struct Finding
+        {
+            juce::String type;
+            juce::String effect;
+            juce::int64 caseSeed = 0;
+            int block = -1;
+            juce::String detail;
+            bool isFailure = true;
+        };
+
+        struct CaseSettings
+        {
+            int blocksPerCase = 400;
+            bool allowOversizedBlocks = true;
+            bool budgetIsFailure = false;
+            bool verbose = false;
+        };
+
+        //==============================================================================
+        // Carries every setting that changes what a case runs or what counts as a
+        // failure; --verbose only changes what is printed
+        juce::String makeReproduceLine(const juce::String& effect, juce::int64 caseSeed, const CaseSettings& settings)
+        {
+            auto line = "HyperPrismBench --fuzz --effects=" + effect + " --case-seed=" + juce::String(caseSeed)
+                        + " --blocks-per-case=" + juce::String(settings.blocksPerCase);
+
+            if (! settings.allowOversizedBlocks)
+                line << " --no-oversize";
+
+            if (settings.budgetIsFailure)
+                line << " --budget";
+
+            return line;
+        }
+
+        // Printed by the crash handler, so a case that brings the process down can
+        // still be re-run on its own
+        char currentCaseLine[256] = {};
+
+        void setCurrentCase(const juce::String& effect, juce::int64 caseSeed, const CaseSettings& settings)
+        {
+            makeReproduceLine(effect, caseSeed, settings).copyToUTF8(currentCaseLine, sizeof(currentCaseLine));
+        }
+
+        void printCurrentCaseOnCrash(void*)
+        {
+            std::cerr << std::endl << "Crashed while fuzzing; reproduce with:" << std::endl
+                      << "  " << currentCaseLine << std::endl;
+        }
+
+        //==============================================================================
+        void fillInput(juce::AudioBuffer<float>& buffer, InputMode mode, StimulusGenerator& generator, juce::Random& random)
+        {
+            switch (mode)
+            {
+                case InputMode::noise:
+                case InputMode::sine:
+                case InputMode::sweep:
+                case InputMode::impulse:
+                    generator.fill(buffer);
+                    break;
+
+                case InputMode::silence:
+                    buffer.clear();
+                    break;
+
+                case InputMode::hot:
+                    generator.fill(buffer);
+                    buffer.applyGain(8.0f);     // +18 dB over the stimulus level
+                    break;
+
+                case InputMode::tiny:
+                    // Right at the bottom of the normal range, where most recursions go subnormal
+                    generator.fill(buffer);
+                    buffer.applyGain(1.0e-37f);
+                    break;
+
+                case InputMode::dc:
+                    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                        juce::FloatVectorOperations::fill(buffer.getWritePointer(channel), random.nextBool() ? 1.0f : -1.0f,
+                                                          buffer.getNumSamples());
+                    break;
+            }
+        }
+
+        StimulusGenerator& getGeneratorFor(InputMode mode, std::array<StimulusGenerator, 4>& generators)
+        {
+            switch (mode)
+            {
+                case InputMode::sine:       return generators[1];
+                case InputMode::sweep:      return generators[2];
+                case InputMode::impulse:    return generators[3];
+                case InputMode::noise:
+                case InputMode::silence:
+                case InputMode::hot:
+                case InputMode::tiny:
+                case InputMode::dc:
+                default:                    return generators[0];
+            }
+        }
+
+        struct BlockCheck
+        {
+            int numNonFinite = 0;
+            int firstNonFinite = -1;
+            int numSubnormal = 0;
+            float peak = 0.0f;
+            double sumOfSquares = 0.0;
+        };
+
+        BlockCheck checkOutput(const juce::AudioBuffer<float>& buffer)
+        {
+            BlockCheck check;
+
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                const auto* data = buffer.getReadPointer(channel);
+
+                for (int i = 0; i < buffer.getNumSamples(); ++i)
+                {
+                    const auto sample = data[i];
+
+                    if (! std::isfinite(sample))
+                    {
+                        if (check.numNonFinite++ == 0)
+                            check.firstNonFinite = i;
+                        continue;
+                    }
+
+                    if (std::fpclassify(sample) == FP_SUBNORMAL)
+                        ++check.numSubnormal;
+
+                    check.peak = juce::jmax(check.peak, std::abs(sample));
+                    check.sumOfSquares += static_cast<double>(sample) * sample;
+                }
+            }
+
+            return check;
+        }
+
+        double getRms(const BlockCheck& check, const juce::AudioBuffer<float>& buffer)
+        {
+            const auto count = buffer.getNumChannels() * buffer.getNumSamples();
+            return count > 0 ? std::sqrt(check.sumOfSquares / count) : 0.0;
+        }
+
+        double median(std::vector<double> values)
+        {
+            if (values.empty())
+                return 0.0;
+
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        }
+
+        //==============================================================================
+        // One fuzz case: everything (sample rate, block sizes, automation, input) is
+        // derived from caseSeed, so re-running the same seed repeats the case exactly
+        void runCase(const juce::String& effect, juce::int64 caseSeed, const CaseSettings& settings,
+                     std::vector<Finding>& findings)
+        {
+            juce::Random random(caseSeed);
+
+            const auto sampleRate = fuzzSampleRates[random.nextInt(juce::numElementsInArray(fuzzSampleRates))];
+            const auto maxBlockSize = fuzzBlockSizes[random.nextInt(juce::numElementsInArray(fuzzBlockSizes))];
+
+            auto processor = createEffectOrFail(effect);
+            prepareProcessor(*processor, sampleRate, maxBlockSize);
+
+            ParameterAutomation automation(*processor, caseSeed);
+
+            juce::Array<juce::AudioProcessorParameter*> parameters;
+            for (auto* parameter : processor->getParameters())
+                if (! parameter->getName(64).containsIgnoreCase("bypass") && parameter->isAutomatable())
+                    parameters.add(parameter);
+
+            std::array<StimulusGenerator, 4> generators;
+            generators[0].prepare(Stimulus::noise, sampleRate, caseSeed);
+            generators[1].prepare(Stimulus::sine, sampleRate, caseSeed);
+            generators[2].prepare(Stimulus::sweep, sampleRate, caseSeed);
+            generators[3].prepare(Stimulus::impulse, sampleRate, caseSeed);
+
+            // Room for oversized blocks, allocated once
+            juce::AudioBuffer<float> buffer(2, maxBlockSize * 4);
+            juce::MidiBuffer midi;
+
+            auto inputMode = InputMode::noise;
+            std::vector<double> activeNanosecondsPerSample, silentNanosecondsPerSample;
+            int numOverBudget = 0;
+            double worstBudgetRatio = 0.0;
+            int worstBudgetBlock = -1;
+            bool hasReportedOverload = false, hasReportedDenormals = false;
+
+            auto addFinding = [&](const juce::String& type, int block, const juce::String& detail, bool isFailure)
+            {
+                findings.push_back({ type, effect, caseSeed, block, detail, isFailure });
+
+                if (settings.verbose || isFailure)
+                    std::cout << "  " << (isFailure ? "FAIL " : "warn ") << type << " in " << effect << " at block " << block
+                              << " (" << juce::roundToInt(sampleRate) << " Hz, max block " << maxBlockSize << "): " << detail
+                              << std::endl << "       reproduce: " << makeReproduceLine(effect, caseSeed, settings) << std::endl;
+            };
+
+            // Runs one block and checks it; returns false once the output is poisoned
+            auto processAndCheck = [&](int block, int numSamples, bool isSilentTail, double& rmsOut)
+            {
+                buffer.setSize(2, numSamples, false, false, true);
+
+                if (isSilentTail)
+                    buffer.clear();
+                else
+                    fillInput(buffer, inputMode, getGeneratorFor(inputMode, generators), random);
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                processor->processBlock(buffer, midi);
+                const auto elapsed = ticksToNanoseconds(juce::Time::getHighResolutionTicks() - start);
+
+                const auto check = checkOutput(buffer);
+                rmsOut = getRms(check, buffer);
+
+                if (check.numNonFinite > 0)
+                {
+                    addFinding("nan/inf", block, juce::String(check.numNonFinite) + " non-finite samples, first at sample "
+                                                 + juce::String(check.firstNonFinite) + "; block of " + juce::String(numSamples)
+                                                 + "; parameters " + automation.describeSnapshot(automation.getSnapshot()), true);
+                    return false;
+                }
+
+                if (check.peak > overloadLevel && ! hasReportedOverload)
+                {
+                    hasReportedOverload = true;
+                    addFinding("overload", block, "peak " + juce::String(juce::Decibels::gainToDecibels(check.peak), 1)
+                                                  + " dBFS; parameters " + automation.describeSnapshot(automation.getSnapshot()), true);
+                }
+
+                if (check.numSubnormal > juce::jmax(4, numSamples / 4) && ! hasReportedDenormals)
+                {
+                    hasReportedDenormals = true;
+                    addFinding("denormals", block, juce::String(check.numSubnormal) + " subnormal output samples in a block of "
+                                                   + juce::String(numSamples), true);
+                }
+
+                const double budget = 1.0e9 * numSamples / sampleRate;
+                if (elapsed > budget)
+                {
+                    ++numOverBudget;
+                    if (elapsed / budget > worstBudgetRatio)
+                    {
+                        worstBudgetRatio = elapsed / budget;
+                        worstBudgetBlock = block;
+                    }
+                }
+
+                if (numSamples >= 16)
+                    (isSilentTail || inputMode == InputMode::silence || inputMode == InputMode::tiny
+                        ? silentNanosecondsPerSample : activeNanosecondsPerSample).push_back(elapsed / numSamples);
+
+                return true;
+            };
+
+            int block = 0;
+            double rms = 0.0;
+
+            for (; block < settings.blocksPerCase; ++block)
+            {
+                // Block size: mostly within the prepared maximum, sometimes 1, sometimes oversized
+                const auto roll = random.nextFloat();
+                int numSamples = 1 + random.nextInt(maxBlockSize);
+
+                if (roll < 0.1f)
+                    numSamples = 1;
+                else if (roll < 0.2f && settings.allowOversizedBlocks)
+                    numSamples = maxBlockSize * (2 + random.nextInt(3)) - random.nextInt(maxBlockSize);
+
+                // Input changes character every few dozen blocks
+                if (random.nextFloat() < 0.03f)
+                    inputMode = static_cast<InputMode>(random.nextInt(8));
+
+                // Host-style sweeps and jumps, plus occasional slams to the ends of the range
+                automation.advance(numSamples, sampleRate);
+
+                if (! parameters.isEmpty() && random.nextFloat() < 0.1f)
+                {
+                    auto* parameter = parameters[random.nextInt(parameters.size())];
+                    const float extremes[] = { 0.0f, 1.0f, 1.0e-6f, 1.0f - 1.0e-6f };
+                    ParameterAutomation::setFromHost(*parameter, extremes[random.nextInt(4)]);
+                }
+
+                if (! processAndCheck(block, numSamples, false, rms))
+                    return;
+            }
+
+            // Silent tail with parameters frozen: feedback paths should decay, not grow
+            const int tailBlocks = juce::jmax(1, static_cast<int>(silentTailSeconds * sampleRate / maxBlockSize));
+            double firstTailRms = 0.0;
+
+            for (int tailBlock = 0; tailBlock < tailBlocks; ++tailBlock, ++block)
+            {
+                if (! processAndCheck(block, maxBlockSize, true, rms))
+                    return;
+
+                if (tailBlock == 0)
+                    firstTailRms = rms;
+            }
+
+            if (rms > runawayLevel && rms >= firstTailRms)
+            {
+                addFinding("runaway feedback", block, "RMS " + juce::String(juce::Decibels::gainToDecibels(static_cast<float>(rms)), 1)
+                                                      + " dBFS after " + juce::String(silentTailSeconds, 1)
+                                                      + " s of silence (was " + juce::String(juce::Decibels::gainToDecibels(static_cast<float>(firstTailRms)), 1)
+                                                      + " dBFS); parameters " + automation.describeSnapshot(automation.getSnapshot()), true);
+            }
+
+            // Denormals the guard missed show up as silence being far slower than signal
+            const auto activeCost = median(activeNanosecondsPerSample);
+            const auto silentCost = median(silentNanosecondsPerSample);
+
+            if (activeCost > 0.0 && silentCost > activeCost * denormalSlowdown)
+            {
+                addFinding("denormal slowdown", block, "silent/tiny input costs " + juce::String(silentCost / activeCost, 1)
+                                                       + "x as much per sample as signal", true);
+            }
+
+            if (numOverBudget > 0)
+            {
+                addFinding("over budget", worstBudgetBlock, juce::String(numOverBudget) + " blocks over their real-time budget, worst "
+                                                            + juce::String(juce::roundToInt(worstBudgetRatio * 100.0)) + "%",
+                           settings.budgetIsFailure);
+            }
+
+            processor->releaseResources();
+        }
+    }
+
+    void runFuzzCommand(const juce::ArgumentList& args)
+    {
+        const auto config = parseRunConfig(args);
+
+        CaseSettings settings;
+        settings.blocksPerCase = args.containsOption("--blocks-per-case") ? juce::jmax(1, args.getValueForOption("--blocks-per-case").getIntValue()) : 400;
+        settings.allowOversizedBlocks = ! args.containsOption("--no-oversize");
+        settings.budgetIsFailure = args.containsOption("--budget");
+        settings.verbose = args.containsOption("--verbose");
+
+        const auto masterSeed = args.containsOption("--seed") ? args.getValueForOption("--seed").getLargeIntValue()
+                                                              : juce::Time::currentTimeMillis();
+        const int iterations = args.containsOption("--iterations") ? juce::jmax(1, args.getValueForOption("--iterations").getIntValue()) : 20;
+        const bool singleCase = args.containsOption("--case-seed");
+
+        juce::SystemStats::setApplicationCrashHandler(printCurrentCaseOnCrash);
+
+        if (! singleCase)
+            std::cout << "Fuzzing with --seed=" << masterSeed << ", " << iterations << " cases per effect" << std::endl;
+
+        std::vector<Finding> findings;
+        juce::Random caseSeeds(masterSeed);
+
+        for (const auto& effect : config.effects)
+        {
+            const auto numBefore = findings.size();
+
+            for (int iteration = 0; iteration < (singleCase ? 1 : iterations); ++iteration)
+            {
+                const auto caseSeed = singleCase ? args.getValueForOption("--case-seed").getLargeIntValue()
+                                                 : caseSeeds.nextInt64();
+
+                setCurrentCase(effect, caseSeed, settings);
+                runCase(effect, caseSeed, settings, findings);
+            }
+
+            int numFailures = 0;
+            for (auto i = numBefore; i < findings.size(); ++i)
+                numFailures += findings[i].isFailure ? 1 : 0;
+
+            std::cout << padRight(effect, 22) << (numFailures == 0 ? "ok" : juce::String(numFailures) + " failing cases") << std::endl;
+        }
+
+        int numFailures = 0;
+        juce::Array<juce::var> jsonFindings;
+
+        for (const auto& finding : findings)
+        {
+            numFailures += finding.isFailure ? 1 : 0;
+
+            auto* object = new juce::DynamicObject();
+            object->setProperty("type", finding.type);
+            object->setProperty("effect", finding.effect);
+            object->setProperty("caseSeed", finding.caseSeed);
+            object->setProperty("block", finding.block);
+            object->setProperty("detail", finding.detail);
+            object->setProperty("failure", finding.isFailure);
+            object->setProperty("reproduce", makeReproduceLine(finding.effect, finding.caseSeed, settings));
+            jsonFindings.add(juce::var(object));
+        }
+
+        if (args.containsOption("--report"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("seed", masterSeed);
+            root->setProperty("iterations", iterations);
+            root->setProperty("blocksPerCase", settings.blocksPerCase);
+            root->setProperty("oversizedBlocks", settings.allowOversizedBlocks);
+            root->setProperty("budgetIsFailure", settings.budgetIsFailure);
+            root->setProperty("findings", jsonFindings);
+
+            auto file = args.getFileForOption("--report");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved fuzz report to " << file.getFullPathName() << std::endl;
+        }
+
+        if (numFailures > 0)
+            juce::ConsoleApplication::fail(juce::String(numFailures) + " fuzz failures", 5);
+    }
+}
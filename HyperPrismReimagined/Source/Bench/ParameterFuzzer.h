@@ -0,0 +1,17 @@
+//==============================================================================
+// HyperPrism Reimagined - Parameter Automation Fuzzer
+// Hammers every effect with random parameter jumps, sweeps and extremes and
+// irregular block sizes, and reports NaN/Inf output, denormal storms, runaway
+// feedback and over-budget blocks with a seed that reproduces each case
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --fuzz [--effects=..] [--seed=n] [--iterations=20] [--blocks-per-case=400]
+    //        [--case-seed=n] [--no-oversize] [--budget] [--report=file.json] [--verbose]
+    void runFuzzCommand(const juce::ArgumentList& args);
+}
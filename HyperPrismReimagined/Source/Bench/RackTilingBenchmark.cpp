@@ -0,0 +1,128 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Tiling Benchmark Implementation
+//==============================================================================
+
+#include "RackTilingBenchmark.h"
+#include "ThroughputBenchmark.h"
+#include "../Rack/RackProcessor.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        // The effects the Rack fuses into tiled stages, in registry order
+        juce::StringArray getLightweightEffects()
+        {
+            juce::StringArray effects;
+            for (const auto& effect : HyperPrismRegistry::getAllEffects())
+                if (effect.isLightweightStereo)
+                    effects.add(effect.name);
+
+            return effects;
+        }
+
+        ThroughputResult measureRack(const juce::StringArray& chain, double sampleRate, int blockSize,
+                                     double seconds, Stimulus stimulus, bool tiled)
+        {
+            RackProcessor rack;
+            rack.setChain(chain);
+            rack.setNumWorkerThreads(0);
+            rack.setMinTiledBlockSize(tiled ? 0 : std::numeric_limits<int>::max());
+            prepareProcessor(rack, sampleRate, blockSize);
+
+            auto result = measureThroughput(rack, tiled ? "tiled" : "serial", sampleRate, blockSize, seconds, stimulus);
+            rack.releaseResources();
+            return result;
+        }
+    }
+
+    void runRackTilingCommand(const juce::ArgumentList& args)
+    {
+        auto config = parseRunConfig(args);
+
+        if (! args.containsOption("--effects"))
+            config.effects = getLightweightEffects();
+
+        if (! args.containsOption("--rates"))
+            config.sampleRates = { 48000.0 };
+
+        if (! args.containsOption("--blocks"))
+            config.blockSizes = { 64, 256, 512, 1024, 2048, 4096, 8192, 16384, 65536 };
+
+        config.blockSizes.sort();
+
+        for (const auto& effect : config.effects)
+            if (auto* info = HyperPrismRegistry::findEffect(effect); info == nullptr || ! info->isLightweightStereo)
+                juce::ConsoleApplication::fail(effect + " is not one of the lightweight effects the Rack tiles: "
+                                               + getLightweightEffects().joinIntoString(","));
+
+        if (config.effects.size() < 2 || config.effects.size() > RackProcessor::maxSlots)
+            juce::ConsoleApplication::fail("A tiled stage needs 2 to " + juce::String(RackProcessor::maxSlots) + " effects");
+
+        std::cout << "Chain: " << config.effects.joinIntoString(" > ") << "; " << RackProcessor::tileSize
+                  << "-sample tiles, used from " << RackProcessor::defaultMinTiledBlockSize << "-sample blocks"
+                  << std::endl << std::endl;
+
+        std::cout << padLeft("Rate", 8) << padLeft("Block", 8) << padLeft("Serial ns", 12)
+                  << padLeft("Tiled ns", 12) << padLeft("Speedup", 10) << "  Rack uses" << std::endl;
+
+        juce::Array<juce::var> rows;
+
+        for (auto sampleRate : config.sampleRates)
+        {
+            // Smallest block from which tiling won at every larger size measured
+            int tilingPaysFrom = -1;
+
+            for (auto blockSize : config.blockSizes)
+            {
+                const auto serial = measureRack(config.effects, sampleRate, blockSize, config.secondsPerRun, config.stimulus, false);
+                const auto tiled = measureRack(config.effects, sampleRate, blockSize, config.secondsPerRun, config.stimulus, true);
+
+                const auto speedup = serial.nanosecondsPerSample / juce::jmax(1.0e-9, tiled.nanosecondsPerSample);
+                const bool rackTiles = blockSize >= RackProcessor::defaultMinTiledBlockSize;
+
+                if (speedup > 1.0 && tilingPaysFrom < 0)
+                    tilingPaysFrom = blockSize;
+                else if (speedup <= 1.0)
+                    tilingPaysFrom = -1;
+
+                std::cout << padLeft(juce::String(juce::roundToInt(sampleRate)), 8)
+                          << padLeft(juce::String(blockSize), 8)
+                          << padLeft(juce::String(serial.nanosecondsPerSample, 2), 12)
+                          << padLeft(juce::String(tiled.nanosecondsPerSample, 2), 12)
+                          << padLeft(juce::String(speedup, 2) + "x", 10)
+                          << (rackTiles ? "  tiled" : "  serial") << std::endl;
+
+                auto* object = new juce::DynamicObject();
+                object->setProperty("sampleRate", sampleRate);
+                object->setProperty("blockSize", blockSize);
+                object->setProperty("serialNsPerSample", serial.nanosecondsPerSample);
+                object->setProperty("tiledNsPerSample", tiled.nanosecondsPerSample);
+                object->setProperty("speedup", speedup);
+                object->setProperty("rackTiles", rackTiles);
+                rows.add(juce::var(object));
+            }
+
+            std::cout << std::endl << "At " << juce::roundToInt(sampleRate) << " Hz tiling "
+                      << (tilingPaysFrom > 0 ? "pays off from " + juce::String(tilingPaysFrom) + "-sample blocks"
+                                             : juce::String("did not pay off at the largest block"))
+                      << " (Rack threshold " << RackProcessor::defaultMinTiledBlockSize << ")" << std::endl << std::endl;
+        }
+
+        if (args.containsOption("--save"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("version", 1);
+            root->setProperty("created", juce::Time::getCurrentTime().toISO8601(true));
+            root->setProperty("cpu", juce::SystemStats::getCpuModel());
+            root->setProperty("chain", config.effects.joinIntoString(","));
+            root->setProperty("tileSize", RackProcessor::tileSize);
+            root->setProperty("minTiledBlockSize", RackProcessor::defaultMinTiledBlockSize);
+            root->setProperty("results", rows);
+
+            auto file = args.getFileForOption("--save");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved results to " << file.getFullPathName() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Tiling Benchmark
+// Times a Rack run of lightweight stereo effects processed tile by tile
+// against the same run processed slot by slot, per block size
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --rack-tiling [--effects=Pan,AutoPan,QuasiStereo,MSMatrix] [--rates=48000]
+    //               [--blocks=64,..,65536] [--seconds=2] [--signal=type] [--save=file.json]
+    void runRackTilingCommand(const juce::ArgumentList& args);
+}
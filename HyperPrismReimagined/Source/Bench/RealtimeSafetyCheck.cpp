@@ -0,0 +1,545 @@
+//==============================================================================
+// HyperPrism Reimagined - Real-Time Safety Checker Implementation
+//==============================================================================
+
+#include "RealtimeSafetyCheck.h"
+#include "ParameterAutomation.h"
+
+#include <new>
+#include <cstdlib>
+
+#if JUCE_LINUX || JUCE_MAC || JUCE_BSD
+ #include <execinfo.h>
+ #include <dlfcn.h>
+ #include <cxxabi.h>
+ #include <pthread.h>
+#endif
+
+#if JUCE_LINUX || JUCE_BSD || JUCE_WINDOWS
+ #include <malloc.h>
+#elif JUCE_MAC
+ #include <malloc/malloc.h>
+#endif
+
+// On Linux malloc/calloc/realloc/free are replaced as well, so juce::HeapBlock
+// (and therefore AudioBuffer::setSize) is caught, not just operator new.
+#define HYPERPRISM_HOOK_MALLOC JUCE_LINUX
+
+#if HYPERPRISM_HOOK_MALLOC
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void  __libc_free(void*);
+}
+#endif
+
+namespace HyperPrismBench
+{
+namespace RealtimeTracker
+{
+    namespace
+    {
+        static constexpr int maxEvents = 4096;
+
+        Event events[maxEvents];
+        std::atomic<int> numEvents { 0 };
+        std::atomic<int> numDropped { 0 };
+        std::atomic<juce::int64> liveHeapBytes { 0 };
+
+        thread_local bool isArmed = false;
+        thread_local bool isInsideHook = false;
+
+        int captureStack(void** frames, int maxNumFrames)
+        {
+           #if JUCE_LINUX || JUCE_MAC || JUCE_BSD
+            return backtrace(frames, maxNumFrames);
+           #else
+            juce::ignoreUnused(frames, maxNumFrames);
+            return 0;
+           #endif
+        }
+
+        juce::int64 getAllocationSize(void* pointer, bool isAligned)
+        {
+           #if JUCE_LINUX || JUCE_BSD
+            juce::ignoreUnused(isAligned);
+            return static_cast<juce::int64>(malloc_usable_size(pointer));
+           #elif JUCE_MAC
+            juce::ignoreUnused(isAligned);
+            return static_cast<juce::int64>(malloc_size(pointer));
+           #elif JUCE_WINDOWS
+            return isAligned ? 0 : static_cast<juce::int64>(_msize(pointer));
+           #else
+            juce::ignoreUnused(pointer, isAligned);
+            return 0;
+           #endif
+        }
+
+        // Called from the replaced functions: must not allocate or lock itself
+        void record(EventType type, size_t bytes)
+        {
+            if (! isArmed || isInsideHook)
+                return;
+
+            isInsideHook = true;
+
+            const int index = numEvents.fetch_add(1, std::memory_order_relaxed);
+
+            if (index < maxEvents)
+            {
+                auto& event = events[index];
+                event.type = type;
+                event.bytes = bytes;
+                event.numFrames = captureStack(event.frames, maxFrames);
+            }
+            else
+            {
+                numDropped.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            isInsideHook = false;
+        }
+    }
+
+    void initialise()
+    {
+        // The first backtrace() call may load the unwinder and allocate; get that out of the way
+        void* frames[4];
+        juce::ignoreUnused(captureStack(frames, 4));
+        numEvents = 0;
+        numDropped = 0;
+    }
+
+    bool canDetectLocks()
+    {
+       #if JUCE_LINUX
+        return true;
+       #else
+        return false;
+       #endif
+    }
+
+    void arm()      { isArmed = true; }
+    void disarm()   { isArmed = false; }
+
+    void drainEvents(std::vector<Event>& destination)
+    {
+        jassert (! isArmed);
+
+        const int count = juce::jmin(numEvents.load(), maxEvents);
+        destination.insert(destination.end(), events, events + count);
+        numEvents = 0;
+    }
+
+    int getNumDroppedEvents()
+    {
+        return numDropped.load();
+    }
+
+    juce::int64 getLiveHeapBytes()
+    {
+        return liveHeapBytes.load();
+    }
+
+    //==============================================================================
+    namespace
+    {
+        void onAllocate(void* pointer, size_t size, bool isAligned)
+        {
+            if (pointer == nullptr)
+                return;
+
+            liveHeapBytes.fetch_add(getAllocationSize(pointer, isAligned), std::memory_order_relaxed);
+            record(EventType::allocation, size);
+        }
+
+        void onFree(void* pointer, bool isAligned)
+        {
+            if (pointer == nullptr)
+                return;
+
+            liveHeapBytes.fetch_sub(getAllocationSize(pointer, isAligned), std::memory_order_relaxed);
+            record(EventType::deallocation, 0);
+        }
+
+        void* allocate(size_t size, bool throwOnFailure)
+        {
+            auto* pointer = std::malloc(size > 0 ? size : 1);
+
+           #if ! HYPERPRISM_HOOK_MALLOC
+            onAllocate(pointer, size, false);
+           #endif
+
+            if (pointer == nullptr && throwOnFailure)
+                throw std::bad_alloc();
+
+            return pointer;
+        }
+
+        void release(void* pointer)
+        {
+           #if ! HYPERPRISM_HOOK_MALLOC
+            onFree(pointer, false);
+           #endif
+
+            std::free(pointer);
+        }
+
+        // Aligned allocations bypass the malloc hooks, so they are always recorded here
+        void* allocateAligned(size_t size, size_t alignment, bool throwOnFailure)
+        {
+            void* pointer = nullptr;
+
+           #if JUCE_WINDOWS
+            pointer = _aligned_malloc(size > 0 ? size : 1, alignment);
+           #else
+            if (posix_memalign(&pointer, juce::jmax(alignment, sizeof(void*)), size > 0 ? size : 1) != 0)
+                pointer = nullptr;
+           #endif
+
+            onAllocate(pointer, size, true);
+
+            if (pointer == nullptr && throwOnFailure)
+                throw std::bad_alloc();
+
+            return pointer;
+        }
+
+        void releaseAligned(void* pointer)
+        {
+            onFree(pointer, true);
+
+           #if JUCE_WINDOWS
+            _aligned_free(pointer);
+           #elif HYPERPRISM_HOOK_MALLOC
+            __libc_free(pointer);
+           #else
+            std::free(pointer);
+           #endif
+        }
+
+        void recordMutexLock()
+        {
+            record(EventType::mutexLock, 0);
+        }
+    }
+}
+}
+
+//==============================================================================
+// Global allocation functions for the bench executable
+//==============================================================================
+namespace Tracker = HyperPrismBench::RealtimeTracker;
+
+void* operator new  (std::size_t size)                          { return Tracker::allocate(size, true); }
+void* operator new[](std::size_t size)                          { return Tracker::allocate(size, true); }
+void* operator new  (std::size_t size, const std::nothrow_t&) noexcept { return Tracker::allocate(size, false); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Tracker::allocate(size, false); }
+
+void operator delete  (void* pointer) noexcept                          { Tracker::release(pointer); }
+void operator delete[](void* pointer) noexcept                          { Tracker::release(pointer); }
+void operator delete  (void* pointer, std::size_t) noexcept             { Tracker::release(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept             { Tracker::release(pointer); }
+void operator delete  (void* pointer, const std::nothrow_t&) noexcept   { Tracker::release(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept   { Tracker::release(pointer); }
+
+void* operator new  (std::size_t size, std::align_val_t alignment)      { return Tracker::allocateAligned(size, static_cast<size_t>(alignment), true); }
+void* operator new[](std::size_t size, std::align_val_t alignment)      { return Tracker::allocateAligned(size, static_cast<size_t>(alignment), true); }
+void* operator new  (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return Tracker::allocateAligned(size, static_cast<size_t>(alignment), false); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return Tracker::allocateAligned(size, static_cast<size_t>(alignment), false); }
+
+void operator delete  (void* pointer, std::align_val_t) noexcept                         { Tracker::releaseAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept                         { Tracker::releaseAligned(pointer); }
+void operator delete  (void* pointer, std::size_t, std::align_val_t) noexcept            { Tracker::releaseAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept            { Tracker::releaseAligned(pointer); }
+void operator delete  (void* pointer, std::align_val_t, const std::nothrow_t&) noexcept  { Tracker::releaseAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept  { Tracker::releaseAligned(pointer); }
+
+#if HYPERPRISM_HOOK_MALLOC
+extern "C" void* malloc(size_t size) noexcept
+{
+    auto* pointer = __libc_malloc(size);
+    Tracker::onAllocate(pointer, size, false);
+    return pointer;
+}
+
+extern "C" void* calloc(size_t count, size_t size) noexcept
+{
+    auto* pointer = __libc_calloc(count, size);
+    Tracker::onAllocate(pointer, count * size, false);
+    return pointer;
+}
+
+extern "C" void* realloc(void* pointer, size_t size) noexcept
+{
+    Tracker::onFree(pointer, false);
+    auto* result = __libc_realloc(pointer, size);
+
+    // A failed realloc leaves the original block alive
+    Tracker::onAllocate(result != nullptr || size == 0 ? result : pointer, size, false);
+    return result;
+}
+
+extern "C" void free(void* pointer) noexcept
+{
+    Tracker::onFree(pointer, false);
+    __libc_free(pointer);
+}
+#endif
+
+#if JUCE_LINUX
+// Interposes libpthread's lock so std::mutex, juce::CriticalSection etc. are all seen
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    using LockFunction = int (*)(pthread_mutex_t*);
+    static std::atomic<LockFunction> realLock { nullptr };
+
+    auto lock = realLock.load(std::memory_order_acquire);
+
+    if (lock == nullptr)
+    {
+        lock = reinterpret_cast<LockFunction>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+        realLock.store(lock, std::memory_order_release);
+    }
+
+    Tracker::recordMutexLock();
+    return lock(mutex);
+}
+#endif
+
+//==============================================================================
+// Report
+//==============================================================================
+namespace HyperPrismBench
+{
+    namespace
+    {
+        juce::String symboliseFrame(void* address)
+        {
+           #if JUCE_LINUX || JUCE_MAC || JUCE_BSD
+            Dl_info info;
+
+            if (dladdr(address, &info) != 0 && info.dli_sname != nullptr)
+            {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                juce::String name(status == 0 && demangled != nullptr ? demangled : info.dli_sname);
+                std::free(demangled);
+                return name;
+            }
+           #endif
+
+            return juce::String::toHexString(reinterpret_cast<juce::pointer_sized_int>(address));
+        }
+
+        struct Site
+        {
+            RealtimeTracker::EventType type = RealtimeTracker::EventType::allocation;
+            juce::StringArray stack;     // Symbolised, tracker frames removed
+            juce::String location;       // First frame inside a HyperPrism processor
+            int count = 0;
+            size_t totalBytes = 0;
+            juce::String firstConfig;
+            juce::String firstSnapshot;
+        };
+
+        juce::String getTypeName(RealtimeTracker::EventType type)
+        {
+            switch (type)
+            {
+                case RealtimeTracker::EventType::allocation:   return "allocation";
+                case RealtimeTracker::EventType::deallocation: return "deallocation";
+                case RealtimeTracker::EventType::mutexLock:    return "mutex lock";
+            }
+
+            return {};
+        }
+
+        juce::StringArray symboliseStack(const RealtimeTracker::Event& event)
+        {
+            juce::StringArray stack;
+            bool skippingTracker = true;
+
+            for (int i = 0; i < event.numFrames; ++i)
+            {
+                auto name = symboliseFrame(event.frames[i]);
+
+                // Drop the hook frames at the top of every stack
+                if (skippingTracker && (name.contains("RealtimeTracker") || name.startsWith("operator new")
+                                         || name.startsWith("operator delete") || name == "pthread_mutex_lock"
+                                         || name == "malloc" || name == "calloc" || name == "realloc" || name == "free"))
+                    continue;
+
+                skippingTracker = false;
+                stack.add(name);
+
+                if (name.startsWith("HyperPrismBench::"))
+                    break;   // Everything below this is harness code
+            }
+
+            return stack;
+        }
+
+        juce::String findProcessorFrame(const juce::StringArray& stack)
+        {
+            for (const auto& frame : stack)
+                if (frame.contains("Processor::") && ! frame.startsWith("juce::"))
+                    return frame;
+
+            return stack.isEmpty() ? juce::String("<unknown>") : stack[0];
+        }
+    }
+
+    void runRealtimeSafetyCommand(const juce::ArgumentList& args)
+    {
+        RealtimeTracker::initialise();
+
+        auto config = parseRunConfig(args);
+        if (! args.containsOption("--seconds"))
+            config.secondsPerRun = 1.0;
+
+        const auto seed = args.containsOption("--seed") ? args.getValueForOption("--seed").getLargeIntValue()
+                                                        : static_cast<juce::int64>(1);
+        const bool verbose = args.containsOption("--verbose");
+
+        if (! RealtimeTracker::canDetectLocks())
+            std::cout << "Note: mutex interception is only available on Linux; checking allocations only" << std::endl;
+
+        juce::Array<juce::var> jsonEffects;
+        int totalViolations = 0;
+
+        for (const auto& effectName : config.effects)
+        {
+            std::map<juce::String, Site> sites;
+            juce::int64 blocksChecked = 0;
+
+            for (auto sampleRate : config.sampleRates)
+            {
+                for (auto blockSize : config.blockSizes)
+                {
+                    auto processor = createEffectOrFail(effectName);
+                    prepareProcessor(*processor, sampleRate, blockSize);
+
+                    ParameterAutomation automation(*processor, seed);
+                    StimulusGenerator generator;
+                    generator.prepare(config.stimulus, sampleRate);
+
+                    juce::AudioBuffer<float> buffer(2, blockSize);
+                    juce::MidiBuffer midi;
+                    std::vector<RealtimeTracker::Event> drained;
+                    drained.reserve(256);
+
+                    const auto configName = juce::String(juce::roundToInt(sampleRate)) + " Hz / " + juce::String(blockSize);
+                    const int numBlocks = juce::jmax(1, static_cast<int>(config.secondsPerRun * sampleRate / blockSize));
+
+                    for (int block = 0; block < numBlocks; ++block)
+                    {
+                        automation.advance(blockSize, sampleRate);
+                        generator.fill(buffer);
+
+                        {
+                            RealtimeTracker::ScopedArm armed;
+                            processor->processBlock(buffer, midi);
+                        }
+
+                        ++blocksChecked;
+                        drained.clear();
+                        RealtimeTracker::drainEvents(drained);
+
+                        for (const auto& event : drained)
+                        {
+                            auto stack = symboliseStack(event);
+                            auto key = getTypeName(event.type) + "|" + stack.joinIntoString("|");
+                            auto& site = sites[key];
+
+                            if (site.count == 0)
+                            {
+                                site.type = event.type;
+                                site.stack = stack;
+                                site.location = findProcessorFrame(stack);
+                                site.firstConfig = configName + ", block " + juce::String(block);
+                                site.firstSnapshot = automation.describeSnapshot(automation.getSnapshot());
+                            }
+
+                            ++site.count;
+                            site.totalBytes += event.bytes;
+                        }
+                    }
+
+                    processor->releaseResources();
+                }
+            }
+
+            int effectViolations = 0;
+            for (const auto& entry : sites)
+                effectViolations += entry.second.count;
+
+            totalViolations += effectViolations;
+
+            std::cout << padRight(effectName, 22)
+                      << (sites.empty() ? "clean" : juce::String(static_cast<int>(sites.size())) + " site(s), "
+                                                   + juce::String(effectViolations) + " event(s)")
+                      << "  [" << blocksChecked << " blocks]" << std::endl;
+
+            juce::Array<juce::var> jsonSites;
+
+            for (const auto& entry : sites)
+            {
+                const auto& site = entry.second;
+
+                std::cout << "    " << padRight(getTypeName(site.type), 13) << padLeft(juce::String(site.count), 7) << "x  "
+                          << site.location;
+
+                if (site.type == RealtimeTracker::EventType::allocation)
+                    std::cout << "  (" << site.totalBytes << " bytes)";
+
+                std::cout << std::endl << "        first at " << site.firstConfig << std::endl;
+
+                if (verbose)
+                {
+                    std::cout << "        params: " << site.firstSnapshot << std::endl;
+                    for (const auto& frame : site.stack)
+                        std::cout << "          " << frame << std::endl;
+                }
+
+                auto* jsonSite = new juce::DynamicObject();
+                jsonSite->setProperty("type", getTypeName(site.type));
+                jsonSite->setProperty("location", site.location);
+                jsonSite->setProperty("count", site.count);
+                jsonSite->setProperty("bytes", static_cast<juce::int64>(site.totalBytes));
+                jsonSite->setProperty("firstSeen", site.firstConfig);
+                jsonSite->setProperty("parameters", site.firstSnapshot);
+                jsonSite->setProperty("stack", site.stack);
+                jsonSites.add(juce::var(jsonSite));
+            }
+
+            auto* jsonEffect = new juce::DynamicObject();
+            jsonEffect->setProperty("effect", effectName);
+            jsonEffect->setProperty("blocksChecked", blocksChecked);
+            jsonEffect->setProperty("violations", effectViolations);
+            jsonEffect->setProperty("sites", jsonSites);
+            jsonEffects.add(juce::var(jsonEffect));
+        }
+
+        if (RealtimeTracker::getNumDroppedEvents() > 0)
+            std::cout << "Warning: " << RealtimeTracker::getNumDroppedEvents()
+                      << " events were dropped (more than 4096 in a single block)" << std::endl;
+
+        if (args.containsOption("--report"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("seed", seed);
+            root->setProperty("locksChecked", RealtimeTracker::canDetectLocks());
+            root->setProperty("effects", jsonEffects);
+
+            auto file = args.getFileForOption("--report");
+            saveJson(juce::var(root), file);
+            std::cout << "Wrote report to " << file.getFullPathName() << std::endl;
+        }
+
+        if (totalViolations > 0)
+            juce::ConsoleApplication::fail(juce::String(totalViolations) + " real-time safety violation(s) in processBlock", 3);
+    }
+}
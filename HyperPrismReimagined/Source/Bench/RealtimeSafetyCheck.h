@@ -0,0 +1,68 @@
+//==============================================================================
+// HyperPrism Reimagined - Real-Time Safety Checker
+// Flags heap allocation and mutex locking inside processBlock
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    //==============================================================================
+    // Global operator new/delete and pthread_mutex_lock (plus malloc/free on Linux)
+    // are replaced in the bench executable. They only record events on a thread
+    // that has armed the tracker.
+    //==============================================================================
+    namespace RealtimeTracker
+    {
+        enum class EventType
+        {
+            allocation,
+            deallocation,
+            mutexLock
+        };
+
+        static constexpr int maxFrames = 24;
+
+        struct Event
+        {
+            EventType type = EventType::allocation;
+            size_t bytes = 0;
+            int numFrames = 0;
+            void* frames[maxFrames] {};
+        };
+
+        // Must be called once at startup, before any tracking is armed
+        void initialise();
+
+        // True if mutex interception works on this platform
+        bool canDetectLocks();
+
+        // Starts/stops recording on the calling thread
+        void arm();
+        void disarm();
+
+        // Moves the events recorded since the last call into the given vector.
+        // Only call while disarmed.
+        void drainEvents(std::vector<Event>& destination);
+
+        // Number of events dropped because the fixed-size event store was full
+        int getNumDroppedEvents();
+
+        // Bytes currently allocated through the replaced functions, on every
+        // thread and regardless of arming. Used to measure per-instance state.
+        juce::int64 getLiveHeapBytes();
+
+        // RAII helper for arming around a single processBlock call
+        struct ScopedArm
+        {
+            ScopedArm()  { arm(); }
+            ~ScopedArm() { disarm(); }
+        };
+    }
+
+    // --rt-check [--effects=a,b] [--rates=..] [--blocks=..] [--seconds=n] [--seed=n]
+    //            [--report=file.json] [--verbose]
+    void runRealtimeSafetyCommand(const juce::ArgumentList& args);
+}
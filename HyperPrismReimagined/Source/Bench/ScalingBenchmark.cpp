@@ -0,0 +1,297 @@
+//==============================================================================
+// HyperPrism Reimagined - Many-Instance Scaling Benchmark Implementation
+//==============================================================================
+
+#include "ScalingBenchmark.h"
+#include "RealtimeSafetyCheck.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        static constexpr double pageBytes = 4096.0;
+        static constexpr double thrashThreshold = 1.25;   // Per-instance cost 25% above the smallest N
+
+        struct CacheSizes
+        {
+            juce::int64 level2 = 0;
+            juce::int64 level3 = 0;
+        };
+
+        struct ScalingPoint
+        {
+            int numInstances = 0;
+            double nanosecondsPerSample = 0.0;    // Per instance, per stereo frame
+            double slowdown = 1.0;                // Relative to the first point
+            double workingSetBytes = 0.0;
+            int maxRealtimeInstances = 0;         // How many fit in one block's budget at this cost
+        };
+
+        struct ScalingResult
+        {
+            juce::String effect;
+            double sampleRate = 0.0;
+            int blockSize = 0;
+            juce::int64 bytesPerInstance = 0;
+            int thrashOnset = 0;                  // First N past thrashThreshold, 0 if never
+            std::vector<ScalingPoint> points;
+        };
+
+        juce::int64 parseCacheSize(const juce::String& text)
+        {
+            auto value = text.trim().getLargeIntValue();
+
+            if (text.containsIgnoreCase("K"))   return value * 1024;
+            if (text.containsIgnoreCase("M"))   return value * 1024 * 1024;
+            return value;
+        }
+
+        CacheSizes readCacheSizes()
+        {
+            CacheSizes sizes;
+
+           #if JUCE_LINUX
+            for (const auto& index : juce::File("/sys/devices/system/cpu/cpu0/cache")
+                                         .findChildFiles(juce::File::findDirectories, false, "index*"))
+            {
+                const auto level = index.getChildFile("level").loadFileAsString().getIntValue();
+                const auto type = index.getChildFile("type").loadFileAsString().trim();
+                const auto size = parseCacheSize(index.getChildFile("size").loadFileAsString());
+
+                if (type == "Instruction")
+                    continue;
+
+                if (level == 2)      sizes.level2 = juce::jmax(sizes.level2, size);
+                else if (level == 3) sizes.level3 = juce::jmax(sizes.level3, size);
+            }
+           #endif
+
+            return sizes;
+        }
+
+        juce::String formatMegabytes(double bytes)
+        {
+            return juce::String(bytes / (1024.0 * 1024.0), 2);
+        }
+
+        juce::String describeCacheFit(double bytes, const CacheSizes& caches)
+        {
+            if (caches.level3 > 0 && bytes > static_cast<double>(caches.level3)) return "> L3";
+            if (caches.level2 > 0 && bytes > static_cast<double>(caches.level2)) return "> L2";
+            if (caches.level2 > 0)                                               return "L2";
+            return "?";
+        }
+
+        // Heap growth from creating and preparing one instance, i.e. its delay lines,
+        // filter state and parameter tree as well as the processor object itself
+        juce::int64 measureBytesPerInstance(const juce::String& effect, double sampleRate, int blockSize)
+        {
+            const auto before = RealtimeTracker::getLiveHeapBytes();
+
+            auto processor = createEffectOrFail(effect);
+            prepareProcessor(*processor, sampleRate, blockSize);
+
+            return juce::jmax(static_cast<juce::int64>(0), RealtimeTracker::getLiveHeapBytes() - before);
+        }
+
+        ScalingPoint measureInstances(const juce::String& effect, double sampleRate, int blockSize,
+                                      int numInstances, double seconds, Stimulus stimulus)
+        {
+            std::vector<std::unique_ptr<juce::AudioProcessor>> processors;
+            std::vector<juce::AudioBuffer<float>> buffers;
+            processors.reserve(static_cast<size_t>(numInstances));
+            buffers.reserve(static_cast<size_t>(numInstances));
+
+            for (int i = 0; i < numInstances; ++i)
+            {
+                processors.push_back(createEffectOrFail(effect));
+                prepareProcessor(*processors.back(), sampleRate, blockSize);
+                buffers.emplace_back(2, blockSize);
+            }
+
+            StimulusGenerator generator;
+            generator.prepare(stimulus, sampleRate);
+
+            juce::AudioBuffer<float> input(2, blockSize);
+            juce::MidiBuffer midi;
+
+            // Each host cycle processes one block on every instance in turn, each on its
+            // own track buffer, so instance state is evicted between visits exactly as it
+            // would be in a session with many plugin instances
+            auto runCycle = [&]
+            {
+                generator.fill(input);
+                juce::int64 ticks = 0;
+
+                for (size_t i = 0; i < processors.size(); ++i)
+                {
+                    auto& buffer = buffers[i];
+                    for (int channel = 0; channel < 2; ++channel)
+                        buffer.copyFrom(channel, 0, input, channel, 0, blockSize);
+
+                    const auto start = juce::Time::getHighResolutionTicks();
+                    processors[i]->processBlock(buffer, midi);
+                    ticks += juce::Time::getHighResolutionTicks() - start;
+                }
+
+                return ticks;
+            };
+
+            for (int i = 0; i < 4; ++i)
+                runCycle();
+
+            const int numCycles = juce::jmax(4, static_cast<int>(seconds * sampleRate / blockSize));
+            juce::int64 totalTicks = 0;
+
+            for (int i = 0; i < numCycles; ++i)
+                totalTicks += runCycle();
+
+            for (auto& processor : processors)
+                processor->releaseResources();
+
+            ScalingPoint point;
+            point.numInstances = numInstances;
+            point.nanosecondsPerSample = ticksToNanoseconds(totalTicks)
+                                         / (static_cast<double>(numCycles) * blockSize * numInstances);
+
+            const double budgetNanoseconds = 1.0e9 * blockSize / sampleRate;
+            const double nanosecondsPerBlock = point.nanosecondsPerSample * blockSize;
+            point.maxRealtimeInstances = nanosecondsPerBlock > 0.0 ? static_cast<int>(budgetNanoseconds / nanosecondsPerBlock) : 0;
+            return point;
+        }
+
+        juce::var toJson(const ScalingResult& result)
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty("effect", result.effect);
+            object->setProperty("sampleRate", result.sampleRate);
+            object->setProperty("blockSize", result.blockSize);
+            object->setProperty("bytesPerInstance", result.bytesPerInstance);
+            object->setProperty("thrashOnset", result.thrashOnset);
+
+            juce::Array<juce::var> points;
+            for (const auto& point : result.points)
+            {
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty("instances", point.numInstances);
+                entry->setProperty("nsPerSample", point.nanosecondsPerSample);
+                entry->setProperty("slowdown", point.slowdown);
+                entry->setProperty("workingSetBytes", point.workingSetBytes);
+                entry->setProperty("pages4k", std::ceil(point.workingSetBytes / pageBytes));
+                entry->setProperty("maxRealtimeInstances", point.maxRealtimeInstances);
+                points.add(juce::var(entry));
+            }
+            object->setProperty("points", points);
+
+            return juce::var(object);
+        }
+    }
+
+    void runScalingCommand(const juce::ArgumentList& args)
+    {
+        auto config = parseRunConfig(args);
+        if (! args.containsOption("--rates"))   config.sampleRates = { 48000.0 };
+        if (! args.containsOption("--blocks"))  config.blockSizes = { 256 };
+        if (! args.containsOption("--seconds")) config.secondsPerRun = 0.5;
+
+        juce::Array<int> instanceCounts;
+        if (args.containsOption("--instances"))
+        {
+            for (const auto& token : juce::StringArray::fromTokens(args.getValueForOption("--instances"), ",", {}))
+                if (token.getIntValue() > 0)
+                    instanceCounts.addUsingDefaultSort(token.getIntValue());
+        }
+
+        if (instanceCounts.isEmpty())
+            instanceCounts = { 1, 8, 64, 128, 256, 512 };
+
+        const double maxMemoryBytes = (args.containsOption("--max-memory") ? args.getValueForOption("--max-memory").getDoubleValue()
+                                                                          : 2048.0) * 1024.0 * 1024.0;
+
+        RealtimeTracker::initialise();
+        const auto caches = readCacheSizes();
+
+        std::cout << "L2 " << (caches.level2 > 0 ? formatMegabytes(static_cast<double>(caches.level2)) + " MB" : juce::String("unknown"))
+                  << ", L3 " << (caches.level3 > 0 ? formatMegabytes(static_cast<double>(caches.level3)) + " MB" : juce::String("unknown"))
+                  << std::endl << std::endl;
+
+        juce::Array<juce::var> jsonResults;
+
+        for (const auto& effect : config.effects)
+        {
+            for (auto sampleRate : config.sampleRates)
+            {
+                for (auto blockSize : config.blockSizes)
+                {
+                    ScalingResult result;
+                    result.effect = effect;
+                    result.sampleRate = sampleRate;
+                    result.blockSize = blockSize;
+                    result.bytesPerInstance = measureBytesPerInstance(effect, sampleRate, blockSize);
+
+                    const double bufferBytes = 2.0 * blockSize * sizeof(float);
+                    const double bytesPerTrack = static_cast<double>(result.bytesPerInstance) + bufferBytes;
+
+                    std::cout << effect << " @ " << juce::roundToInt(sampleRate) << " Hz / " << blockSize
+                              << "  (" << juce::String(static_cast<double>(result.bytesPerInstance) / 1024.0, 1)
+                              << " KiB state per instance)" << std::endl;
+                    std::cout << "  " << padLeft("N", 6) << padLeft("ns/sample", 12) << padLeft("slowdown", 10)
+                              << padLeft("set MB", 10) << padLeft("4K pages", 10) << padLeft("cache", 7)
+                              << padLeft("RT max", 8) << std::endl;
+
+                    for (auto numInstances : instanceCounts)
+                    {
+                        if (bytesPerTrack * numInstances > maxMemoryBytes)
+                        {
+                            std::cout << "  " << padLeft(juce::String(numInstances), 6)
+                                      << "  skipped (over --max-memory)" << std::endl;
+                            continue;
+                        }
+
+                        auto point = measureInstances(effect, sampleRate, blockSize, numInstances,
+                                                      config.secondsPerRun, config.stimulus);
+                        point.workingSetBytes = bytesPerTrack * numInstances;
+
+                        if (! result.points.empty() && result.points.front().nanosecondsPerSample > 0.0)
+                            point.slowdown = point.nanosecondsPerSample / result.points.front().nanosecondsPerSample;
+
+                        if (result.thrashOnset == 0 && point.slowdown > thrashThreshold)
+                            result.thrashOnset = numInstances;
+
+                        std::cout << "  " << padLeft(juce::String(numInstances), 6)
+                                  << padLeft(juce::String(point.nanosecondsPerSample, 2), 12)
+                                  << padLeft(juce::String(point.slowdown, 2) + "x", 10)
+                                  << padLeft(formatMegabytes(point.workingSetBytes), 10)
+                                  << padLeft(juce::String(static_cast<juce::int64>(std::ceil(point.workingSetBytes / pageBytes))), 10)
+                                  << padLeft(describeCacheFit(point.workingSetBytes, caches), 7)
+                                  << padLeft(juce::String(point.maxRealtimeInstances), 8) << std::endl;
+
+                        result.points.push_back(point);
+                    }
+
+                    if (result.thrashOnset > 0)
+                        std::cout << "  Per-instance cost passes +25% at N = " << result.thrashOnset << std::endl;
+
+                    std::cout << std::endl;
+                    jsonResults.add(toJson(result));
+                }
+            }
+        }
+
+        if (args.containsOption("--save"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("machine", juce::SystemStats::getComputerName());
+            root->setProperty("cpu", juce::SystemStats::getCpuModel());
+            root->setProperty("l2Bytes", caches.level2);
+            root->setProperty("l3Bytes", caches.level3);
+            root->setProperty("signal", getStimulusName(config.stimulus));
+            root->setProperty("secondsPerRun", config.secondsPerRun);
+            root->setProperty("results", jsonResults);
+
+            auto file = args.getFileForOption("--save");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved scaling report to " << file.getFullPathName() << std::endl;
+        }
+    }
+}
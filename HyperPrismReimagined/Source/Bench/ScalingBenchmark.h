@@ -0,0 +1,16 @@
+//==============================================================================
+// HyperPrism Reimagined - Many-Instance Scaling Benchmark
+// Runs N copies of an effect round-robin like a host and reports how the
+// per-instance cost grows as the combined state outgrows the caches
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --scaling [--effects=..] [--instances=1,8,64,128,256,512] [--rates=48000] [--blocks=256]
+    //           [--seconds=0.5] [--max-memory=2048] [--save=file.json]
+    void runScalingCommand(const juce::ArgumentList& args);
+}
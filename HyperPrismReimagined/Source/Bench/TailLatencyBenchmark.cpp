@@ -0,0 +1,262 @@
+//==============================================================================
+// HyperPrism Reimagined - Tail-Latency Benchmark Implementation
+//==============================================================================
+
+#include "TailLatencyBenchmark.h"
+#include "ParameterAutomation.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        struct SlowBlock
+        {
+            double nanoseconds = 0.0;
+            int blockIndex = 0;
+            juce::String changes;
+            juce::String parameters;
+        };
+
+        struct LatencyResult
+        {
+            juce::String effect;
+            double sampleRate = 0.0;
+            int blockSize = 0;
+            double budgetNanoseconds = 0.0;
+            double mean = 0.0, p50 = 0.0, p99 = 0.0, p999 = 0.0, max = 0.0;
+            int overBudget = 0;
+            std::vector<int> histogram;     // Log2 buckets of nanoseconds, bucket i = [2^i, 2^(i+1))
+            std::vector<SlowBlock> worst;   // Slowest first
+        };
+
+        static constexpr int numHistogramBuckets = 40;
+
+        double percentile(const std::vector<double>& sorted, double fraction)
+        {
+            if (sorted.empty())
+                return 0.0;
+
+            const auto index = static_cast<size_t>(juce::jlimit(0.0, 1.0, fraction) * static_cast<double>(sorted.size() - 1));
+            return sorted[index];
+        }
+
+        int getHistogramBucket(double nanoseconds)
+        {
+            return juce::jlimit(0, numHistogramBuckets - 1, static_cast<int>(std::log2(juce::jmax(1.0, nanoseconds))));
+        }
+
+        juce::String formatMicroseconds(double nanoseconds)
+        {
+            return juce::String(nanoseconds * 1.0e-3, 1);
+        }
+
+        LatencyResult measureTailLatency(const juce::String& effect, double sampleRate, int blockSize,
+                                         double seconds, Stimulus stimulus, juce::int64 seed, int numWorst)
+        {
+            auto processor = createEffectOrFail(effect);
+            prepareProcessor(*processor, sampleRate, blockSize);
+
+            ParameterAutomation automation(*processor, seed);
+            StimulusGenerator generator;
+            generator.prepare(stimulus, sampleRate);
+
+            juce::AudioBuffer<float> buffer(2, blockSize);
+            juce::MidiBuffer midi;
+
+            const int numBlocks = juce::jmax(1, static_cast<int>(seconds * sampleRate / blockSize));
+
+            LatencyResult result;
+            result.effect = effect;
+            result.sampleRate = sampleRate;
+            result.blockSize = blockSize;
+            result.budgetNanoseconds = 1.0e9 * blockSize / sampleRate;
+            result.histogram.assign(numHistogramBuckets, 0);
+
+            std::vector<double> durations;
+            durations.reserve(static_cast<size_t>(numBlocks));
+
+            auto previousSnapshot = automation.getSnapshot();
+
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                automation.advance(blockSize, sampleRate);
+                generator.fill(buffer);
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                processor->processBlock(buffer, midi);
+                const double elapsed = ticksToNanoseconds(juce::Time::getHighResolutionTicks() - start);
+
+                durations.push_back(elapsed);
+                ++result.histogram[static_cast<size_t>(getHistogramBucket(elapsed))];
+
+                auto snapshot = automation.getSnapshot();
+
+                // Keep the N slowest blocks, each with what changed going into it
+                const bool isAmongWorst = numWorst > 0
+                                          && (static_cast<int>(result.worst.size()) < numWorst
+                                              || elapsed > result.worst.back().nanoseconds);
+
+                if (isAmongWorst)
+                {
+                    SlowBlock slow;
+                    slow.nanoseconds = elapsed;
+                    slow.blockIndex = block;
+                    slow.changes = automation.describeChanges(previousSnapshot, snapshot);
+                    slow.parameters = automation.describeSnapshot(snapshot);
+
+                    auto position = std::find_if(result.worst.begin(), result.worst.end(),
+                                                 [elapsed](const SlowBlock& b) { return b.nanoseconds < elapsed; });
+                    result.worst.insert(position, slow);
+
+                    if (static_cast<int>(result.worst.size()) > numWorst)
+                        result.worst.pop_back();
+                }
+
+                previousSnapshot = std::move(snapshot);
+            }
+
+            processor->releaseResources();
+
+            double total = 0.0;
+            for (auto d : durations)
+            {
+                total += d;
+                result.overBudget += d > result.budgetNanoseconds ? 1 : 0;
+            }
+
+            std::sort(durations.begin(), durations.end());
+
+            result.mean = total / static_cast<double>(durations.size());
+            result.p50 = percentile(durations, 0.5);
+            result.p99 = percentile(durations, 0.99);
+            result.p999 = percentile(durations, 0.999);
+            result.max = durations.back();
+            return result;
+        }
+
+        void printHistogram(const LatencyResult& result)
+        {
+            int first = numHistogramBuckets, last = -1, peak = 1;
+
+            for (int i = 0; i < numHistogramBuckets; ++i)
+            {
+                if (result.histogram[static_cast<size_t>(i)] > 0)
+                {
+                    first = juce::jmin(first, i);
+                    last = juce::jmax(last, i);
+                    peak = juce::jmax(peak, result.histogram[static_cast<size_t>(i)]);
+                }
+            }
+
+            for (int i = first; i <= last; ++i)
+            {
+                const auto count = result.histogram[static_cast<size_t>(i)];
+                const auto lower = std::exp2(static_cast<double>(i));
+                const int barLength = count > 0 ? juce::jmax(1, 50 * count / peak) : 0;
+
+                std::cout << "      " << padLeft(formatMicroseconds(lower), 10) << " us "
+                          << (lower >= result.budgetNanoseconds ? "!" : "|")
+                          << juce::String::repeatedString("#", barLength) << " " << count << std::endl;
+            }
+        }
+
+        juce::var toJson(const LatencyResult& result)
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty("effect", result.effect);
+            object->setProperty("sampleRate", result.sampleRate);
+            object->setProperty("blockSize", result.blockSize);
+            object->setProperty("budgetNs", result.budgetNanoseconds);
+            object->setProperty("meanNs", result.mean);
+            object->setProperty("p50Ns", result.p50);
+            object->setProperty("p99Ns", result.p99);
+            object->setProperty("p999Ns", result.p999);
+            object->setProperty("maxNs", result.max);
+            object->setProperty("overBudget", result.overBudget);
+
+            juce::Array<juce::var> histogram;
+            for (auto count : result.histogram)
+                histogram.add(count);
+            object->setProperty("histogramLog2Ns", histogram);
+
+            juce::Array<juce::var> worst;
+            for (const auto& slow : result.worst)
+            {
+                auto* block = new juce::DynamicObject();
+                block->setProperty("ns", slow.nanoseconds);
+                block->setProperty("block", slow.blockIndex);
+                block->setProperty("changes", slow.changes);
+                block->setProperty("parameters", slow.parameters);
+                worst.add(juce::var(block));
+            }
+            object->setProperty("worst", worst);
+
+            return juce::var(object);
+        }
+    }
+
+    void runTailLatencyCommand(const juce::ArgumentList& args)
+    {
+        auto config = parseRunConfig(args);
+        if (! args.containsOption("--seconds"))
+            config.secondsPerRun = 5.0;
+
+        const auto seed = args.containsOption("--seed") ? args.getValueForOption("--seed").getLargeIntValue()
+                                                        : static_cast<juce::int64>(1);
+        const int numWorst = args.containsOption("--worst") ? juce::jmax(0, args.getValueForOption("--worst").getIntValue()) : 5;
+        const bool showHistogram = args.containsOption("--histogram");
+
+        std::cout << padRight("Effect", 22) << padLeft("Rate", 8) << padLeft("Block", 7)
+                  << padLeft("budget us", 11) << padLeft("p50", 9) << padLeft("p99", 9)
+                  << padLeft("p99.9", 9) << padLeft("max", 9) << padLeft("max %", 8) << padLeft("over", 6) << std::endl;
+
+        juce::Array<juce::var> jsonResults;
+
+        for (const auto& effect : config.effects)
+        {
+            for (auto sampleRate : config.sampleRates)
+            {
+                for (auto blockSize : config.blockSizes)
+                {
+                    auto result = measureTailLatency(effect, sampleRate, blockSize, config.secondsPerRun,
+                                                     config.stimulus, seed, numWorst);
+
+                    std::cout << padRight(effect, 22)
+                              << padLeft(juce::String(juce::roundToInt(sampleRate)), 8)
+                              << padLeft(juce::String(blockSize), 7)
+                              << padLeft(formatMicroseconds(result.budgetNanoseconds), 11)
+                              << padLeft(formatMicroseconds(result.p50), 9)
+                              << padLeft(formatMicroseconds(result.p99), 9)
+                              << padLeft(formatMicroseconds(result.p999), 9)
+                              << padLeft(formatMicroseconds(result.max), 9)
+                              << padLeft(juce::String(100.0 * result.max / result.budgetNanoseconds, 1), 8)
+                              << padLeft(juce::String(result.overBudget), 6) << std::endl;
+
+                    if (showHistogram)
+                        printHistogram(result);
+
+                    for (const auto& slow : result.worst)
+                    {
+                        std::cout << "      worst: " << formatMicroseconds(slow.nanoseconds) << " us at block "
+                                  << slow.blockIndex << "  changed: " << slow.changes << std::endl;
+                    }
+
+                    jsonResults.add(toJson(result));
+                }
+            }
+        }
+
+        if (args.containsOption("--save"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("seed", seed);
+            root->setProperty("signal", getStimulusName(config.stimulus));
+            root->setProperty("secondsPerRun", config.secondsPerRun);
+            root->setProperty("results", jsonResults);
+
+            auto file = args.getFileForOption("--save");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved latency report to " << file.getFullPathName() << std::endl;
+        }
+    }
+}
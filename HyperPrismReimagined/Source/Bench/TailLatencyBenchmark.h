@@ -0,0 +1,16 @@
+//==============================================================================
+// HyperPrism Reimagined - Tail-Latency Benchmark
+// Per-block processBlock timing under automation: percentiles, histogram and
+// the worst blocks together with the parameter changes that caused them
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    // --latency [--effects=a,b] [--rates=..] [--blocks=..] [--seconds=5] [--seed=n]
+    //           [--worst=5] [--histogram] [--save=file.json]
+    void runTailLatencyCommand(const juce::ArgumentList& args);
+}
@@ -0,0 +1,171 @@
+//==============================================================================
+// HyperPrism Reimagined - Throughput Benchmark Implementation
+//==============================================================================
+
+#include "ThroughputBenchmark.h"
+
+namespace HyperPrismBench
+{
+    namespace
+    {
+        juce::String makeKey(const juce::String& effect, double sampleRate, int blockSize)
+        {
+            return effect + "@" + juce::String(juce::roundToInt(sampleRate)) + "/" + juce::String(blockSize);
+        }
+
+        juce::var toJson(const ThroughputResult& result)
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty("effect", result.effect);
+            object->setProperty("sampleRate", result.sampleRate);
+            object->setProperty("blockSize", result.blockSize);
+            object->setProperty("nsPerSample", result.nanosecondsPerSample);
+            object->setProperty("realtimeFactor", result.realtimeFactor);
+            return juce::var(object);
+        }
+    }
+
+    ThroughputResult measureThroughput(const juce::String& effect, double sampleRate,
+                                       int blockSize, double seconds, Stimulus stimulus,
+                                       bool nonRealtime)
+    {
+        auto processor = createEffectOrFail(effect);
+        prepareProcessor(*processor, sampleRate, blockSize, nonRealtime);
+
+        auto result = measureThroughput(*processor, effect, sampleRate, blockSize, seconds, stimulus);
+        processor->releaseResources();
+        return result;
+    }
+
+    ThroughputResult measureThroughput(juce::AudioProcessor& processor, const juce::String& effect,
+                                       double sampleRate, int blockSize, double seconds, Stimulus stimulus)
+    {
+        StimulusGenerator generator;
+        generator.prepare(stimulus, sampleRate);
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midi;
+
+        // Warm up caches, lazily sized state and any first-block coefficient setup
+        const int warmUpBlocks = juce::jmax(4, static_cast<int>(0.25 * sampleRate / blockSize));
+        for (int i = 0; i < warmUpBlocks; ++i)
+        {
+            generator.fill(buffer);
+            processor.processBlock(buffer, midi);
+        }
+
+        const auto numBlocks = juce::jmax(1, static_cast<int>(seconds * sampleRate / blockSize));
+        juce::int64 totalTicks = 0;
+
+        // Only processBlock is timed; stimulus generation stays outside the measurement
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            generator.fill(buffer);
+
+            const auto start = juce::Time::getHighResolutionTicks();
+            processor.processBlock(buffer, midi);
+            totalTicks += juce::Time::getHighResolutionTicks() - start;
+        }
+
+        const double totalSamples = static_cast<double>(numBlocks) * blockSize;
+        const double totalNanoseconds = juce::jmax(1.0, ticksToNanoseconds(totalTicks));
+
+        ThroughputResult result;
+        result.effect = effect;
+        result.sampleRate = sampleRate;
+        result.blockSize = blockSize;
+        result.nanosecondsPerSample = totalNanoseconds / totalSamples;
+        result.realtimeFactor = (totalSamples / sampleRate) / (totalNanoseconds * 1.0e-9);
+        return result;
+    }
+
+    void runThroughputCommand(const juce::ArgumentList& args)
+    {
+        const auto config = parseRunConfig(args);
+
+        std::cout << padRight("Effect", 22) << padLeft("Rate", 8) << padLeft("Block", 7)
+                  << padLeft("ns/sample", 12) << padLeft("RT factor", 12) << padLeft("CPU %", 9) << std::endl;
+
+        juce::Array<ThroughputResult> results;
+
+        for (const auto& effect : config.effects)
+        {
+            for (auto sampleRate : config.sampleRates)
+            {
+                for (auto blockSize : config.blockSizes)
+                {
+                    auto result = measureThroughput(effect, sampleRate, blockSize,
+                                                    config.secondsPerRun, config.stimulus);
+                    results.add(result);
+
+                    std::cout << padRight(effect, 22)
+                              << padLeft(juce::String(juce::roundToInt(sampleRate)), 8)
+                              << padLeft(juce::String(blockSize), 7)
+                              << padLeft(juce::String(result.nanosecondsPerSample, 2), 12)
+                              << padLeft(juce::String(result.realtimeFactor, 1), 12)
+                              << padLeft(juce::String(100.0 / result.realtimeFactor, 3), 9) << std::endl;
+                }
+            }
+        }
+
+        if (args.containsOption("--save"))
+        {
+            auto* root = new juce::DynamicObject();
+            root->setProperty("version", 1);
+            root->setProperty("created", juce::Time::getCurrentTime().toISO8601(true));
+            root->setProperty("machine", juce::SystemStats::getComputerName());
+            root->setProperty("cpu", juce::SystemStats::getCpuModel());
+            root->setProperty("signal", getStimulusName(config.stimulus));
+            root->setProperty("secondsPerRun", config.secondsPerRun);
+
+            juce::Array<juce::var> rows;
+            for (const auto& result : results)
+                rows.add(toJson(result));
+
+            root->setProperty("results", rows);
+
+            auto file = args.getFileForOption("--save");
+            saveJson(juce::var(root), file);
+            std::cout << "Saved baseline to " << file.getFullPathName() << std::endl;
+        }
+
+        if (args.containsOption("--compare"))
+        {
+            auto baseline = loadJson(args.getExistingFileForOption("--compare"));
+            const double tolerance = args.containsOption("--tolerance")
+                                         ? args.getValueForOption("--tolerance").getDoubleValue()
+                                         : 5.0;
+
+            std::map<juce::String, double> baselineCost;
+            if (auto* rows = baseline["results"].getArray())
+                for (const auto& row : *rows)
+                    baselineCost[makeKey(row["effect"], row["sampleRate"], row["blockSize"])] = row["nsPerSample"];
+
+            int regressions = 0;
+
+            std::cout << std::endl << "Comparison against baseline (tolerance " << tolerance << " %)" << std::endl;
+
+            for (const auto& result : results)
+            {
+                auto found = baselineCost.find(makeKey(result.effect, result.sampleRate, result.blockSize));
+                if (found == baselineCost.end() || found->second <= 0.0)
+                    continue;
+
+                const double change = 100.0 * (result.nanosecondsPerSample - found->second) / found->second;
+                const bool regressed = change > tolerance;
+                regressions += regressed ? 1 : 0;
+
+                std::cout << padRight(result.effect, 22)
+                          << padLeft(juce::String(juce::roundToInt(result.sampleRate)), 8)
+                          << padLeft(juce::String(result.blockSize), 7)
+                          << padLeft(juce::String(found->second, 2), 12)
+                          << padLeft(juce::String(result.nanosecondsPerSample, 2), 12)
+                          << padLeft((change >= 0.0 ? "+" : "") + juce::String(change, 1) + " %", 10)
+                          << (regressed ? "  REGRESSION" : "") << std::endl;
+            }
+
+            if (regressions > 0)
+                juce::ConsoleApplication::fail(juce::String(regressions) + " configuration(s) slower than baseline", 2);
+        }
+    }
+}
@@ -0,0 +1,33 @@
+//==============================================================================
+// HyperPrism Reimagined - Throughput Benchmark
+// ns/sample and real-time factor per effect, sample rate and block size
+//==============================================================================
+
+#pragma once
+
+#include "BenchCommon.h"
+
+namespace HyperPrismBench
+{
+    struct ThroughputResult
+    {
+        juce::String effect;
+        double sampleRate = 0.0;
+        int blockSize = 0;
+        double nanosecondsPerSample = 0.0;  // Per stereo sample frame
+        double realtimeFactor = 0.0;        // Seconds of audio rendered per second of CPU
+    };
+
+    // Runs one effect at one configuration and returns the measured cost
+    ThroughputResult measureThroughput(const juce::String& effect, double sampleRate,
+                                       int blockSize, double seconds, Stimulus stimulus,
+                                       bool nonRealtime = false);
+
+    // Times an already prepared processor (a Rack, say); effect only labels the result
+    ThroughputResult measureThroughput(juce::AudioProcessor& processor, const juce::String& effect,
+                                       double sampleRate, int blockSize, double seconds, Stimulus stimulus);
+
+    // --throughput [--effects=a,b] [--rates=..] [--blocks=..] [--seconds=n] [--signal=type]
+    //              [--save=baseline.json] [--compare=baseline.json] [--tolerance=percent]
+    void runThroughputCommand(const juce::ArgumentList& args);
+}
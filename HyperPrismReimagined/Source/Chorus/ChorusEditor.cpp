@@ -5,6 +5,8 @@
 
 #include "ChorusEditor.h"
 
+namespace HyperPrismChorusUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // ChorusEditor Implementation
 //==============================================================================
 ChorusEditor::ChorusEditor(ChorusProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(ChorusProcessor::RATE_ID);
@@ -234,6 +237,7 @@ ChorusEditor::~ChorusEditor()
 
 void ChorusEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("ChorusEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -279,7 +283,7 @@ void ChorusEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -569,4 +573,6 @@ void ChorusEditor::updateXYPadLabel()
 void ChorusEditor::assignParameterToXYPad(const juce::String& parameterID, bool assignToX)
 {
     // This method is no longer used - replaced by toggle functionality in showParameterMenu
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismChorusUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "ChorusProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismChorusUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -136,5 +139,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChorusEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismChorusUI
+
+using HyperPrismChorusUI::ChorusEditor;
\ No newline at end of file
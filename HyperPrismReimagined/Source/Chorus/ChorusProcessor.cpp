@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "ChorusProcessor.h"
-#include "ChorusEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "ChorusEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String ChorusProcessor::BYPASS_ID = "bypass";
@@ -19,7 +21,11 @@ ChorusProcessor::ChorusProcessor()
      : AudioProcessor(BusesProperties()
                       .withInput("Input", juce::AudioChannelSet::stereo(), true)
                       .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-       valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+       valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+       cutFilters(valueTreeState, { LOW_CUT_ID, HIGH_CUT_ID }, [this](double sampleRate)
+       {
+           return HyperPrismCoefficients::makeCutFilters(sampleRate, lowCutParam->load(), highCutParam->load());
+       })
 {
     // Cache parameter pointers for efficient access
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -78,15 +84,17 @@ juce::AudioProcessorValueTreeState::ParameterLayout ChorusProcessor::createParam
 
 void ChorusProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare delay lines (max 100ms for chorus)
-    leftDelayLine.prepare(sampleRate, 100.0f);
-    rightDelayLine.prepare(sampleRate, 100.0f);
+    const auto maxDelaySamples = static_cast<int>(0.1 * sampleRate);
+    leftDelayLine.prepare(maxDelaySamples);
+    rightDelayLine.prepare(maxDelaySamples);
     
     // Initialize LFO phases with slight offset for stereo width
-    lfoPhase = 0.0f;
-    lfoPhaseRight = juce::MathConstants<float>::pi * 0.25f; // 45-degree offset
+    leftLfo.setPhase(0.0f);
+    rightLfo.setPhase(juce::MathConstants<float>::pi * 0.25f); // 45-degree offset
     
     // Prepare filters
     leftLowCut.reset();
@@ -95,11 +103,26 @@ void ChorusProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     rightHighCut.reset();
     
     // Pre-allocate dry buffer
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
 
-    // Reset filter state
-    previousLowCutFreq = -1.0f;
-    previousHighCutFreq = -1.0f;
+    // Parameter ramps
+    const double rampTime = 0.02; // 20ms
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    depthRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    feedbackRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    delayRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.setCurrentAndTarget(mixParam->load());
+    depthRamp.setCurrentAndTarget(depthParam->load());
+    feedbackRamp.setCurrentAndTarget(feedbackParam->load());
+    delayRamp.setCurrentAndTarget(delayParam->load());
+
+    // Filters start on the current settings rather than gliding to them
+    cutFilters.prepare(sampleRate);
+    leftLowCut.setCoefficients(cutFilters.get().lowCut);
+    rightLowCut.setCoefficients(cutFilters.get().lowCut);
+    leftHighCut.setCoefficients(cutFilters.get().highCut);
+    rightHighCut.setCoefficients(cutFilters.get().highCut);
 }
 
 void ChorusProcessor::releaseResources()
@@ -116,8 +139,13 @@ bool ChorusProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
 }
 
-void ChorusProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void ChorusProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Chorus::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -137,6 +165,7 @@ void ChorusProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiB
 
 void ChorusProcessor::processChorus(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Chorus::processChorus");
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
     
@@ -144,20 +173,34 @@ void ChorusProcessor::processChorus(juce::AudioBuffer<float>& buffer)
         return;
     
     // Get parameter values
-    float mix = mixParam->load();
     float rate = rateParam->load();
-    float depth = depthParam->load();
-    float feedback = feedbackParam->load();
-    float delayMs = delayParam->load();
+    mixRamp.setTarget(mixParam->load());
+    depthRamp.setTarget(depthParam->load());
+    feedbackRamp.setTarget(feedbackParam->load());
+    delayRamp.setTarget(delayParam->load());
+
+    const auto* mixes = mixRamp.process(numSamples);
+    const auto* depths = depthRamp.process(numSamples);
+    const auto* feedbacks = feedbackRamp.process(numSamples);
+    const auto* delays = delayRamp.process(numSamples);
     
-    // Update filters if needed
-    updateFilters();
+    // Glide to cut filter coefficients published since the last block
+    if (cutFilters.update(isNonRealtime()))
+    {
+        const auto& coefficients = cutFilters.get();
+        leftLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        rightLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        leftHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+        rightHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+    }
     
-    // Calculate LFO increment
-    float lfoIncrement = (rate * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+    // Set LFO rate
+    leftLfo.setFrequency(rate, currentSampleRate);
+    rightLfo.setFrequency(rate, currentSampleRate);
+    const float samplesPerMs = static_cast<float>(currentSampleRate) / 1000.0f;
     
     // Copy dry signal (pre-allocated buffer)
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     // Get audio data
     auto* leftChannel = buffer.getWritePointer(0);
@@ -166,9 +209,14 @@ void ChorusProcessor::processChorus(juce::AudioBuffer<float>& buffer)
     // Process each sample
     for (int sample = 0; sample < numSamples; ++sample)
     {
+        const float mix = mixes[sample];
+        const float depth = depths[sample];
+        const float feedback = feedbacks[sample];
+        const float delayMs = delays[sample];
+
         // Calculate LFO values
-        float lfoLeft = std::sin(lfoPhase);
-        float lfoRight = std::sin(lfoPhaseRight);
+        float lfoLeft = leftLfo.getNextSample();
+        float lfoRight = rightLfo.getNextSample();
         
         // Apply depth and calculate modulated delay times
         float leftDelayTime = delayMs + (lfoLeft * depth * delayMs * 0.5f);
@@ -176,57 +224,35 @@ void ChorusProcessor::processChorus(juce::AudioBuffer<float>& buffer)
         
         // Process left channel
         float leftInput = leftChannel[sample];
-        float leftChorus = leftDelayLine.processSample(leftInput, leftDelayTime, feedback);
+        float leftChorus = leftDelayLine.readLinear(leftDelayTime * samplesPerMs);
+        leftDelayLine.push(leftInput + (leftChorus * feedback));
         
         // Apply filtering
-        leftChorus = leftLowCut.processSingleSampleRaw(leftChorus);
-        leftChorus = leftHighCut.processSingleSampleRaw(leftChorus);
+        leftChorus = leftLowCut.processSample(leftChorus);
+        leftChorus = leftHighCut.processSample(leftChorus);
         
         // Process right channel
         float rightInput = rightChannel[sample];
-        float rightChorus = rightDelayLine.processSample(rightInput, rightDelayTime, feedback);
+        float rightChorus = rightDelayLine.readLinear(rightDelayTime * samplesPerMs);
+        rightDelayLine.push(rightInput + (rightChorus * feedback));
         
         // Apply filtering
-        rightChorus = rightLowCut.processSingleSampleRaw(rightChorus);
-        rightChorus = rightHighCut.processSingleSampleRaw(rightChorus);
+        rightChorus = rightLowCut.processSample(rightChorus);
+        rightChorus = rightHighCut.processSample(rightChorus);
         
         // Mix wet and dry signals
         leftChannel[sample] = leftInput + (mix * (leftChorus - leftInput));
         rightChannel[sample] = rightInput + (mix * (rightChorus - rightInput));
-        
-        // Advance LFO phases
-        lfoPhase += lfoIncrement;
-        lfoPhaseRight += lfoIncrement;
-        
-        // Wrap phases
-        if (lfoPhase >= juce::MathConstants<float>::twoPi)
-            lfoPhase -= juce::MathConstants<float>::twoPi;
-        if (lfoPhaseRight >= juce::MathConstants<float>::twoPi)
-            lfoPhaseRight -= juce::MathConstants<float>::twoPi;
-    }
-}
-
-void ChorusProcessor::updateFilters()
-{
-    float lowCutFreq = lowCutParam->load();
-    float highCutFreq = highCutParam->load();
-
-    if (std::abs(lowCutFreq - previousLowCutFreq) > 0.1f ||
-        std::abs(highCutFreq - previousHighCutFreq) > 0.1f)
-    {
-        leftLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        rightLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        leftHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-        rightHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-
-        previousLowCutFreq = lowCutFreq;
-        previousHighCutFreq = highCutFreq;
     }
 }
 
 juce::AudioProcessorEditor* ChorusProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new ChorusEditor(*this);
+   #endif
 }
 
 void ChorusProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -244,50 +270,11 @@ void ChorusProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-// ChorusDelayLine implementation
-void ChorusProcessor::ChorusDelayLine::prepare(double sampleRate, float maxDelayMs)
+void ChorusProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
 {
-    this->sampleRate = sampleRate;
-    maxDelaySamples = static_cast<int>((maxDelayMs / 1000.0f) * sampleRate) + 1;
-    buffer.setSize(1, maxDelaySamples);
-    reset();
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay lines", leftDelayLine.getAllocatedBytes() + rightDelayLine.getAllocatedBytes());
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes() + depthRamp.getAllocatedBytes()
+                                        + feedbackRamp.getAllocatedBytes() + delayRamp.getAllocatedBytes());
 }
-
-void ChorusProcessor::ChorusDelayLine::reset()
-{
-    buffer.clear();
-    writeIndex = 0;
-}
-
-float ChorusProcessor::ChorusDelayLine::processSample(float input, float delayMs, float feedback)
-{
-    if (maxDelaySamples == 0)
-        return input;
-    
-    // Convert delay time to samples
-    float delaySamples = (delayMs / 1000.0f) * static_cast<float>(sampleRate);
-    delaySamples = juce::jlimit(0.0f, static_cast<float>(maxDelaySamples - 1), delaySamples);
-    
-    // Calculate read position with fractional delay
-    float readPosition = writeIndex - delaySamples;
-    if (readPosition < 0.0f)
-        readPosition += maxDelaySamples;
-    
-    // Linear interpolation for fractional delay
-    int readIndex1 = static_cast<int>(readPosition);
-    int readIndex2 = (readIndex1 + 1) % maxDelaySamples;
-    float fraction = readPosition - readIndex1;
-    
-    auto* bufferData = buffer.getReadPointer(0);
-    float delayedSample = bufferData[readIndex1] * (1.0f - fraction) + 
-                         bufferData[readIndex2] * fraction;
-    
-    // Write input plus feedback to delay line
-    auto* writeData = buffer.getWritePointer(0);
-    writeData[writeIndex] = input + (delayedSample * feedback);
-    
-    // Advance write index
-    writeIndex = (writeIndex + 1) % maxDelaySamples;
-    
-    return delayedSample;
-}
\ No newline at end of file
@@ -5,8 +5,16 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/DelayLine.h"
+#include "../DSP/Lfo.h"
+#include "../DSP/ParameterRamp.h"
 
-class ChorusProcessor : public juce::AudioProcessor
+class ChorusProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     ChorusProcessor();
@@ -20,7 +28,11 @@ public:
     
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
     
     // Program/State
     const juce::String getName() const override { return "HyperPrism Reimagined Chorus"; }
@@ -51,40 +63,32 @@ public:
     static const juce::String LOW_CUT_ID;
     static const juce::String HIGH_CUT_ID;
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
     // Audio processing
     void processChorus(juce::AudioBuffer<float>& buffer);
-    void updateFilters();
-    
-    // Chorus delay line class
-    class ChorusDelayLine
-    {
-    public:
-        void prepare(double sampleRate, float maxDelayMs);
-        void reset();
-        float processSample(float input, float delayMs, float feedback);
-        
-    private:
-        juce::AudioBuffer<float> buffer;
-        int writeIndex = 0;
-        int maxDelaySamples = 0;
-        double sampleRate = 44100.0;
-    };
     
     // State
     juce::AudioProcessorValueTreeState valueTreeState;
     
     // DSP components
-    ChorusDelayLine leftDelayLine, rightDelayLine;
-    juce::IIRFilter leftLowCut, rightLowCut;
-    juce::IIRFilter leftHighCut, rightHighCut;
+    HyperPrismDSP::DelayLine leftDelayLine, rightDelayLine;
+    HyperPrismDSP::Biquad leftLowCut, rightLowCut;
+    HyperPrismDSP::Biquad leftHighCut, rightHighCut;
+
+    // Cut filter coefficients, computed off the audio thread
+    HyperPrismCoefficients::Cache<HyperPrismCoefficients::CutFilters> cutFilters;
     
     // LFO for modulation
-    float lfoPhase = 0.0f;
-    float lfoPhaseRight = 0.0f;
+    HyperPrismDSP::SineLfo leftLfo, rightLfo;
     
     // Cached parameters
     std::atomic<float>* bypassParam = nullptr;
@@ -95,14 +99,22 @@ private:
     std::atomic<float>* delayParam = nullptr;
     std::atomic<float>* lowCutParam = nullptr;
     std::atomic<float>* highCutParam = nullptr;
+
+    // Ramps for the parameters that click when they jump, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    HyperPrismDSP::ParameterRamp depthRamp;
+    HyperPrismDSP::ParameterRamp feedbackRamp;
+    HyperPrismDSP::ParameterRamp delayRamp;
     
     // Pre-allocated dry buffer (real-time safe)
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
 
     // Processing state
     double currentSampleRate = 44100.0;
-    float previousLowCutFreq = -1.0f;
-    float previousHighCutFreq = -1.0f;
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChorusProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "CompressorEditor.h"
 
+namespace HyperPrismCompressorUI
+{
 //==============================================================================
 // XYPad Implementation (matching modern style)
 //==============================================================================
@@ -160,6 +162,7 @@ void GainReductionMeter::paint(juce::Graphics& g)
 
 void GainReductionMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("GainReductionMeter::timerCallback");
     targetReduction = processor.getGainReduction();
     
     // Smooth the meter movement
@@ -173,9 +176,10 @@ void GainReductionMeter::timerCallback()
 // CompressorEditor Implementation
 //==============================================================================
 CompressorEditor::CompressorEditor(CompressorProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), gainReductionMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), gainReductionMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add("threshold");
@@ -316,6 +320,7 @@ CompressorEditor::~CompressorEditor()
 
 void CompressorEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("CompressorEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -363,7 +368,7 @@ void CompressorEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -652,4 +657,6 @@ void CompressorEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismCompressorUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "CompressorProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismCompressorUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -146,7 +149,14 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CompressorEditor)
 };
 
-//==============================================================================
\ No newline at end of file
+//==============================================================================
+
+} // namespace HyperPrismCompressorUI
+
+using HyperPrismCompressorUI::CompressorEditor;
\ No newline at end of file
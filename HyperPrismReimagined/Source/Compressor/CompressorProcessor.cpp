@@ -1,5 +1,7 @@
 #include "CompressorProcessor.h"
-#include "CompressorEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "CompressorEditor.h"
+#endif
 
 CompressorProcessor::CompressorProcessor()
     : AudioProcessor(BusesProperties()
@@ -83,9 +85,17 @@ juce::AudioProcessorValueTreeState::ParameterLayout CompressorProcessor::createP
 
 void CompressorProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
-    envelope = 0.0f;
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    envelope.reset();
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.02; // 20ms
+    makeupGainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    makeupGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(makeupGainParam->load()));
+    mixRamp.setCurrentAndTarget(mixParam->load() * 0.01f);
 }
 
 void CompressorProcessor::releaseResources()
@@ -112,6 +122,11 @@ float CompressorProcessor::calculateReleaseCoeff(float releaseTimeMs)
 
 void CompressorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Compressor::processBlock");
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -122,18 +137,24 @@ void CompressorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     if (bypassParam->load() > 0.5f)
         return;
 
-    const float mixAmount = mixParam->load() * 0.01f;
     const float threshold = thresholdParam->load();
     const float ratio = ratioParam->load();
     const float knee = kneeParam->load();
-    const float makeupGain = juce::Decibels::decibelsToGain(makeupGainParam->load());
     const float attackCoeff = calculateAttackCoeff(attackParam->load());
     const float releaseCoeff = calculateReleaseCoeff(releaseParam->load());
 
-    dryBuffer.makeCopyOf(buffer);
+    // The envelope is a gain, so it falls on attack and rises on release
+    envelope.setPoles(releaseCoeff, attackCoeff);
+
+    dryBuffer.makeCopyOf(buffer, true);
 
     const int numSamples = buffer.getNumSamples();
 
+    makeupGainRamp.setTarget(juce::Decibels::decibelsToGain(makeupGainParam->load()));
+    mixRamp.setTarget(mixParam->load() * 0.01f);
+    const auto* makeupGains = makeupGainRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
+
     for (int sample = 0; sample < numSamples; ++sample)
     {
         // Linked stereo: detect from max level across all channels
@@ -167,36 +188,41 @@ void CompressorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
 
         float targetGainReduction = juce::Decibels::decibelsToGain(-gainReductionDb);
 
-        if (targetGainReduction < envelope)
-            envelope = targetGainReduction + (envelope - targetGainReduction) * attackCoeff;
-        else
-            envelope = targetGainReduction + (envelope - targetGainReduction) * releaseCoeff;
+        const float gain = envelope.process(targetGainReduction);
 
-        currentGainReduction.store(1.0f - envelope);
+        currentGainReduction.store(1.0f - gain);
 
         // Apply same gain to all channels
+        const float totalGain = gain * makeupGains[sample];
         for (int channel = 0; channel < totalNumInputChannels; ++channel)
-        {
-            float dry = dryBuffer.getSample(channel, sample);
-            float compressed = buffer.getSample(channel, sample) * envelope * makeupGain;
-            buffer.setSample(channel, sample, dry * (1.0f - mixAmount) + compressed * mixAmount);
-        }
+            buffer.setSample(channel, sample, buffer.getSample(channel, sample) * totalGain);
     }
+
+    // The envelope has to run sample by sample, but the dry/wet blend does not
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumInputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 bool CompressorProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* CompressorProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new CompressorEditor(*this);
+   #endif
 }
 
 const juce::String CompressorProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Compressor";
 }
 
 bool CompressorProcessor::acceptsMidi() const
@@ -256,4 +282,11 @@ void CompressorProcessor::setStateInformation(const void* data, int sizeInBytes)
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(apvts.state.getType()))
             apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
+}
+
+void CompressorProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", makeupGainRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
 }
\ No newline at end of file
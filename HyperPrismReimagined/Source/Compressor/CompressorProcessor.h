@@ -1,8 +1,14 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-class CompressorProcessor : public juce::AudioProcessor
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/EnvelopeFollower.h"
+#include "../DSP/ParameterRamp.h"
+
+class CompressorProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     CompressorProcessor();
@@ -38,6 +44,12 @@ public:
     
     float getGainReduction() const { return currentGainReduction.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
@@ -51,14 +63,19 @@ private:
     std::atomic<float>* mixParam = nullptr;
     
     // Compression state
-    float envelope = 0.0f;
+    HyperPrismDSP::EnvelopeFollower envelope;
     std::atomic<float> currentGainReduction { 0.0f };
 
+    // Makeup gain and mix ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp makeupGainRamp;
+    HyperPrismDSP::ParameterRamp mixRamp;
+
     // Bypass
     std::atomic<float>* bypassParam = nullptr;
 
     // Pre-allocated dry buffer (real-time safe)
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
 
     // Sample rate
     double currentSampleRate = 44100.0;
@@ -67,5 +84,8 @@ private:
     float calculateAttackCoeff(float attackTimeMs);
     float calculateReleaseCoeff(float releaseTimeMs);
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CompressorProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,81 @@
+//==============================================================================
+// HyperPrism Reimagined - Biquad
+//==============================================================================
+
+#include "Biquad.h"
+
+namespace HyperPrismDSP
+{
+    void Biquad::setCoefficients(const BiquadCoefficients& newCoefficients) noexcept
+    {
+        coefficients = target = newCoefficients;
+        rampRemaining = 0;
+    }
+
+    void Biquad::rampTo(const BiquadCoefficients& newCoefficients, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+        {
+            setCoefficients(newCoefficients);
+            return;
+        }
+
+        target = newCoefficients;
+        rampRemaining = numSamples;
+
+        const auto scale = 1.0f / static_cast<float>(numSamples);
+        increment.b0 = (target.b0 - coefficients.b0) * scale;
+        increment.b1 = (target.b1 - coefficients.b1) * scale;
+        increment.b2 = (target.b2 - coefficients.b2) * scale;
+        increment.a1 = (target.a1 - coefficients.a1) * scale;
+        increment.a2 = (target.a2 - coefficients.a2) * scale;
+    }
+
+    void Biquad::stepRamp() noexcept
+    {
+        if (--rampRemaining == 0)
+        {
+            // Land exactly on the target rather than the accumulated sum
+            coefficients = target;
+            return;
+        }
+
+        coefficients.b0 += increment.b0;
+        coefficients.b1 += increment.b1;
+        coefficients.b2 += increment.b2;
+        coefficients.a1 += increment.a1;
+        coefficients.a2 += increment.a2;
+    }
+
+    void Biquad::process(float* samples, int numSamples) noexcept
+    {
+        int start = 0;
+
+        // Any remaining glide runs sample by sample
+        for (; start < numSamples && rampRemaining > 0; ++start)
+            samples[start] = processSample(samples[start]);
+
+        // Then the fixed-coefficient loop, with the state in locals and
+        // snapped once at the end, as juce::IIRFilter::processSamples does
+        const auto c = coefficients;
+        auto lv1 = v1;
+        auto lv2 = v2;
+
+        for (int i = start; i < numSamples; ++i)
+        {
+            const auto input = samples[i];
+            const auto output = c.b0 * input + lv1;
+            samples[i] = output;
+            lv1 = c.b1 * input - c.a1 * output + lv2;
+            lv2 = c.b2 * input - c.a2 * output;
+        }
+
+        if (! (lv1 < -1.0e-8f || lv1 > 1.0e-8f))
+            lv1 = 0.0f;
+        if (! (lv2 < -1.0e-8f || lv2 > 1.0e-8f))
+            lv2 = 0.0f;
+
+        v1 = lv1;
+        v2 = lv2;
+    }
+}
@@ -0,0 +1,71 @@
+//==============================================================================
+// HyperPrism Reimagined - Biquad
+// Second-order IIR section whose coefficients can glide to a new set, so a
+// filter picks up coefficients computed elsewhere without a step
+//==============================================================================
+
+#pragma once
+
+namespace HyperPrismDSP
+{
+    //==============================================================================
+    // Normalised so a0 is 1; the same five values juce::IIRCoefficients and
+    // juce::dsp::IIR::Coefficients hold for a second-order section
+    struct BiquadCoefficients
+    {
+        float b0 = 1.0f;
+        float b1 = 0.0f;
+        float b2 = 0.0f;
+        float a1 = 0.0f;
+        float a2 = 0.0f;
+    };
+
+    //==============================================================================
+    // Transposed direct form II, computed in the same order as
+    // juce::IIRFilter, so a filter with fixed coefficients matches it sample
+    // for sample. Ramping interpolates the coefficients linearly; the stable
+    // region of a biquad's poles is convex in (a1, a2), so every step between
+    // two stable sets is stable.
+    class Biquad
+    {
+    public:
+        // Jumps to the new coefficients
+        void setCoefficients(const BiquadCoefficients& newCoefficients) noexcept;
+
+        // Glides to the new coefficients over numSamples processed samples
+        void rampTo(const BiquadCoefficients& newCoefficients, int numSamples) noexcept;
+
+        const BiquadCoefficients& getCoefficients() const noexcept    { return coefficients; }
+
+        void reset() noexcept                                          { v1 = v2 = 0.0f; }
+
+        float processSample(float input) noexcept
+        {
+            if (rampRemaining > 0)
+                stepRamp();
+
+            auto output = coefficients.b0 * input + v1;
+
+            // As JUCE_SNAP_TO_ZERO
+            if (! (output < -1.0e-8f || output > 1.0e-8f))
+                output = 0.0f;
+
+            v1 = coefficients.b1 * input - coefficients.a1 * output + v2;
+            v2 = coefficients.b2 * input - coefficients.a2 * output;
+            return output;
+        }
+
+        // Filters a block in place
+        void process(float* samples, int numSamples) noexcept;
+
+    private:
+        void stepRamp() noexcept;
+
+        BiquadCoefficients coefficients;
+        BiquadCoefficients target;
+        BiquadCoefficients increment;
+        int rampRemaining = 0;
+        float v1 = 0.0f;
+        float v2 = 0.0f;
+    };
+}
@@ -0,0 +1,23 @@
+//==============================================================================
+// HyperPrism Reimagined - Control Signal
+//==============================================================================
+
+#include "ControlSignal.h"
+
+namespace HyperPrismDSP
+{
+    void ControlSignal::prepare(int controlInterval, int maximumBlockSize)
+    {
+        values.assign(static_cast<std::size_t>(std::max(maximumBlockSize, 1)), end);
+        setInterval(controlInterval);
+        interval = pendingInterval;
+        reset(end);
+    }
+
+    void ControlSignal::reset(float value) noexcept
+    {
+        start = end = value;
+        step = 0.0f;
+        countdown = 0;
+    }
+}
@@ -0,0 +1,93 @@
+//==============================================================================
+// HyperPrism Reimagined - Control Signal
+// Modulation evaluated at a control rate and interpolated back up to audio
+// rate, so LFOs and filter coefficients cost a few transcendentals per block
+//==============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace HyperPrismDSP
+{
+    //==============================================================================
+    // Every controlInterval samples the compute function is asked for a new
+    // value; the samples between ramp linearly from the previous value to it.
+    // The function receives the block offset of its control point, so it can
+    // read that sample of any parameter ramp:
+    //
+    //     const auto* coefficients = sweep.process(numSamples, [&](int sample)
+    //     {
+    //         lfo.setFrequency(rates[sample], sampleRate);
+    //         return coefficientFor(centre * std::exp2(lfo.getNextSample(sweep.getInterval())));
+    //     });
+    //
+    // A value is reached at the end of its segment, one interval after it was
+    // computed. An interval of 1 computes every sample and reproduces the
+    // audio-rate result exactly. Control points carry across blocks, so the
+    // block size does not change the output.
+    class ControlSignal
+    {
+    public:
+        // Allocates the value array; call from prepareToPlay
+        void prepare(int controlInterval, int maximumBlockSize);
+
+        // Holds value, with the next control point on the next sample
+        void reset(float value) noexcept;
+
+        // Takes effect at the next control point
+        void setInterval(int controlInterval) noexcept  { pendingInterval = std::max(controlInterval, 1); }
+
+        // Samples covered by the segment being computed; modulation sources
+        // advance by this much per control point
+        int getInterval() const noexcept                 { return interval; }
+
+        std::size_t getAllocatedBytes() const noexcept   { return values.capacity() * sizeof(float); }
+
+        // The next numSamples values, at most the prepared block size
+        template <typename ComputeFunction>
+        const float* process(int numSamples, ComputeFunction&& compute)
+        {
+            auto* output = values.data();
+            int sample = 0;
+
+            while (sample < numSamples)
+            {
+                if (countdown == 0)
+                {
+                    interval = pendingInterval;
+                    start = end;
+                    end = compute(sample);
+                    step = (end - start) / static_cast<float>(interval);
+                    countdown = interval;
+                }
+
+                const auto run = std::min(countdown, numSamples - sample);
+                const auto elapsed = interval - countdown;
+
+                for (int i = 0; i < run; ++i)
+                    output[sample + i] = start + step * static_cast<float>(elapsed + i + 1);
+
+                countdown -= run;
+                sample += run;
+
+                // Land exactly on the computed value at the segment's end
+                if (countdown == 0)
+                    output[sample - 1] = end;
+            }
+
+            return output;
+        }
+
+    private:
+        std::vector<float> values;
+        float start = 0.0f;
+        float end = 0.0f;
+        float step = 0.0f;
+        int interval = 1;
+        int pendingInterval = 1;
+        int countdown = 0;              // Samples left in the current segment
+    };
+}
@@ -0,0 +1,54 @@
+//==============================================================================
+// HyperPrism Reimagined - Delay Line
+//==============================================================================
+
+#include "DelayLine.h"
+
+#include <algorithm>
+
+namespace HyperPrismDSP
+{
+    void DelayLine::prepare(int maximumDelaySamples, int maximumBlockSize)
+    {
+        maximumDelay = std::max(0, maximumDelaySamples);
+
+        // Cubic reads reach one sample newer and two older than the delay
+        const auto required = maximumDelay + std::max(0, maximumBlockSize) + 3;
+
+        int size = 1;
+        while (size < required)
+            size <<= 1;
+
+        buffer.assign(static_cast<std::size_t>(size), 0.0f);
+        mask = size - 1;
+        writeIndex = 0;
+    }
+
+    void DelayLine::reset() noexcept
+    {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+        writeIndex = 0;
+    }
+
+    void DelayLine::pushBlock(const float* input, int numSamples) noexcept
+    {
+        const auto size = mask + 1;
+        const auto first = std::min(numSamples, size - writeIndex);
+
+        std::copy(input, input + first, buffer.data() + writeIndex);
+        std::copy(input + first, input + numSamples, buffer.data());
+
+        writeIndex = (writeIndex + numSamples) & mask;
+    }
+
+    void DelayLine::readBlock(float* output, int delaySamples, int numSamples) const noexcept
+    {
+        const auto size = mask + 1;
+        const auto start = (writeIndex - numSamples - clampDelay(delaySamples)) & mask;
+        const auto first = std::min(numSamples, size - start);
+
+        // Source and destination never overlap: output is outside the ring
+        std::copy(buffer.data() + start, buffer.data() + start + first, output);
+        std::copy(buffer.data(), buffer.data() + (numSamples - first), output + first);
+    }
+}
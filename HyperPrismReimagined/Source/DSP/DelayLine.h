@@ -0,0 +1,110 @@
+//==============================================================================
+// HyperPrism Reimagined - Delay Line
+// Single-channel ring buffer shared by every delay-based effect
+//==============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace HyperPrismDSP
+{
+    //==============================================================================
+    // The ring is a power of two long, so positions wrap with a mask instead of
+    // a modulo or a branch.
+    //
+    // Per sample, read the delayed output first and then push the new input,
+    // which is what a feedback line needs. A delay of d returns the sample
+    // pushed d samples before the one about to be pushed:
+    //
+    //     const auto delayed = line.readLinear(delaySamples);
+    //     line.push(input + delayed * feedback);
+    //
+    // Fixed delays without feedback can run a block at a time: push the block,
+    // then read it back delayed.
+    class DelayLine
+    {
+    public:
+        // Allocates and clears the ring. maximumBlockSize is only needed for
+        // the block functions, which keep a whole block in the ring as well.
+        void prepare(int maximumDelaySamples, int maximumBlockSize = 0);
+        void reset() noexcept;
+
+        int getMaximumDelay() const noexcept            { return maximumDelay; }
+        std::size_t getAllocatedBytes() const noexcept  { return buffer.capacity() * sizeof(float); }
+
+        //==============================================================================
+        // Delays are clamped to the prepared maximum
+        float read(int delaySamples) const noexcept
+        {
+            return buffer[static_cast<std::size_t>((writeIndex - clampDelay(delaySamples)) & mask)];
+        }
+
+        // Linear interpolation between the two samples around the delay
+        float readLinear(float delaySamples) const noexcept
+        {
+            const auto delay = clampDelay(delaySamples);
+            const auto whole = static_cast<int>(delay);
+            const auto fraction = delay - static_cast<float>(whole);
+
+            const auto newer = sampleAt(whole);
+            const auto older = sampleAt(whole + 1);
+            return newer * (1.0f - fraction) + older * fraction;
+        }
+
+        // Catmull-Rom interpolation over the four samples around the delay, for
+        // modulated delays where linear interpolation would dull the top end
+        float readCubic(float delaySamples) const noexcept
+        {
+            const auto delay = clampDelay(delaySamples);
+            const auto whole = static_cast<int>(delay);
+            const auto t = delay - static_cast<float>(whole);
+
+            const auto y0 = sampleAt(whole - 1);
+            const auto y1 = sampleAt(whole);
+            const auto y2 = sampleAt(whole + 1);
+            const auto y3 = sampleAt(whole + 2);
+
+            const auto a0 = -0.5f * y0 + 1.5f * y1 - 1.5f * y2 + 0.5f * y3;
+            const auto a1 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+            const auto a2 = -0.5f * y0 + 0.5f * y2;
+            return ((a0 * t + a1) * t + a2) * t + y1;
+        }
+
+        void push(float sample) noexcept
+        {
+            buffer[static_cast<std::size_t>(writeIndex)] = sample;
+            writeIndex = (writeIndex + 1) & mask;
+        }
+
+        //==============================================================================
+        // Copies a block into the ring in at most two contiguous spans
+        void pushBlock(const float* input, int numSamples) noexcept;
+
+        // After pushBlock: output[i] is the sample pushed delaySamples before
+        // input[i] of the last block. output may be the block's input buffer.
+        void readBlock(float* output, int delaySamples, int numSamples) const noexcept;
+
+    private:
+        float clampDelay(float delay) const noexcept
+        {
+            return delay < 0.0f ? 0.0f : (delay > static_cast<float>(maximumDelay) ? static_cast<float>(maximumDelay) : delay);
+        }
+
+        int clampDelay(int delay) const noexcept
+        {
+            return delay < 0 ? 0 : (delay > maximumDelay ? maximumDelay : delay);
+        }
+
+        float sampleAt(int delay) const noexcept
+        {
+            return buffer[static_cast<std::size_t>((writeIndex - delay) & mask)];
+        }
+
+        std::vector<float> buffer;
+        int mask = 0;
+        int writeIndex = 0;
+        int maximumDelay = 0;
+    };
+}
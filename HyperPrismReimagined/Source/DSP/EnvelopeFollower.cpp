@@ -0,0 +1,24 @@
+//==============================================================================
+// HyperPrism Reimagined - Envelope Follower
+//==============================================================================
+
+#include "EnvelopeFollower.h"
+
+namespace HyperPrismDSP
+{
+    void EnvelopeFollower::process(const float* targets, float* output, int numSamples) noexcept
+    {
+        auto state = value;
+        const auto risingPole = rising;
+        const auto fallingPole = falling;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto target = targets[i];
+            state = target + (state - target) * (target > state ? risingPole : fallingPole);
+            output[i] = state;
+        }
+
+        value = state;
+    }
+}
@@ -0,0 +1,52 @@
+//==============================================================================
+// HyperPrism Reimagined - Envelope Follower
+// One-pole smoother with separate poles for rising and falling input, used
+// for level detection and gain smoothing in the dynamics effects
+//==============================================================================
+
+#pragma once
+
+#include <cmath>
+
+namespace HyperPrismDSP
+{
+    //==============================================================================
+    // The pole of a one-pole smoother with the given time constant
+    inline float poleForTime(float milliseconds, double sampleRate) noexcept
+    {
+        return std::exp(-1.0f / (milliseconds * 0.001f * static_cast<float>(sampleRate)));
+    }
+
+    //==============================================================================
+    // value = target + (value - target) * pole, with the rising pole while the
+    // target is above the value and the falling pole otherwise. As a level
+    // detector, rising is the attack; as a gain smoother, falling is. A pole of
+    // 0 follows instantly, e.g. a peak limiter's attack.
+    class EnvelopeFollower
+    {
+    public:
+        void setPoles(float risingPole, float fallingPole) noexcept
+        {
+            rising = risingPole;
+            falling = fallingPole;
+        }
+
+        void reset(float initialValue = 0.0f) noexcept   { value = initialValue; }
+        float getValue() const noexcept                  { return value; }
+
+        float process(float target) noexcept
+        {
+            value = target + (value - target) * (target > value ? rising : falling);
+            return value;
+        }
+
+        // The recursion is serial, so the block form's gain is keeping the state
+        // in a register across the loop rather than vectorising it
+        void process(const float* targets, float* output, int numSamples) noexcept;
+
+    private:
+        float value = 0.0f;
+        float rising = 0.0f;
+        float falling = 0.0f;
+    };
+}
@@ -0,0 +1,23 @@
+//==============================================================================
+// HyperPrism Reimagined - LFO
+//==============================================================================
+
+#include "Lfo.h"
+
+namespace HyperPrismDSP
+{
+    void SineLfo::process(float* output, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[i] = phase;
+
+            phase += increment;
+            if (phase >= twoPi)
+                phase -= twoPi;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = std::sin(output[i]);
+    }
+}
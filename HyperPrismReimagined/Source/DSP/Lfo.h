@@ -0,0 +1,60 @@
+//==============================================================================
+// HyperPrism Reimagined - LFO
+// Sine LFO on a wrapped phase accumulator, for the modulated delay and
+// phaser effects
+//==============================================================================
+
+#pragma once
+
+#include <cmath>
+
+namespace HyperPrismDSP
+{
+    class SineLfo
+    {
+    public:
+        static constexpr float twoPi = 6.283185307179586f;
+
+        void setFrequency(float hz, double sampleRate) noexcept
+        {
+            increment = (hz * twoPi) / static_cast<float>(sampleRate);
+        }
+
+        // Phase in radians, [0, 2 pi)
+        void setPhase(float radians) noexcept    { phase = radians; }
+        float getPhase() const noexcept          { return phase; }
+
+        // The value at the current phase, then advances one sample
+        float getNextSample() noexcept
+        {
+            const auto sample = std::sin(phase);
+
+            phase += increment;
+            if (phase >= twoPi)
+                phase -= twoPi;
+
+            return sample;
+        }
+
+        // The value at the current phase, then advances numSamples; for an LFO
+        // evaluated once per control interval
+        float getNextSample(int numSamples) noexcept
+        {
+            const auto sample = std::sin(phase);
+
+            phase += increment * static_cast<float>(numSamples);
+            while (phase >= twoPi)
+                phase -= twoPi;
+
+            return sample;
+        }
+
+        // Fills a block of values; the phases are accumulated first so the sin
+        // loop has no carried dependency
+        void process(float* output, int numSamples) noexcept;
+
+    private:
+        float phase = 0.0f;
+        float increment = 0.0f;
+    };
+}
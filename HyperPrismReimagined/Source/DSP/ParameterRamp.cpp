@@ -0,0 +1,90 @@
+//==============================================================================
+// HyperPrism Reimagined - Parameter Ramp
+//==============================================================================
+
+#include "ParameterRamp.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace HyperPrismDSP
+{
+    void ParameterRamp::prepare(double sampleRate, double rampSeconds, int maximumBlockSize)
+    {
+        values.assign(static_cast<std::size_t>(std::max(maximumBlockSize, 1)), target);
+        rampLength = static_cast<int>(std::floor(rampSeconds * sampleRate));
+        current = target;
+        countdown = 0;
+        settledSamples = static_cast<int>(values.size());
+    }
+
+    void ParameterRamp::setCurrentAndTarget(float value) noexcept
+    {
+        if (value != target)
+            settledSamples = 0;
+
+        current = target = value;
+        countdown = 0;
+    }
+
+    void ParameterRamp::setTarget(float value) noexcept
+    {
+        if (value == target)
+            return;
+
+        if (rampLength <= 0)
+        {
+            setCurrentAndTarget(value);
+            return;
+        }
+
+        target = value;
+        countdown = rampLength;
+        step = (target - current) / static_cast<float>(countdown);
+        settledSamples = 0;
+    }
+
+    const float* ParameterRamp::process(int numSamples) noexcept
+    {
+        assert(numSamples <= static_cast<int>(values.size()));
+
+        auto* output = values.data();
+
+        if (countdown <= 0)
+        {
+            if (settledSamples < numSamples)
+            {
+                std::fill(output + settledSamples, output + numSamples, target);
+                settledSamples = numSamples;
+            }
+
+            constant = true;
+            return output;
+        }
+
+        // Offsets from the block's start value rather than a running sum, so
+        // the loop carries no dependency
+        const auto rampSamples = std::min(countdown, numSamples);
+        const auto start = current;
+
+        for (int i = 0; i < rampSamples; ++i)
+            output[i] = start + step * static_cast<float>(i + 1);
+
+        countdown -= rampSamples;
+
+        if (countdown > 0)
+        {
+            current = output[rampSamples - 1];
+        }
+        else
+        {
+            current = target;
+            output[rampSamples - 1] = target;
+            std::fill(output + rampSamples, output + numSamples, target);
+        }
+
+        constant = false;
+        return output;
+    }
+}
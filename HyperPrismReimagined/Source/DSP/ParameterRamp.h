@@ -0,0 +1,59 @@
+//==============================================================================
+// HyperPrism Reimagined - Parameter Ramp
+// Linear parameter smoothing rendered a block at a time, so processing loops
+// read a plain array instead of stepping a smoother per sample
+//==============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace HyperPrismDSP
+{
+    //==============================================================================
+    // Steps like juce::SmoothedValue<float, Linear>: a new target restarts a
+    // ramp of the prepared length from the current value. Once per block, set
+    // the target and render the block's values:
+    //
+    //     gainRamp.setTarget(gain);
+    //     const auto* gains = gainRamp.process(numSamples);
+    //
+    //     if (gainRamp.isConstant())
+    //         ... scale by gains[0] ...
+    //     else
+    //         ... scale by gains[i] ...
+    //
+    // A settled ramp leaves the target in the array and does not rewrite it,
+    // so parameters that are not moving cost nothing per block.
+    class ParameterRamp
+    {
+    public:
+        // Allocates the value array; call from prepareToPlay. The current
+        // value jumps to the target.
+        void prepare(double sampleRate, double rampSeconds, int maximumBlockSize);
+
+        void setCurrentAndTarget(float value) noexcept;
+        void setTarget(float value) noexcept;
+
+        float getTarget() const noexcept                { return target; }
+        bool isSmoothing() const noexcept               { return countdown > 0; }
+        std::size_t getAllocatedBytes() const noexcept  { return values.capacity() * sizeof(float); }
+
+        // The next numSamples values, at most the prepared block size
+        const float* process(int numSamples) noexcept;
+
+        // True when the last processed block held the target throughout
+        bool isConstant() const noexcept                { return constant; }
+
+    private:
+        std::vector<float> values;
+        float current = 0.0f;
+        float target = 0.0f;
+        float step = 0.0f;
+        int rampLength = 0;
+        int countdown = 0;
+        int settledSamples = 0;         // Leading values that already hold the target
+        bool constant = true;
+    };
+}
@@ -5,6 +5,8 @@
 
 #include "DelayEditor.h"
 
+namespace HyperPrismDelayUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // DelayEditor Implementation
 //==============================================================================
 DelayEditor::DelayEditor(DelayProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(DelayProcessor::DELAY_TIME_ID);
@@ -234,6 +237,7 @@ DelayEditor::~DelayEditor()
 
 void DelayEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("DelayEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -281,7 +285,7 @@ void DelayEditor::resized()
     tempoSyncButton.setBounds(12, 8, 100, 24);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -572,4 +576,6 @@ void DelayEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismDelayUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "DelayProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismDelayUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -137,5 +140,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DelayEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismDelayUI
+
+using HyperPrismDelayUI::DelayEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "DelayProcessor.h"
-#include "DelayEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "DelayEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String DelayProcessor::BYPASS_ID = "bypass";
@@ -19,7 +21,11 @@ DelayProcessor::DelayProcessor()
      : AudioProcessor(BusesProperties()
                       .withInput("Input", juce::AudioChannelSet::stereo(), true)
                       .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-       valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+       valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+       cutFilters(valueTreeState, { LOW_CUT_ID, HIGH_CUT_ID }, [this](double sampleRate)
+       {
+           return HyperPrismCoefficients::makeCutFilters(sampleRate, lowCutParam->load(), highCutParam->load());
+       })
 {
     // Cache parameter pointers for efficient access
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -69,12 +75,13 @@ juce::AudioProcessorValueTreeState::ParameterLayout DelayProcessor::createParame
 
 void DelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare delay lines (max 4 seconds)
     int maxDelayInSamples = static_cast<int>(sampleRate * 4.0);
-    leftDelay.prepare(sampleRate, maxDelayInSamples);
-    rightDelay.prepare(sampleRate, maxDelayInSamples);
+    leftDelay.prepare(maxDelayInSamples);
+    rightDelay.prepare(maxDelayInSamples);
     
     // Prepare filters
     leftLowCut.reset();
@@ -82,8 +89,16 @@ void DelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     leftHighCut.reset();
     rightHighCut.reset();
     
-    // Reset filter state
-    previousFilterFreq = -1.0f;
+    // Filters start on the current settings rather than gliding to them
+    cutFilters.prepare(sampleRate);
+    leftLowCut.setCoefficients(cutFilters.get().lowCut);
+    rightLowCut.setCoefficients(cutFilters.get().lowCut);
+    leftHighCut.setCoefficients(cutFilters.get().highCut);
+    rightHighCut.setCoefficients(cutFilters.get().highCut);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    mixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    mixRamp.setCurrentAndTarget(mixParam->load());
 }
 
 void DelayProcessor::releaseResources()
@@ -100,8 +115,13 @@ bool DelayProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
 }
 
-void DelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void DelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Delay::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -121,6 +141,7 @@ void DelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBu
 
 void DelayProcessor::processDelay(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Delay::processDelay");
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
     
@@ -128,21 +149,26 @@ void DelayProcessor::processDelay(juce::AudioBuffer<float>& buffer)
         return;
     
     // Get parameter values
-    float mix = mixParam->load();
+    mixRamp.setTarget(mixParam->load());
+    const auto* mixes = mixRamp.process(numSamples);
     float delayTimeMs = delayTimeParam->load();
     float feedback = feedbackParam->load();
     float stereoOffsetMs = stereoOffsetParam->load();
     
-    // Update filters if needed
-    updateFilters();
+    // Glide to cut filter coefficients published since the last block
+    if (cutFilters.update(isNonRealtime()))
+    {
+        const auto& coefficients = cutFilters.get();
+        leftLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        rightLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        leftHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+        rightHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+    }
     
     // Convert delay times to samples
     float leftDelayInSamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
     float rightDelayInSamples = leftDelayInSamples + ((stereoOffsetMs / 1000.0f) * static_cast<float>(currentSampleRate));
     
-    leftDelay.setDelay(leftDelayInSamples);
-    rightDelay.setDelay(rightDelayInSamples);
-    
     // Get audio data
     auto* leftChannel = buffer.getWritePointer(0);
     auto* rightChannel = buffer.getWritePointer(1);
@@ -152,50 +178,35 @@ void DelayProcessor::processDelay(juce::AudioBuffer<float>& buffer)
     {
         // Process left channel
         float leftInput = leftChannel[sample];
-        float leftDelayed = leftDelay.processSample(leftInput, feedback);
+        float leftDelayed = leftDelay.readLinear(leftDelayInSamples);
+        leftDelay.push(leftInput + (leftDelayed * feedback));
         
         // Apply filtering
-        leftDelayed = leftLowCut.processSingleSampleRaw(leftDelayed);
-        leftDelayed = leftHighCut.processSingleSampleRaw(leftDelayed);
+        leftDelayed = leftLowCut.processSample(leftDelayed);
+        leftDelayed = leftHighCut.processSample(leftDelayed);
         
-        leftChannel[sample] = leftInput + (mix * (leftDelayed - leftInput));
+        leftChannel[sample] = leftInput + (mixes[sample] * (leftDelayed - leftInput));
         
         // Process right channel
         float rightInput = rightChannel[sample];
-        float rightDelayed = rightDelay.processSample(rightInput, feedback);
+        float rightDelayed = rightDelay.readLinear(rightDelayInSamples);
+        rightDelay.push(rightInput + (rightDelayed * feedback));
         
         // Apply filtering
-        rightDelayed = rightLowCut.processSingleSampleRaw(rightDelayed);
-        rightDelayed = rightHighCut.processSingleSampleRaw(rightDelayed);
-        
-        rightChannel[sample] = rightInput + (mix * (rightDelayed - rightInput));
-    }
-}
-
-void DelayProcessor::updateFilters()
-{
-    float lowCutFreq = lowCutParam->load();
-    float highCutFreq = highCutParam->load();
-    
-    // Only update if frequencies changed
-    if (std::abs(lowCutFreq - previousFilterFreq) > 0.1f || 
-        std::abs(highCutFreq - previousFilterFreq) > 0.1f)
-    {
-        // High-pass filter (low cut)
-        leftLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        rightLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        
-        // Low-pass filter (high cut)
-        leftHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-        rightHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
+        rightDelayed = rightLowCut.processSample(rightDelayed);
+        rightDelayed = rightHighCut.processSample(rightDelayed);
         
-        previousFilterFreq = lowCutFreq; // Track one of them
+        rightChannel[sample] = rightInput + (mixes[sample] * (rightDelayed - rightInput));
     }
 }
 
 juce::AudioProcessorEditor* DelayProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new DelayEditor(*this);
+   #endif
 }
 
 void DelayProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -213,50 +224,9 @@ void DelayProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-// DelayLine implementation
-void DelayProcessor::DelayLine::prepare(double, int maxDelayInSamples)
+void DelayProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
 {
-    maxDelay = maxDelayInSamples;
-    buffer.setSize(1, maxDelayInSamples + 1);
-    reset();
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay lines", leftDelay.getAllocatedBytes() + rightDelay.getAllocatedBytes());
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes());
 }
-
-void DelayProcessor::DelayLine::reset()
-{
-    buffer.clear();
-    writeIndex = 0;
-}
-
-void DelayProcessor::DelayLine::setDelay(float delaySamples)
-{
-    this->delayInSamples = juce::jlimit(0.0f, static_cast<float>(maxDelay), delaySamples);
-}
-
-float DelayProcessor::DelayLine::processSample(float input, float feedback)
-{
-    if (maxDelay == 0)
-        return input;
-    
-    // Calculate read position with fractional delay
-    float readPosition = writeIndex - delayInSamples;
-    if (readPosition < 0.0f)
-        readPosition += maxDelay;
-    
-    // Linear interpolation for fractional delay
-    int readIndex1 = static_cast<int>(readPosition);
-    int readIndex2 = (readIndex1 + 1) % maxDelay;
-    float fraction = readPosition - readIndex1;
-    
-    auto* bufferData = buffer.getReadPointer(0);
-    float delayedSample = bufferData[readIndex1] * (1.0f - fraction) + 
-                         bufferData[readIndex2] * fraction;
-    
-    // Write input plus feedback to delay line
-    auto* writeData = buffer.getWritePointer(0);
-    writeData[writeIndex] = input + (delayedSample * feedback);
-    
-    // Advance write index
-    writeIndex = (writeIndex + 1) % maxDelay;
-    
-    return delayedSample;
-}
\ No newline at end of file
@@ -5,8 +5,15 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../Shared/LargeBlocks.h"
+#include "../DSP/DelayLine.h"
+#include "../DSP/ParameterRamp.h"
 
-class DelayProcessor : public juce::AudioProcessor
+class DelayProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     DelayProcessor();
@@ -20,7 +27,11 @@ public:
     
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
     
     // Program/State
     const juce::String getName() const override { return "HyperPrism Reimagined Delay"; }
@@ -51,37 +62,33 @@ public:
     static const juce::String TEMPO_SYNC_ID;
     static const juce::String STEREO_OFFSET_ID;
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
     // Audio processing
     void processDelay(juce::AudioBuffer<float>& buffer);
-    void updateFilters();
-    
-    // Delay line class
-    class DelayLine
-    {
-    public:
-        void prepare(double sampleRate, int maxDelayInSamples);
-        void reset();
-        void setDelay(float delayInSamples);
-        float processSample(float input, float feedback);
-        
-    private:
-        juce::AudioBuffer<float> buffer;
-        int writeIndex = 0;
-        float delayInSamples = 0.0f;
-        int maxDelay = 0;
-    };
     
     // State
     juce::AudioProcessorValueTreeState valueTreeState;
     
     // DSP components
-    DelayLine leftDelay, rightDelay;
-    juce::IIRFilter leftLowCut, rightLowCut;
-    juce::IIRFilter leftHighCut, rightHighCut;
+    HyperPrismDSP::DelayLine leftDelay, rightDelay;
+    HyperPrismDSP::Biquad leftLowCut, rightLowCut;
+    HyperPrismDSP::Biquad leftHighCut, rightHighCut;
+
+    // Cut filter coefficients, computed off the audio thread
+    HyperPrismCoefficients::Cache<HyperPrismCoefficients::CutFilters> cutFilters;
+
+    // Mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Cached parameters
     std::atomic<float>* bypassParam = nullptr;
@@ -95,7 +102,9 @@ private:
     
     // Processing state
     double currentSampleRate = 44100.0;
-    float previousFilterFreq = -1.0f;
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DelayProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "EchoEditor.h"
 
+namespace HyperPrismEchoUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // EchoEditor Implementation
 //==============================================================================
 EchoEditor::EchoEditor(EchoProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(EchoProcessor::DELAY_ID);
@@ -193,6 +196,7 @@ EchoEditor::~EchoEditor()
 
 void EchoEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("EchoEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -236,7 +240,7 @@ void EchoEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -511,4 +515,6 @@ void EchoEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismEchoUI
\ No newline at end of file
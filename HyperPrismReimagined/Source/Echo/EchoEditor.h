@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "EchoProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismEchoUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -121,5 +124,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EchoEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismEchoUI
+
+using HyperPrismEchoUI::EchoEditor;
\ No newline at end of file
@@ -3,7 +3,24 @@
 //==============================================================================
 
 #include "EchoProcessor.h"
-#include "EchoEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "EchoEditor.h"
+#endif
+
+namespace
+{
+    using Param = EchoProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        labelledFloatParameter(Param::delay, EchoProcessor::DELAY_ID, "Delay", 0.0f, 2000.0f, 1.0f, 1.0f, 250.0f, "ms"),
+        labelledFloatParameter(Param::feedback, EchoProcessor::FEEDBACK_ID, "Feedback", 0.0f, 100.0f, 1.0f, 1.0f, 30.0f, "%"),
+        labelledFloatParameter(Param::mix, EchoProcessor::MIX_ID, "Mix", 0.0f, 100.0f, 1.0f, 1.0f, 50.0f, "%"),
+        boolParameter(Param::bypass, EchoProcessor::BYPASS_ID, "Bypass", false)
+    }}};
+
+    static_assert(parameterTable.isValid(), "Echo parameter table out of step with EchoProcessor::Param");
+}
 
 EchoProcessor::EchoProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -16,53 +33,18 @@ EchoProcessor::EchoProcessor()
                      #endif
                        ),
 #endif
-    parameters(*this, nullptr, juce::Identifier("Echo"), createParameterLayout())
+    parameters(*this, nullptr, juce::Identifier("Echo"), HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(parameters, parameterTable)
 {
-    // Initialize smoothed values
-    delaySmoothed.reset(50);
-    feedbackSmoothed.reset(50);
-    mixSmoothed.reset(50);
 }
 
 EchoProcessor::~EchoProcessor()
 {
 }
 
-juce::AudioProcessorValueTreeState::ParameterLayout EchoProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        DELAY_ID,
-        "Delay",
-        juce::NormalisableRange<float>(0.0f, 2000.0f, 1.0f),
-        250.0f,
-        "ms"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        FEEDBACK_ID,
-        "Feedback",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
-        30.0f,
-        "%"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID,
-        "Mix",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
-        50.0f,
-        "%"));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID,
-        "Bypass",
-        false));
-
-    return layout;
-}
-
 void EchoProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = static_cast<float>(sampleRate);
     
     // Prepare delay lines
@@ -77,17 +59,23 @@ void EchoProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     delayLineLeft.reset();
     delayLineRight.reset();
     
-    // Set smoothing rates
+    // Set ramp rates
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
     const double smoothingTime = 0.05; // 50ms
-    delaySmoothed.reset(sampleRate, smoothingTime);
-    feedbackSmoothed.reset(sampleRate, smoothingTime);
-    mixSmoothed.reset(sampleRate, smoothingTime);
+    delayRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+    feedbackRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+
+    delayRamp.setCurrentAndTarget(parameterValues.get(Param::delay));
+    feedbackRamp.setCurrentAndTarget(parameterValues.get(Param::feedback) * 0.01f);
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void EchoProcessor::releaseResources()
 {
-    delayLineLeft.reset();
-    delayLineRight.reset();
+    // Unprepared again: the lines hold no samples until the next prepareToPlay
+    delayLineLeft = juce::dsp::DelayLine<float>(maxDelaySamples);
+    delayLineRight = juce::dsp::DelayLine<float>(maxDelaySamples);
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -106,6 +94,11 @@ bool EchoProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 
 void EchoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Echo::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const int totalNumInputChannels = getTotalNumInputChannels();
     const int totalNumOutputChannels = getTotalNumOutputChannels();
@@ -116,23 +109,28 @@ void EchoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuf
         buffer.clear(i, 0, numSamples);
 
     // Get parameter values
-    const bool bypassed = parameters.getRawParameterValue(BYPASS_ID)->load() > 0.5f;
+    const auto values = parameterValues.snapshot();
+    const bool bypassed = values.isOn(Param::bypass);
     if (bypassed)
         return;
 
-    // Update smoothed parameters
-    delaySmoothed.setTargetValue(parameters.getRawParameterValue(DELAY_ID)->load());
-    feedbackSmoothed.setTargetValue(parameters.getRawParameterValue(FEEDBACK_ID)->load() * 0.01f);
-    mixSmoothed.setTargetValue(parameters.getRawParameterValue(MIX_ID)->load() * 0.01f);
+    // Render this block's parameter ramps
+    delayRamp.setTarget(values[Param::delay]);
+    feedbackRamp.setTarget(values[Param::feedback] * 0.01f);
+    mixRamp.setTarget(values[Param::mix] * 0.01f);
+
+    const auto* delays = delayRamp.process(numSamples);
+    const auto* feedbacks = feedbackRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
 
     // Process each channel
     const int numChannels = juce::jmin(totalNumInputChannels, totalNumOutputChannels);
     
     for (int sample = 0; sample < numSamples; ++sample)
     {
-        const float currentDelay = delaySmoothed.getNextValue();
-        const float currentFeedback = feedbackSmoothed.getNextValue();
-        const float currentMix = mixSmoothed.getNextValue();
+        const float currentDelay = delays[sample];
+        const float currentFeedback = feedbacks[sample];
+        const float currentMix = mixes[sample];
         
         // Convert delay time to samples
         const float delaySamples = (currentDelay / 1000.0f) * currentSampleRate;
@@ -177,7 +175,11 @@ void EchoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuf
 
 juce::AudioProcessorEditor* EchoProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new EchoEditor(*this);
+   #endif
 }
 
 void EchoProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -193,4 +195,11 @@ void EchoProcessor::setStateInformation(const void* data, int sizeInBytes)
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(parameters.state.getType()))
             parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+}
+
+void EchoProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay lines", HyperPrismMemory::bytesOf(delayLineLeft, 1) + HyperPrismMemory::bytesOf(delayLineRight, 1));
+    footprint.add("parameter ramps", delayRamp.getAllocatedBytes() + feedbackRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
 }
\ No newline at end of file
@@ -6,8 +6,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/ParameterTable.h"
+#include "../DSP/ParameterRamp.h"
 
-class EchoProcessor : public juce::AudioProcessor
+class EchoProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     static constexpr auto DELAY_ID = "delay";
@@ -15,6 +21,9 @@ public:
     static constexpr auto MIX_ID = "mix";
     static constexpr auto BYPASS_ID = "bypass";
 
+    // Parameters in layout order, indexing the table in EchoProcessor.cpp
+    enum class Param { delay, feedback, mix, bypass, count };
+
     EchoProcessor();
     ~EchoProcessor() override;
 
@@ -28,9 +37,13 @@ public:
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
-    const juce::String getName() const override { return JucePlugin_Name; }
+    const juce::String getName() const override { return "HyperPrism Reimagined Echo"; }
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
@@ -47,22 +60,32 @@ public:
 
     juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     juce::AudioProcessorValueTreeState parameters;
+    HyperPrismParameters::Values<Param> parameterValues;
     
     // Delay line
-    juce::dsp::DelayLine<float> delayLineLeft { 192000 };  // 2 seconds at 96kHz
-    juce::dsp::DelayLine<float> delayLineRight { 192000 };
+    static constexpr int maxDelaySamples = 192000;         // 2 seconds at 96kHz
+    juce::dsp::DelayLine<float> delayLineLeft { maxDelaySamples };
+    juce::dsp::DelayLine<float> delayLineRight { maxDelaySamples };
     
     // Current parameter values
     float currentSampleRate = 44100.0f;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
-    // Parameter smoothing
-    juce::SmoothedValue<float> delaySmoothed;
-    juce::SmoothedValue<float> feedbackSmoothed;
-    juce::SmoothedValue<float> mixSmoothed;
-    
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // Parameter ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp delayRamp;
+    HyperPrismDSP::ParameterRamp feedbackRamp;
+    HyperPrismDSP::ParameterRamp mixRamp;
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EchoProcessor)
 };
\ No newline at end of file
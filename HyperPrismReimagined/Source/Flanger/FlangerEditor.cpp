@@ -5,6 +5,8 @@
 
 #include "FlangerEditor.h"
 
+namespace HyperPrismFlangerUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // FlangerEditor Implementation
 //==============================================================================
 FlangerEditor::FlangerEditor(FlangerProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(FlangerProcessor::RATE_ID);
@@ -243,6 +246,7 @@ FlangerEditor::~FlangerEditor()
 
 void FlangerEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("FlangerEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -287,7 +291,7 @@ void FlangerEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -585,4 +589,6 @@ void FlangerEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismFlangerUI
\ No newline at end of file
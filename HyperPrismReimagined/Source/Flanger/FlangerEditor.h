@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "FlangerProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismFlangerUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -144,5 +147,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlangerEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismFlangerUI
+
+using HyperPrismFlangerUI::FlangerEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "FlangerProcessor.h"
-#include "FlangerEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "FlangerEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String FlangerProcessor::BYPASS_ID = "bypass";
@@ -15,12 +17,17 @@ const juce::String FlangerProcessor::DELAY_ID = "delay";
 const juce::String FlangerProcessor::PHASE_ID = "phase";
 const juce::String FlangerProcessor::LOW_CUT_ID = "lowCut";
 const juce::String FlangerProcessor::HIGH_CUT_ID = "highCut";
+const juce::String FlangerProcessor::MODULATION_QUALITY_ID = HyperPrismModulation::QUALITY_ID;
 
 FlangerProcessor::FlangerProcessor()
      : AudioProcessor(BusesProperties()
                       .withInput("Input", juce::AudioChannelSet::stereo(), true)
                       .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-       valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+       valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+       cutFilters(valueTreeState, { LOW_CUT_ID, HIGH_CUT_ID }, [this](double sampleRate)
+       {
+           return HyperPrismCoefficients::makeCutFilters(sampleRate, lowCutParam->load(), highCutParam->load());
+       })
 {
     // Cache parameter pointers for efficient access
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -32,6 +39,7 @@ FlangerProcessor::FlangerProcessor()
     phaseParam = valueTreeState.getRawParameterValue(PHASE_ID);
     lowCutParam = valueTreeState.getRawParameterValue(LOW_CUT_ID);
     highCutParam = valueTreeState.getRawParameterValue(HIGH_CUT_ID);
+    modulationQualityParam = valueTreeState.getRawParameterValue(MODULATION_QUALITY_ID);
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout FlangerProcessor::createParameterLayout()
@@ -68,21 +76,25 @@ juce::AudioProcessorValueTreeState::ParameterLayout FlangerProcessor::createPara
     parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
         HIGH_CUT_ID, "High Cut", 
         juce::NormalisableRange<float>(200.0f, 20000.0f, 1.0f, 0.3f), 20000.0f));
+
+    parameters.push_back(HyperPrismModulation::createParameter());
     
     return { parameters.begin(), parameters.end() };
 }
 
 void FlangerProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare delay lines (max 50ms for flanger - shorter than chorus)
-    leftDelayLine.prepare(sampleRate, 50.0f);
-    rightDelayLine.prepare(sampleRate, 50.0f);
+    const auto maxDelaySamples = static_cast<int>(0.05 * sampleRate);
+    leftDelayLine.prepare(maxDelaySamples);
+    rightDelayLine.prepare(maxDelaySamples);
     
     // Initialize LFO phases
-    lfoPhase = 0.0f;
-    lfoPhaseRight = 0.0f;
+    leftLfo.setPhase(0.0f);
+    rightLfo.setPhase(0.0f);
     
     // Prepare filters
     leftLowCut.reset();
@@ -90,10 +102,26 @@ void FlangerProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     leftHighCut.reset();
     rightHighCut.reset();
     
-    // Reset filter state
-    previousFilterFreq = -1.0f;
+    // Filters start on the current settings rather than gliding to them
+    cutFilters.prepare(sampleRate);
+    leftLowCut.setCoefficients(cutFilters.get().lowCut);
+    rightLowCut.setCoefficients(cutFilters.get().lowCut);
+    leftHighCut.setCoefficients(cutFilters.get().highCut);
+    rightHighCut.setCoefficients(cutFilters.get().highCut);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    // The sweeps start at the centre delay, where the LFOs' zero phase puts them
+    const int controlInterval = HyperPrismModulation::getControlInterval(modulationQualityParam->load());
+    const float centreDelaySamples = delayParam->load() * static_cast<float>(sampleRate) / 1000.0f;
+    leftDelaySignal.prepare(controlInterval, scratchCapacity);
+    rightDelaySignal.prepare(controlInterval, scratchCapacity);
+    leftDelaySignal.reset(centreDelaySamples);
+    rightDelaySignal.reset(centreDelaySamples);
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    mixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    mixRamp.setCurrentAndTarget(mixParam->load());
 }
 
 void FlangerProcessor::releaseResources()
@@ -110,8 +138,13 @@ bool FlangerProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
 }
 
-void FlangerProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void FlangerProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Flanger::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -131,6 +164,7 @@ void FlangerProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
 
 void FlangerProcessor::processFlanger(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Flanger::processFlanger");
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
     
@@ -138,24 +172,58 @@ void FlangerProcessor::processFlanger(juce::AudioBuffer<float>& buffer)
         return;
     
     // Get parameter values
-    float mix = mixParam->load();
+    mixRamp.setTarget(mixParam->load());
+    const auto* mixes = mixRamp.process(numSamples);
     float rate = rateParam->load();
     float depth = depthParam->load();
     float feedback = feedbackParam->load();
     float delayMs = delayParam->load();
     float phaseOffset = phaseParam->load();
     
-    // Update filters if needed
-    updateFilters();
-    
-    // Calculate LFO increment
-    float lfoIncrement = (rate * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+    // Glide to cut filter coefficients published since the last block
+    if (cutFilters.update(isNonRealtime()))
+    {
+        const auto& coefficients = cutFilters.get();
+        leftLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        rightLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        leftHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+        rightHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+    }
     
+    const float samplesPerMs = static_cast<float>(currentSampleRate) / 1000.0f;
+
     // Convert phase offset to radians
     float phaseOffsetRad = (phaseOffset / 180.0f) * juce::MathConstants<float>::pi;
     
+    // The right LFO runs the phase offset ahead of the left
+    float rightPhase = leftLfo.getPhase() + phaseOffsetRad;
+    if (rightPhase >= juce::MathConstants<float>::twoPi)
+        rightPhase -= juce::MathConstants<float>::twoPi;
+    
+    leftLfo.setFrequency(rate, currentSampleRate);
+    rightLfo.setFrequency(rate, currentSampleRate);
+    rightLfo.setPhase(rightPhase);
+    
+    // Sweep the delay times at the control rate, in samples; the LFOs' sin
+    // runs once per control point instead of once per sample
+    const int controlInterval = HyperPrismModulation::getControlInterval(modulationQualityParam->load());
+    
+    auto sweepDelay = [&](HyperPrismDSP::SineLfo& lfo, HyperPrismDSP::ControlSignal& signal)
+    {
+        signal.setInterval(controlInterval);
+        return signal.process(numSamples, [&](int)
+        {
+            // Apply depth, keeping the delay time positive
+            const float lfoValue = lfo.getNextSample(signal.getInterval());
+            return juce::jmax(0.1f, delayMs + (lfoValue * depth * delayMs)) * samplesPerMs;
+        });
+    };
+    
+    const auto* leftDelays = sweepDelay(leftLfo, leftDelaySignal);
+    const auto* rightDelays = sweepDelay(rightLfo, rightDelaySignal);
+    
     // Create a copy for dry signal
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     // Get audio data
     auto* leftChannel = buffer.getWritePointer(0);
@@ -164,76 +232,37 @@ void FlangerProcessor::processFlanger(juce::AudioBuffer<float>& buffer)
     // Process each sample
     for (int sample = 0; sample < numSamples; ++sample)
     {
-        // Calculate LFO values with phase offset
-        float lfoLeft = std::sin(lfoPhase);
-        float lfoRight = std::sin(lfoPhaseRight);
-        
-        // Apply depth and calculate modulated delay times
-        float leftDelayTime = delayMs + (lfoLeft * depth * delayMs);
-        float rightDelayTime = delayMs + (lfoRight * depth * delayMs);
-        
-        // Ensure positive delay times
-        leftDelayTime = juce::jmax(0.1f, leftDelayTime);
-        rightDelayTime = juce::jmax(0.1f, rightDelayTime);
-        
         // Process left channel
         float leftInput = leftChannel[sample];
-        float leftFlanger = leftDelayLine.processSample(leftInput, leftDelayTime, feedback);
+        float leftFlanger = leftDelayLine.readLinear(leftDelays[sample]);
+        leftDelayLine.push(leftInput + (leftFlanger * feedback));
         
         // Apply filtering
-        leftFlanger = leftLowCut.processSingleSampleRaw(leftFlanger);
-        leftFlanger = leftHighCut.processSingleSampleRaw(leftFlanger);
+        leftFlanger = leftLowCut.processSample(leftFlanger);
+        leftFlanger = leftHighCut.processSample(leftFlanger);
         
         // Process right channel
         float rightInput = rightChannel[sample];
-        float rightFlanger = rightDelayLine.processSample(rightInput, rightDelayTime, feedback);
+        float rightFlanger = rightDelayLine.readLinear(rightDelays[sample]);
+        rightDelayLine.push(rightInput + (rightFlanger * feedback));
         
         // Apply filtering
-        rightFlanger = rightLowCut.processSingleSampleRaw(rightFlanger);
-        rightFlanger = rightHighCut.processSingleSampleRaw(rightFlanger);
+        rightFlanger = rightLowCut.processSample(rightFlanger);
+        rightFlanger = rightHighCut.processSample(rightFlanger);
         
         // Mix wet and dry signals
-        leftChannel[sample] = leftInput + (mix * (leftFlanger - leftInput));
-        rightChannel[sample] = rightInput + (mix * (rightFlanger - rightInput));
-        
-        // Advance LFO phases
-        lfoPhase += lfoIncrement;
-        lfoPhaseRight = lfoPhase + phaseOffsetRad;
-        
-        // Wrap phases
-        if (lfoPhase >= juce::MathConstants<float>::twoPi)
-            lfoPhase -= juce::MathConstants<float>::twoPi;
-        if (lfoPhaseRight >= juce::MathConstants<float>::twoPi)
-            lfoPhaseRight -= juce::MathConstants<float>::twoPi;
-        if (lfoPhaseRight < 0.0f)
-            lfoPhaseRight += juce::MathConstants<float>::twoPi;
-    }
-}
-
-void FlangerProcessor::updateFilters()
-{
-    float lowCutFreq = lowCutParam->load();
-    float highCutFreq = highCutParam->load();
-    
-    // Only update if frequencies changed
-    if (std::abs(lowCutFreq - previousFilterFreq) > 0.1f || 
-        std::abs(highCutFreq - previousFilterFreq) > 0.1f)
-    {
-        // High-pass filter (low cut)
-        leftLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        rightLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        
-        // Low-pass filter (high cut)
-        leftHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-        rightHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-        
-        previousFilterFreq = lowCutFreq; // Track one of them
+        leftChannel[sample] = leftInput + (mixes[sample] * (leftFlanger - leftInput));
+        rightChannel[sample] = rightInput + (mixes[sample] * (rightFlanger - rightInput));
     }
 }
 
 juce::AudioProcessorEditor* FlangerProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new FlangerEditor(*this);
+   #endif
 }
 
 void FlangerProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -251,50 +280,11 @@ void FlangerProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-// FlangerDelayLine implementation
-void FlangerProcessor::FlangerDelayLine::prepare(double rate, float maxDelayMs)
-{
-    sampleRate = rate;
-    maxDelaySamples = static_cast<int>((maxDelayMs / 1000.0f) * sampleRate) + 1;
-    buffer.setSize(1, maxDelaySamples);
-    reset();
-}
-
-void FlangerProcessor::FlangerDelayLine::reset()
+void FlangerProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
 {
-    buffer.clear();
-    writeIndex = 0;
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay lines", leftDelayLine.getAllocatedBytes() + rightDelayLine.getAllocatedBytes());
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("control signals", leftDelaySignal.getAllocatedBytes() + rightDelaySignal.getAllocatedBytes());
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes());
 }
-
-float FlangerProcessor::FlangerDelayLine::processSample(float input, float delayMs, float feedback)
-{
-    if (maxDelaySamples == 0)
-        return input;
-    
-    // Convert delay time to samples
-    float delaySamples = (delayMs / 1000.0f) * static_cast<float>(sampleRate);
-    delaySamples = juce::jlimit(0.1f, static_cast<float>(maxDelaySamples - 1), delaySamples);
-    
-    // Calculate read position with fractional delay
-    float readPosition = writeIndex - delaySamples;
-    if (readPosition < 0.0f)
-        readPosition += maxDelaySamples;
-    
-    // Linear interpolation for fractional delay
-    int readIndex1 = static_cast<int>(readPosition);
-    int readIndex2 = (readIndex1 + 1) % maxDelaySamples;
-    float fraction = readPosition - readIndex1;
-    
-    auto* bufferData = buffer.getReadPointer(0);
-    float delayedSample = bufferData[readIndex1] * (1.0f - fraction) + 
-                         bufferData[readIndex2] * fraction;
-    
-    // Write input plus feedback to delay line
-    auto* writeData = buffer.getWritePointer(0);
-    writeData[writeIndex] = input + (delayedSample * feedback);
-    
-    // Advance write index
-    writeIndex = (writeIndex + 1) % maxDelaySamples;
-    
-    return delayedSample;
-}
\ No newline at end of file
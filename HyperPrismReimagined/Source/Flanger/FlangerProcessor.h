@@ -5,8 +5,18 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../Shared/ModulationQuality.h"
+#include "../DSP/ControlSignal.h"
+#include "../DSP/DelayLine.h"
+#include "../DSP/Lfo.h"
+#include "../DSP/ParameterRamp.h"
 
-class FlangerProcessor : public juce::AudioProcessor
+class FlangerProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     FlangerProcessor();
@@ -20,7 +30,11 @@ public:
     
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
     
     // Program/State
     const juce::String getName() const override { return "HyperPrism Reimagined Flanger"; }
@@ -51,6 +65,13 @@ public:
     static const juce::String PHASE_ID;
     static const juce::String LOW_CUT_ID;
     static const juce::String HIGH_CUT_ID;
+    static const juce::String MODULATION_QUALITY_ID;
+
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
 
 private:
     // Parameter layout
@@ -58,34 +79,21 @@ private:
     
     // Audio processing
     void processFlanger(juce::AudioBuffer<float>& buffer);
-    void updateFilters();
-    
-    // Flanger delay line class
-    class FlangerDelayLine
-    {
-    public:
-        void prepare(double sampleRate, float maxDelayMs);
-        void reset();
-        float processSample(float input, float delayMs, float feedback);
-        
-    private:
-        juce::AudioBuffer<float> buffer;
-        int writeIndex = 0;
-        int maxDelaySamples = 0;
-        double sampleRate = 44100.0;
-    };
     
     // State
     juce::AudioProcessorValueTreeState valueTreeState;
     
     // DSP components
-    FlangerDelayLine leftDelayLine, rightDelayLine;
-    juce::IIRFilter leftLowCut, rightLowCut;
-    juce::IIRFilter leftHighCut, rightHighCut;
+    HyperPrismDSP::DelayLine leftDelayLine, rightDelayLine;
+    HyperPrismDSP::Biquad leftLowCut, rightLowCut;
+    HyperPrismDSP::Biquad leftHighCut, rightHighCut;
+
+    // Cut filter coefficients, computed off the audio thread
+    HyperPrismCoefficients::Cache<HyperPrismCoefficients::CutFilters> cutFilters;
     
-    // LFO for modulation
-    float lfoPhase = 0.0f;
-    float lfoPhaseRight = 0.0f;
+    // LFOs for modulation, and the delay times (in samples) they sweep at the control rate
+    HyperPrismDSP::SineLfo leftLfo, rightLfo;
+    HyperPrismDSP::ControlSignal leftDelaySignal, rightDelaySignal;
     
     // Cached parameters
     std::atomic<float>* bypassParam = nullptr;
@@ -97,12 +105,19 @@ private:
     std::atomic<float>* phaseParam = nullptr;
     std::atomic<float>* lowCutParam = nullptr;
     std::atomic<float>* highCutParam = nullptr;
+    std::atomic<float>* modulationQualityParam = nullptr;
     
     // Processing state
     double currentSampleRate = 44100.0;
-    float previousFilterFreq = -1.0f;
 
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlangerProcessor)
 };
\ No newline at end of file
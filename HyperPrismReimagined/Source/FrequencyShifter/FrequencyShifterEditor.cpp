@@ -5,6 +5,8 @@
 
 #include "FrequencyShifterEditor.h"
 
+namespace HyperPrismFrequencyShifterUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -181,6 +183,7 @@ void FrequencyShiftMeter::resized()
 
 void FrequencyShiftMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("FrequencyShiftMeter::timerCallback");
     float newInputLevel = audioProcessor.getInputLevel();
     float newOutputLevel = audioProcessor.getOutputLevel();
     
@@ -196,9 +199,10 @@ void FrequencyShiftMeter::timerCallback()
 // FrequencyShifterEditor Implementation
 //==============================================================================
 FrequencyShifterEditor::FrequencyShifterEditor(FrequencyShifterProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), frequencyShiftMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), frequencyShiftMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(FrequencyShifterProcessor::FREQUENCY_SHIFT_ID);
@@ -314,6 +318,7 @@ FrequencyShifterEditor::~FrequencyShifterEditor()
 
 void FrequencyShifterEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("FrequencyShifterEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -349,7 +354,7 @@ void FrequencyShifterEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -633,4 +638,6 @@ void FrequencyShifterEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismFrequencyShifterUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "FrequencyShifterProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismFrequencyShifterUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -150,5 +153,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrequencyShifterEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismFrequencyShifterUI
+
+using HyperPrismFrequencyShifterUI::FrequencyShifterEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "FrequencyShifterProcessor.h"
-#include "FrequencyShifterEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "FrequencyShifterEditor.h"
+#endif
 
 //==============================================================================
 // HilbertTransform Implementation
@@ -39,6 +41,13 @@ void FrequencyShifterProcessor::HilbertTransform::reset()
     delayLine.reset();
 }
 
+void FrequencyShifterProcessor::HilbertTransform::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("Hilbert FIR coefficients", hilbertCoefficients);
+    footprint.add("Hilbert delay compensation", HyperPrismMemory::bytesOf(delayLine, 1));
+    footprint.addUntracked("Hilbert FIR state");
+}
+
 void FrequencyShifterProcessor::HilbertTransform::processBlock(juce::AudioBuffer<float>& buffer)
 {
     for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
@@ -198,9 +207,17 @@ juce::AudioProcessorValueTreeState::ParameterLayout FrequencyShifterProcessor::c
 //==============================================================================
 void FrequencyShifterProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
+
     // Prepare DSP components with actual buffer size (fixes 512-sample artifact bug)
     hilbertTransform.prepare(sampleRate, samplesPerBlock);
     oscillator.prepare(sampleRate);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    mixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    outputGainRamp.prepare(sampleRate, 0.02, scratchCapacity);
+    mixRamp.setCurrentAndTarget(mixParam->load() * 0.01f);
+    outputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     inputLevel.store(0.0f);
@@ -224,8 +241,13 @@ bool FrequencyShifterProcessor::isBusesLayoutSupported(const BusesLayout& layout
     return true;
 }
 
-void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("FrequencyShifter::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -245,13 +267,16 @@ void FrequencyShifterProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 
 void FrequencyShifterProcessor::processFrequencyShifting(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("FrequencyShifter::processFrequencyShifting");
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
     
     const float frequencyShift = frequencyShiftParam->load();
     const float fineShift = fineShiftParam->load();
-    const float mix = mixParam->load() * 0.01f; // Convert percentage to 0-1
-    const float outputLevelGain = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    mixRamp.setTarget(mixParam->load() * 0.01f); // Convert percentage to 0-1
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* mixes = mixRamp.process(numSamples);
+    const auto* outputGains = outputGainRamp.process(numSamples);
     
     // Calculate total frequency shift (coarse + fine)
     float totalShift = frequencyShift + (fineShift * 0.01f * frequencyShift); // Fine as percentage of coarse
@@ -284,10 +309,10 @@ void FrequencyShifterProcessor::processFrequencyShifting(juce::AudioBuffer<float
             float shiftedReal = real * cosShift - imaginary * sinShift;
             
             // Mix dry and wet signals
-            float output = input * (1.0f - mix) + shiftedReal * mix;
+            float output = input * (1.0f - mixes[sample]) + shiftedReal * mixes[sample];
             
             // Apply output level
-            output *= outputLevelGain;
+            output *= outputGains[sample];
             
             channelData[sample] = output;
             outputLevelSum += std::abs(output);
@@ -302,7 +327,11 @@ void FrequencyShifterProcessor::processFrequencyShifting(juce::AudioBuffer<float
 //==============================================================================
 juce::AudioProcessorEditor* FrequencyShifterProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new FrequencyShifterEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -317,4 +346,11 @@ void FrequencyShifterProcessor::setStateInformation(const void* data, int sizeIn
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void FrequencyShifterProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    hilbertTransform.describeMemory(footprint);
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes() + outputGainRamp.getAllocatedBytes());
 }
\ No newline at end of file
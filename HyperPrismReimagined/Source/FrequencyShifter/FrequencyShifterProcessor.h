@@ -5,8 +5,13 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 
-class FrequencyShifterProcessor : public juce::AudioProcessor
+class FrequencyShifterProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +28,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Frequency Shifter"; }
@@ -58,6 +67,12 @@ public:
     float getInputLevel() const { return inputLevel.load(); }
     float getOutputLevel() const { return outputLevel.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     class HilbertTransform
@@ -70,6 +85,7 @@ private:
         
         void processBlock(juce::AudioBuffer<float>& buffer);
         std::pair<float, float> processSample(float input); // Returns {real, imaginary}
+        void describeMemory(HyperPrismMemory::Footprint& footprint) const;
         
     private:
         static constexpr int filterOrder = 256;
@@ -116,10 +132,18 @@ private:
     // DSP components
     HilbertTransform hilbertTransform;
     Oscillator oscillator;
+
+    // Mix and output level ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    HyperPrismDSP::ParameterRamp outputGainRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Metering
     std::atomic<float> inputLevel { 0.0f };
     std::atomic<float> outputLevel { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrequencyShifterProcessor)
 };
\ No newline at end of file
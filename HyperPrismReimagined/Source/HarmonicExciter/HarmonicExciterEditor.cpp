@@ -5,6 +5,8 @@
 
 #include "HarmonicExciterEditor.h"
 
+namespace HyperPrismHarmonicExciterUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // HarmonicExciterEditor Implementation
 //==============================================================================
 HarmonicExciterEditor::HarmonicExciterEditor(HarmonicExciterProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(DRIVE_ID);
@@ -262,6 +265,7 @@ HarmonicExciterEditor::~HarmonicExciterEditor()
 
 void HarmonicExciterEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("HarmonicExciterEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -297,7 +301,7 @@ void HarmonicExciterEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -627,4 +631,6 @@ void HarmonicExciterEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismHarmonicExciterUI
\ No newline at end of file
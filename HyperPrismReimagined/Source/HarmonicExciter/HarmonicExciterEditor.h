@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "HarmonicExciterProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismHarmonicExciterUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -132,5 +135,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HarmonicExciterEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismHarmonicExciterUI
+
+using HyperPrismHarmonicExciterUI::HarmonicExciterEditor;
\ No newline at end of file
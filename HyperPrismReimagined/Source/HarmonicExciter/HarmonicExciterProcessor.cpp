@@ -1,5 +1,7 @@
 #include "HarmonicExciterProcessor.h"
-#include "HarmonicExciterEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "HarmonicExciterEditor.h"
+#endif
 
 HarmonicExciterProcessor::HarmonicExciterProcessor()
     : AudioProcessor(BusesProperties()
@@ -90,6 +92,7 @@ void HarmonicExciterProcessor::changeProgramName(int index, const juce::String&
 
 void HarmonicExciterProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     juce::dsp::ProcessSpec spec;
@@ -105,8 +108,12 @@ void HarmonicExciterProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     highPassFilter.setCutoffFrequency(frequencyParam->get());
     lowPassFilter.setCutoffFrequency(frequencyParam->get());
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
-    highFreqBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+    highFreqBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    mixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    mixRamp.setCurrentAndTarget(mixParam->get() / 100.0f);
 }
 
 void HarmonicExciterProcessor::releaseResources()
@@ -123,6 +130,11 @@ bool HarmonicExciterProcessor::isBusesLayoutSupported(const BusesLayout& layouts
 
 void HarmonicExciterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("HarmonicExciter::processBlock");
     juce::ignoreUnused(midiMessages);
 
     juce::ScopedNoDenormals noDenormals;
@@ -139,7 +151,8 @@ void HarmonicExciterProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     const float drive = driveParam->get() / 100.0f;
     const float frequency = frequencyParam->get();
     const float harmonics = harmonicsParam->get();
-    const float mix = mixParam->get() / 100.0f;
+    mixRamp.setTarget(mixParam->get() / 100.0f);
+    const auto* mixes = mixRamp.process(buffer.getNumSamples());
     const int type = typeParam->getIndex();
 
     // Update filter frequencies
@@ -186,7 +199,7 @@ void HarmonicExciterProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
             }
 
             // Mix dry and processed signals
-            channelData[sample] = dryData[sample] + (processedSample * mix);
+            channelData[sample] = dryData[sample] + (processedSample * mixes[sample]);
         }
     }
 
@@ -231,12 +244,20 @@ float HarmonicExciterProcessor::generateBrightHarmonics(float input, float drive
 
 bool HarmonicExciterProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* HarmonicExciterProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new HarmonicExciterEditor(*this);
+   #endif
 }
 
 void HarmonicExciterProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -264,4 +285,12 @@ void HarmonicExciterProcessor::setStateInformation(const void* data, int sizeInB
         *mixParam = xmlState->getDoubleAttribute("mix", mixParam->get());
         *typeParam = xmlState->getIntAttribute("type", typeParam->getIndex());
     }
+}
+
+void HarmonicExciterProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("high-band buffer", highFreqBuffer);
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes());
 }
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 
-class HarmonicExciterProcessor : public juce::AudioProcessor
+class HarmonicExciterProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     HarmonicExciterProcessor();
@@ -45,6 +50,12 @@ public:
     // Get current output level for metering
     float getCurrentOutputLevel() const { return outputLevel.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Processing components
     juce::dsp::LinkwitzRileyFilter<float> highPassFilter;
@@ -59,10 +70,17 @@ private:
     // Pre-allocated buffers
     juce::AudioBuffer<float> dryBuffer;
     juce::AudioBuffer<float> highFreqBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
 
     // Harmonic generation functions
     float generateWarmHarmonics(float input, float drive, float harmonics);
     float generateBrightHarmonics(float input, float drive, float harmonics);
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HarmonicExciterProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "HighPassEditor.h"
 
+namespace HyperPrismHighPassUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // HighPassEditor Implementation
 //==============================================================================
 HighPassEditor::HighPassEditor(HighPassProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(HighPassProcessor::FREQUENCY_ID);
@@ -207,6 +210,7 @@ HighPassEditor::~HighPassEditor()
 
 void HighPassEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("HighPassEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -242,7 +246,7 @@ void HighPassEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -521,4 +525,6 @@ void HighPassEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismHighPassUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "HighPassProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismHighPassUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -125,5 +128,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HighPassEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismHighPassUI
+
+using HyperPrismHighPassUI::HighPassEditor;
\ No newline at end of file
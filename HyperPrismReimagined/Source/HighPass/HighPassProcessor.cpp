@@ -3,14 +3,32 @@
 //==============================================================================
 
 #include "HighPassProcessor.h"
-#include "HighPassEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "HighPassEditor.h"
+#endif
+
+namespace
+{
+    using Param = HighPassProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        boolParameter(Param::bypass, "bypass", "Bypass", false),
+        floatParameter(Param::frequency, "frequency", "Frequency", 20.0f, 20000.0f, 1.0f, 0.3f, 1000.0f, 0, " Hz"),
+        floatParameter(Param::resonance, "resonance", "Resonance", 0.0f, 100.0f, 0.1f, 1.0f, 10.0f, 1, " %"),
+        floatParameter(Param::gain, "gain", "Gain", -24.0f, 24.0f, 0.1f, 1.0f, 0.0f, 1, " dB"),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 100.0f, 1, " %")
+    }}};
+
+    static_assert(parameterTable.isValid(), "HighPass parameter table out of step with HighPassProcessor::Param");
+}
 
 // Parameter IDs
-const juce::String HighPassProcessor::BYPASS_ID = "bypass";
-const juce::String HighPassProcessor::FREQUENCY_ID = "frequency";
-const juce::String HighPassProcessor::RESONANCE_ID = "resonance";
-const juce::String HighPassProcessor::GAIN_ID = "gain";
-const juce::String HighPassProcessor::MIX_ID = "mix";
+const juce::String HighPassProcessor::BYPASS_ID = parameterTable[Param::bypass].id;
+const juce::String HighPassProcessor::FREQUENCY_ID = parameterTable[Param::frequency].id;
+const juce::String HighPassProcessor::RESONANCE_ID = parameterTable[Param::resonance].id;
+const juce::String HighPassProcessor::GAIN_ID = parameterTable[Param::gain].id;
+const juce::String HighPassProcessor::MIX_ID = parameterTable[Param::mix].id;
 
 //==============================================================================
 HighPassProcessor::HighPassProcessor()
@@ -24,7 +42,8 @@ HighPassProcessor::HighPassProcessor()
                      #endif
                        ),
 #endif
-    valueTreeState(*this, nullptr, "PARAMETERS", createParameterLayout())
+    valueTreeState(*this, nullptr, "PARAMETERS", HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(valueTreeState, parameterTable)
 {
 }
 
@@ -35,7 +54,7 @@ HighPassProcessor::~HighPassProcessor()
 //==============================================================================
 const juce::String HighPassProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined High-Pass Filter";
 }
 
 bool HighPassProcessor::acceptsMidi() const
@@ -96,6 +115,7 @@ void HighPassProcessor::changeProgramName(int index, const juce::String& newName
 //==============================================================================
 void HighPassProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     juce::dsp::ProcessSpec spec;
@@ -105,22 +125,16 @@ void HighPassProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     
     highPassFilter.prepare(spec);
     
-    // Initialize smoothed values
-    const float smoothTime = 0.005f; // 5ms smoothing for real-time response
-    frequencySmoothed.reset(sampleRate, smoothTime);
-    resonanceSmoothed.reset(sampleRate, smoothTime);
-    gainSmoothed.reset(sampleRate, smoothTime);
-    mixSmoothed.reset(sampleRate, smoothTime);
-    
-    // Set initial values
-    frequencySmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(FREQUENCY_ID)->load());
-    resonanceSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(RESONANCE_ID)->load());
-    gainSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(GAIN_ID)->load());
-    mixSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(MIX_ID)->load());
-    
     updateFilter();
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.005; // 5ms smoothing for real-time response
+    gainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    gainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(parameterValues.get(Param::gain)));
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void HighPassProcessor::releaseResources()
@@ -149,8 +163,13 @@ bool HighPassProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 }
 #endif
 
-void HighPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void HighPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("HighPass::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -158,18 +177,14 @@ void HighPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    const auto values = parameterValues.snapshot();
+
     // Check bypass
-    if (valueTreeState.getRawParameterValue(BYPASS_ID)->load() > 0.5f)
+    if (values.isOn(Param::bypass))
         return;
 
-    // Update smoothed parameters
-    frequencySmoothed.setTargetValue(valueTreeState.getRawParameterValue(FREQUENCY_ID)->load());
-    resonanceSmoothed.setTargetValue(valueTreeState.getRawParameterValue(RESONANCE_ID)->load());
-    gainSmoothed.setTargetValue(valueTreeState.getRawParameterValue(GAIN_ID)->load());
-    mixSmoothed.setTargetValue(valueTreeState.getRawParameterValue(MIX_ID)->load());
-
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
 
     // Always update filter to ensure real-time parameter changes
     updateFilter();
@@ -180,39 +195,36 @@ void HighPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
     highPassFilter.process(context);
 
     // Apply gain
-    float currentGain = juce::Decibels::decibelsToGain(valueTreeState.getRawParameterValue(GAIN_ID)->load());
+    const int numSamples = buffer.getNumSamples();
+    gainRamp.setTarget(juce::Decibels::decibelsToGain(values[Param::gain]));
+    mixRamp.setTarget(values[Param::mix] * 0.01f); // Convert percentage to ratio
+    const auto* gains = gainRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
+
     for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= currentGain;
-        }
-    }
+        HyperPrismLargeBlocks::applyGain(buffer.getWritePointer(channel), gains, gainRamp.isConstant(), numSamples);
 
     // Mix dry and wet signals
-    float mixValue = valueTreeState.getRawParameterValue(MIX_ID)->load() * 0.01f; // Convert percentage to ratio
-    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* wetData = buffer.getWritePointer(channel);
-        auto* dryData = dryBuffer.getReadPointer(channel);
-        
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            wetData[sample] = dryData[sample] * (1.0f - mixValue) + wetData[sample] * mixValue;
-        }
-    }
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumOutputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 //==============================================================================
 bool HighPassProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* HighPassProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new HighPassEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -231,11 +243,19 @@ void HighPassProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void HighPassProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", gainRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+}
+
 //==============================================================================
 void HighPassProcessor::updateFilter()
 {
-    float frequency = valueTreeState.getRawParameterValue(FREQUENCY_ID)->load();
-    float resonance = valueTreeState.getRawParameterValue(RESONANCE_ID)->load();
+    HYPERPRISM_TRACE_SCOPE("HighPass::updateFilter");
+    float frequency = parameterValues.get(Param::frequency);
+    float resonance = parameterValues.get(Param::resonance);
     
     // Clamp frequency to valid range
     frequency = juce::jlimit(20.0f, static_cast<float>(currentSampleRate * 0.45), frequency);
@@ -247,37 +267,3 @@ void HighPassProcessor::updateFilter()
     auto coefficients = CoefficientsType::makeHighPass(currentSampleRate, frequency, q);
     *highPassFilter.state = *coefficients;
 }
-
-juce::AudioProcessorValueTreeState::ParameterLayout HighPassProcessor::createParameterLayout()
-{
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID, "Bypass", false));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        FREQUENCY_ID, "Frequency", 
-        juce::NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.3f), 1000.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 0) + " Hz"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        RESONANCE_ID, "Resonance", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 10.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        GAIN_ID, "Gain", 
-        juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " dB"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID, "Mix", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 100.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    return { parameters.begin(), parameters.end() };
-}
\ No newline at end of file
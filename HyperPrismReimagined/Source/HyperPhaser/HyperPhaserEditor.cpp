@@ -5,6 +5,8 @@
 
 #include "HyperPhaserEditor.h"
 
+namespace HyperPrismHyperPhaserUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // HyperPhaserEditor Implementation
 //==============================================================================
 HyperPhaserEditor::HyperPhaserEditor(HyperPhaserProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(HyperPhaserProcessor::BASE_FREQ_ID);
@@ -225,6 +228,7 @@ HyperPhaserEditor::~HyperPhaserEditor()
 
 void HyperPhaserEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("HyperPhaserEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -269,7 +273,7 @@ void HyperPhaserEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -559,4 +563,6 @@ void HyperPhaserEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismHyperPhaserUI
\ No newline at end of file
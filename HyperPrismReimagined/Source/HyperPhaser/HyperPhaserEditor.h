@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "HyperPhaserProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismHyperPhaserUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -133,5 +136,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HyperPhaserEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismHyperPhaserUI
+
+using HyperPrismHyperPhaserUI::HyperPhaserEditor;
\ No newline at end of file
@@ -3,7 +3,28 @@
 //==============================================================================
 
 #include "HyperPhaserProcessor.h"
-#include "HyperPhaserEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "HyperPhaserEditor.h"
+#endif
+
+namespace
+{
+    using Param = HyperPhaserProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        labelledFloatParameter(Param::baseFreq, HyperPhaserProcessor::BASE_FREQ_ID, "Base Frequency", 20.0f, 20000.0f, 1.0f, 0.5f, 1000.0f, "Hz"),
+        labelledFloatParameter(Param::sweepRate, HyperPhaserProcessor::SWEEP_RATE_ID, "Sweep Rate", 0.01f, 20.0f, 0.01f, 0.5f, 0.5f, "Hz"),
+        labelledFloatParameter(Param::peakNotchDepth, HyperPhaserProcessor::PEAK_NOTCH_DEPTH_ID, "Peak/Notch Depth", -200.0f, 200.0f, 1.0f, 1.0f, 150.0f, "%"),
+        labelledFloatParameter(Param::bandwidth, HyperPhaserProcessor::BANDWIDTH_ID, "Bandwidth", 0.0f, 100.0f, 1.0f, 1.0f, 50.0f, "%"),
+        labelledFloatParameter(Param::feedback, HyperPhaserProcessor::FEEDBACK_ID, "Feedback", 0.0f, 100.0f, 1.0f, 1.0f, 50.0f, "%"),
+        labelledFloatParameter(Param::mix, HyperPhaserProcessor::MIX_ID, "Mix", 0.0f, 100.0f, 1.0f, 1.0f, 100.0f, "%"),
+        boolParameter(Param::bypass, HyperPhaserProcessor::BYPASS_ID, "Bypass", false),
+        HyperPrismModulation::qualityParameter(Param::modulationQuality)
+    }}};
+
+    static_assert(parameterTable.isValid(), "HyperPhaser parameter table out of step with HyperPhaserProcessor::Param");
+}
 
 HyperPhaserProcessor::HyperPhaserProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -16,91 +37,45 @@ HyperPhaserProcessor::HyperPhaserProcessor()
                      #endif
                        ),
 #endif
-    parameters(*this, nullptr, juce::Identifier("HyperPhaser"), createParameterLayout())
+    parameters(*this, nullptr, juce::Identifier("HyperPhaser"), HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(parameters, parameterTable)
 {
-    // Initialize smoothed values
-    baseFreqSmoothed.reset(50);
-    sweepRateSmoothed.reset(50);
-    depthSmoothed.reset(50);
-    bandwidthSmoothed.reset(50);
-    feedbackSmoothed.reset(50);
-    mixSmoothed.reset(50);
 }
 
 HyperPhaserProcessor::~HyperPhaserProcessor()
 {
 }
 
-juce::AudioProcessorValueTreeState::ParameterLayout HyperPhaserProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        BASE_FREQ_ID,
-        "Base Frequency",
-        juce::NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.5f),
-        1000.0f,
-        "Hz"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        SWEEP_RATE_ID,
-        "Sweep Rate",
-        juce::NormalisableRange<float>(0.01f, 20.0f, 0.01f, 0.5f),
-        0.5f,
-        "Hz"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        PEAK_NOTCH_DEPTH_ID,
-        "Peak/Notch Depth",
-        juce::NormalisableRange<float>(-200.0f, 200.0f, 1.0f),
-        150.0f,
-        "%"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        BANDWIDTH_ID,
-        "Bandwidth",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
-        50.0f,
-        "%"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        FEEDBACK_ID,
-        "Feedback",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
-        50.0f,
-        "%"));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID,
-        "Mix",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
-        100.0f,
-        "%"));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID,
-        "Bypass",
-        false));
-
-    return layout;
-}
-
 void HyperPhaserProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = static_cast<float>(sampleRate);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    
+    // Reset channel states; the sweep starts from the base frequency, where
+    // the LFO's zero phase puts it
+    const int controlInterval = HyperPrismModulation::getControlInterval(parameterValues.get(Param::modulationQuality));
     
-    // Reset channel states
     for (auto& channel : channelStates)
+    {
         channel.reset();
+        channel.coefficients.prepare(controlInterval, scratchCapacity);
+        channel.coefficients.reset(calculateAllpassCoefficient(parameterValues.get(Param::baseFreq)));
+    }
     
-    // Set smoothing rates
+    // Set ramp rates
     const double smoothingTime = 0.05; // 50ms
-    baseFreqSmoothed.reset(sampleRate, smoothingTime);
-    sweepRateSmoothed.reset(sampleRate, smoothingTime);
-    depthSmoothed.reset(sampleRate, smoothingTime);
-    bandwidthSmoothed.reset(sampleRate, smoothingTime);
-    feedbackSmoothed.reset(sampleRate, smoothingTime);
-    mixSmoothed.reset(sampleRate, smoothingTime);
+    baseFreqRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+    sweepRateRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+    depthRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+    feedbackRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, smoothingTime, scratchCapacity);
+
+    baseFreqRamp.setCurrentAndTarget(parameterValues.get(Param::baseFreq));
+    sweepRateRamp.setCurrentAndTarget(parameterValues.get(Param::sweepRate));
+    depthRamp.setCurrentAndTarget(parameterValues.get(Param::peakNotchDepth));
+    feedbackRamp.setCurrentAndTarget(parameterValues.get(Param::feedback) * 0.01f);
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void HyperPhaserProcessor::releaseResources()
@@ -151,6 +126,11 @@ float HyperPhaserProcessor::processPeakNotchDepth(float input, float depth)
 
 void HyperPhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("HyperPhaser::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const int totalNumInputChannels = getTotalNumInputChannels();
     const int totalNumOutputChannels = getTotalNumOutputChannels();
@@ -161,17 +141,29 @@ void HyperPhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
         buffer.clear(i, 0, numSamples);
 
     // Get parameter values
-    const bool bypassed = parameters.getRawParameterValue(BYPASS_ID)->load() > 0.5f;
+    const auto values = parameterValues.snapshot();
+    const bool bypassed = values.isOn(Param::bypass);
     if (bypassed)
         return;
 
-    // Get current parameter values directly for real-time response
-    const float baseFreq = parameters.getRawParameterValue(BASE_FREQ_ID)->load();
-    const float sweepRate = parameters.getRawParameterValue(SWEEP_RATE_ID)->load();
-    const float depth = parameters.getRawParameterValue(PEAK_NOTCH_DEPTH_ID)->load();
-    const float bandwidth = parameters.getRawParameterValue(BANDWIDTH_ID)->load();
-    const float feedback = parameters.getRawParameterValue(FEEDBACK_ID)->load() * 0.01f;
-    const float mix = parameters.getRawParameterValue(MIX_ID)->load() * 0.01f;
+    // Render this block's parameter ramps, shared by both channels; the
+    // bandwidth picks a stage count, so it holds for the block
+    baseFreqRamp.setTarget(values[Param::baseFreq]);
+    sweepRateRamp.setTarget(values[Param::sweepRate]);
+    depthRamp.setTarget(values[Param::peakNotchDepth]);
+    feedbackRamp.setTarget(values[Param::feedback] * 0.01f);
+    mixRamp.setTarget(values[Param::mix] * 0.01f);
+
+    const auto* baseFreqs = baseFreqRamp.process(numSamples);
+    const auto* sweepRates = sweepRateRamp.process(numSamples);
+    const auto* depths = depthRamp.process(numSamples);
+    const auto* feedbacks = feedbackRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
+    const float bandwidth = values[Param::bandwidth];
+    const int controlInterval = HyperPrismModulation::getControlInterval(values[Param::modulationQuality]);
+
+    const float bandwidthFactor = 1.0f + (bandwidth / 100.0f) * 3.0f; // 1 to 4 stages based on bandwidth
+    const int activeStages = juce::jmin(static_cast<int>(bandwidthFactor * 2.0f), static_cast<int>(ChannelState::NUM_STAGES)); // 2 to 8 stages
 
     // Process each channel
     const int numChannels = juce::jmin(totalNumInputChannels, 2);
@@ -181,28 +173,31 @@ void HyperPhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
         auto* channelData = buffer.getWritePointer(channel);
         auto& state = channelStates[channel];
         
+        // Sweep the allpass coefficient at the control rate: the LFO, exp2 and
+        // coefficient run once per control point, not once per sample
+        state.coefficients.setInterval(controlInterval);
+        const auto* coefficients = state.coefficients.process(numSamples, [&](int sample)
+        {
+            state.lfo.setFrequency(sweepRates[sample], currentSampleRate);
+            const float lfoValue = state.lfo.getNextSample(state.coefficients.getInterval());
+            const float modulatedFreq = baseFreqs[sample] * std::exp2f(lfoValue);
+            return calculateAllpassCoefficient(modulatedFreq);
+        });
+        
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            
-            // Update LFO
-            const float lfoValue = std::sin(state.lfoPhase);
-            state.lfoPhase += 2.0f * juce::MathConstants<float>::pi * sweepRate / currentSampleRate;
-            if (state.lfoPhase >= 2.0f * juce::MathConstants<float>::pi)
-                state.lfoPhase -= 2.0f * juce::MathConstants<float>::pi;
-            
-            // Calculate modulated frequency
-            const float modulatedFreq = baseFreq * std::exp2f(lfoValue);
-            
+            const float depth = depths[sample];
+            const float feedback = feedbacks[sample];
+            const float mix = mixes[sample];
+
             // Get input sample
             float inputSample = channelData[sample];
             float processedSample = inputSample;
             
             // Apply allpass stages
-            const float coefficient = calculateAllpassCoefficient(modulatedFreq);
-            const float bandwidthFactor = 1.0f + (bandwidth / 100.0f) * 3.0f; // 1 to 4 stages based on bandwidth
-            const int activeStages = static_cast<int>(bandwidthFactor * 2.0f); // 2 to 8 stages
+            const float coefficient = coefficients[sample];
             
-            for (int stage = 0; stage < activeStages && stage < ChannelState::NUM_STAGES; ++stage)
+            for (int stage = 0; stage < activeStages; ++stage)
             {
                 processedSample = state.stages[stage].process(processedSample, coefficient);
             }
@@ -226,7 +221,11 @@ void HyperPhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
 
 juce::AudioProcessorEditor* HyperPhaserProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new HyperPhaserEditor(*this);
+   #endif
 }
 
 void HyperPhaserProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -242,4 +241,12 @@ void HyperPhaserProcessor::setStateInformation(const void* data, int sizeInBytes
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(parameters.state.getType()))
             parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+}
+
+void HyperPhaserProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("parameter ramps", baseFreqRamp.getAllocatedBytes() + sweepRateRamp.getAllocatedBytes() + depthRamp.getAllocatedBytes()
+                                        + feedbackRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+    footprint.add("control signals", channelStates[0].coefficients.getAllocatedBytes() + channelStates[1].coefficients.getAllocatedBytes());
 }
\ No newline at end of file
@@ -6,8 +6,17 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/ParameterTable.h"
+#include "../Shared/ModulationQuality.h"
+#include "../DSP/ControlSignal.h"
+#include "../DSP/Lfo.h"
+#include "../DSP/ParameterRamp.h"
 
-class HyperPhaserProcessor : public juce::AudioProcessor
+class HyperPhaserProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     static constexpr auto BASE_FREQ_ID = "baseFreq";
@@ -18,6 +27,9 @@ public:
     static constexpr auto MIX_ID = "mix";
     static constexpr auto BYPASS_ID = "bypass";
 
+    // Parameters in layout order, indexing the table in HyperPhaserProcessor.cpp
+    enum class Param { baseFreq, sweepRate, peakNotchDepth, bandwidth, feedback, mix, bypass, modulationQuality, count };
+
     HyperPhaserProcessor();
     ~HyperPhaserProcessor() override;
 
@@ -31,9 +43,13 @@ public:
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
-    const juce::String getName() const override { return JucePlugin_Name; }
+    const juce::String getName() const override { return "HyperPrism Reimagined HyperPhaser"; }
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
@@ -50,8 +66,15 @@ public:
 
     juce::AudioProcessorValueTreeState& getValueTreeState() { return parameters; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     juce::AudioProcessorValueTreeState parameters;
+    HyperPrismParameters::Values<Param> parameterValues;
     
     // Allpass filter stage
     struct AllpassStage
@@ -71,13 +94,14 @@ private:
     {
         static constexpr int NUM_STAGES = 8;
         std::array<AllpassStage, NUM_STAGES> stages;
-        float lfoPhase = 0.0f;
+        HyperPrismDSP::SineLfo lfo;
+        HyperPrismDSP::ControlSignal coefficients;     // Swept allpass coefficient, at the control rate
         
         void reset()
         {
             for (auto& stage : stages)
                 stage.reset();
-            lfoPhase = 0.0f;
+            lfo.setPhase(0.0f);
         }
     };
     
@@ -85,20 +109,24 @@ private:
     
     // Current parameter values
     float currentSampleRate = 44100.0f;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
-    // Parameter smoothing
-    juce::SmoothedValue<float> baseFreqSmoothed;
-    juce::SmoothedValue<float> sweepRateSmoothed;
-    juce::SmoothedValue<float> depthSmoothed;
-    juce::SmoothedValue<float> bandwidthSmoothed;
-    juce::SmoothedValue<float> feedbackSmoothed;
-    juce::SmoothedValue<float> mixSmoothed;
+    // Parameter ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp baseFreqRamp;
+    HyperPrismDSP::ParameterRamp sweepRateRamp;
+    HyperPrismDSP::ParameterRamp depthRamp;
+    HyperPrismDSP::ParameterRamp feedbackRamp;
+    HyperPrismDSP::ParameterRamp mixRamp;
     
     // Helper functions
     float calculateAllpassCoefficient(float frequency);
     float processPeakNotchDepth(float input, float depth);
-    
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    // Kernel micro-benchmarks (Source/Bench/KernelBenchmark.cpp)
+    friend struct HyperPrismKernelAccess;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HyperPhaserProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,389 @@
+//==============================================================================
+// HyperPrism Reimagined - C API Implementation
+// Wraps the registry's processors behind the functions in hyperprism.h
+//==============================================================================
+
+#include <JuceHeader.h>
+#include "hyperprism.h"
+#include "../Shared/EffectRegistry.h"
+#include <mutex>
+
+//==============================================================================
+struct hyperprism_processor
+{
+    std::unique_ptr<juce::AudioProcessor> processor;
+    juce::MidiBuffer midi;
+
+    // Kept alive for hyperprism_parameter_id's returned pointers
+    std::vector<std::string> parameterIDs;
+
+    int preparedChannels = 0;
+    int preparedBlockSize = 0;
+};
+
+namespace
+{
+    // APVTS needs a message manager to exist; nothing is ever shown. JUCE's
+    // own initialiser count is not thread-safe, so the library initialises
+    // once per process, under std::call_once, on the first hyperprism_create.
+    // It stays up until the process exits or the library is unloaded, so
+    // handles can come and go on any threads without JUCE restarting.
+    void initialiseJuceOnce()
+    {
+        static std::once_flag initialised;
+        static std::unique_ptr<juce::ScopedJuceInitialiser_GUI> initialiser;
+
+        std::call_once(initialised, [] { initialiser = std::make_unique<juce::ScopedJuceInitialiser_GUI>(); });
+    }
+
+    juce::String getParameterID(juce::AudioProcessorParameter& parameter)
+    {
+        if (auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(&parameter))
+            return withID->paramID;
+
+        return parameter.getName(64);
+    }
+
+    juce::AudioProcessorParameter* findParameter(const hyperprism_processor& handle, const char* parameterID)
+    {
+        if (parameterID == nullptr)
+            return nullptr;
+
+        const auto& parameters = handle.processor->getParameters();
+
+        for (size_t i = 0; i < handle.parameterIDs.size(); ++i)
+            if (handle.parameterIDs[i] == parameterID)
+                return parameters[static_cast<int>(i)];
+
+        return nullptr;
+    }
+
+    // Ranged parameters convert through their own range; anything else is
+    // already normalised
+    float toNormalised(juce::AudioProcessorParameter& parameter, float value)
+    {
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(&parameter))
+            return ranged->convertTo0to1(value);
+
+        return value;
+    }
+
+    float fromNormalised(juce::AudioProcessorParameter& parameter, float normalisedValue)
+    {
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(&parameter))
+            return ranged->convertFrom0to1(normalisedValue);
+
+        return normalisedValue;
+    }
+
+    // Every entry point catches here: no C++ exception may reach a C caller
+    template <typename Function>
+    hyperprism_result guarded(Function&& function) noexcept
+    {
+        try
+        {
+            return function();
+        }
+        catch (...)
+        {
+            return HYPERPRISM_ERROR_INTERNAL;
+        }
+    }
+}
+
+//==============================================================================
+int hyperprism_api_version(void)
+{
+    return HYPERPRISM_API_VERSION;
+}
+
+const char* hyperprism_result_string(hyperprism_result result)
+{
+    switch (result)
+    {
+        case HYPERPRISM_OK:                         return "ok";
+        case HYPERPRISM_ERROR_INVALID_ARGUMENT:     return "invalid argument";
+        case HYPERPRISM_ERROR_UNKNOWN_EFFECT:       return "unknown effect";
+        case HYPERPRISM_ERROR_UNKNOWN_PARAMETER:    return "unknown parameter";
+        case HYPERPRISM_ERROR_UNSUPPORTED_LAYOUT:   return "unsupported channel layout";
+        case HYPERPRISM_ERROR_NOT_PREPARED:         return "processor not prepared";
+        case HYPERPRISM_ERROR_INVALID_STATE:        return "invalid state";
+        case HYPERPRISM_ERROR_BUFFER_TOO_SMALL:     return "buffer too small";
+        case HYPERPRISM_ERROR_INTERNAL:             return "internal error";
+    }
+
+    return "unknown result";
+}
+
+int hyperprism_effect_count(void)
+{
+    return static_cast<int>(HyperPrismRegistry::getAllEffects().size());
+}
+
+const char* hyperprism_effect_name(int index)
+{
+    // Registry names are ASCII literals that live as long as the library
+    static const std::vector<std::string> names = []
+    {
+        std::vector<std::string> result;
+
+        for (const auto& effect : HyperPrismRegistry::getAllEffects())
+            result.push_back(effect.name.toStdString());
+
+        return result;
+    }();
+
+    if (index < 0 || index >= static_cast<int>(names.size()))
+        return nullptr;
+
+    return names[static_cast<size_t>(index)].c_str();
+}
+
+//==============================================================================
+hyperprism_result hyperprism_create(const char* effectName, hyperprism_processor** processor)
+{
+    if (effectName == nullptr || processor == nullptr)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    *processor = nullptr;
+
+    return guarded([&]
+    {
+        const auto* info = HyperPrismRegistry::findEffect(juce::String::fromUTF8(effectName));
+
+        if (info == nullptr)
+            return HYPERPRISM_ERROR_UNKNOWN_EFFECT;
+
+        initialiseJuceOnce();
+
+        auto handle = std::make_unique<hyperprism_processor>();
+        handle->processor = info->create();
+
+        for (auto* parameter : handle->processor->getParameters())
+            handle->parameterIDs.push_back(getParameterID(*parameter).toStdString());
+
+        *processor = handle.release();
+        return HYPERPRISM_OK;
+    });
+}
+
+void hyperprism_destroy(hyperprism_processor* processor)
+{
+    if (processor == nullptr)
+        return;
+
+    try
+    {
+        if (processor->preparedChannels > 0)
+            processor->processor->releaseResources();
+
+        delete processor;
+    }
+    catch (...)
+    {
+    }
+}
+
+hyperprism_result hyperprism_prepare(hyperprism_processor* processor, double sampleRate,
+                                     int maxBlockSize, int numChannels, int nonRealtime)
+{
+    if (processor == nullptr || sampleRate <= 0.0 || maxBlockSize < 1 || numChannels < 1 || numChannels > 2)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        auto& effect = *processor->processor;
+        const auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(channelSet);
+        layout.outputBuses.add(channelSet);
+
+        if (! effect.setBusesLayout(layout))
+            return HYPERPRISM_ERROR_UNSUPPORTED_LAYOUT;
+
+        if (processor->preparedChannels > 0)
+            effect.releaseResources();
+
+        // Set before prepareToPlay, as the plugin wrappers do, so offline
+        // scratch is sized for bounce-length blocks
+        effect.setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+        effect.setNonRealtime(nonRealtime != 0);
+        effect.prepareToPlay(sampleRate, maxBlockSize);
+
+        processor->preparedChannels = numChannels;
+        processor->preparedBlockSize = maxBlockSize;
+        return HYPERPRISM_OK;
+    });
+}
+
+hyperprism_result hyperprism_reset(hyperprism_processor* processor)
+{
+    if (processor == nullptr)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    if (processor->preparedChannels == 0)
+        return HYPERPRISM_ERROR_NOT_PREPARED;
+
+    return guarded([&]
+    {
+        auto& effect = *processor->processor;
+
+        // Not every effect clears its state in reset(); preparing again does
+        effect.releaseResources();
+        effect.prepareToPlay(effect.getSampleRate(), processor->preparedBlockSize);
+        return HYPERPRISM_OK;
+    });
+}
+
+hyperprism_result hyperprism_process(hyperprism_processor* processor, float* const* channels,
+                                     int numChannels, int numSamples)
+{
+    if (processor == nullptr || channels == nullptr || numSamples < 0)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    if (processor->preparedChannels == 0)
+        return HYPERPRISM_ERROR_NOT_PREPARED;
+
+    if (numChannels != processor->preparedChannels)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        if (channels[channel] == nullptr)
+            return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        // Processors only promise to take the block size they were prepared with
+        for (int start = 0; start < numSamples; start += processor->preparedBlockSize)
+        {
+            juce::AudioBuffer<float> block(channels, numChannels, start,
+                                           juce::jmin(processor->preparedBlockSize, numSamples - start));
+            processor->midi.clear();
+            processor->processor->processBlock(block, processor->midi);
+        }
+
+        return HYPERPRISM_OK;
+    });
+}
+
+int hyperprism_get_latency_samples(const hyperprism_processor* processor)
+{
+    return processor != nullptr ? processor->processor->getLatencySamples() : 0;
+}
+
+double hyperprism_get_tail_seconds(const hyperprism_processor* processor)
+{
+    return processor != nullptr ? processor->processor->getTailLengthSeconds() : 0.0;
+}
+
+//==============================================================================
+int hyperprism_parameter_count(const hyperprism_processor* processor)
+{
+    return processor != nullptr ? static_cast<int>(processor->parameterIDs.size()) : 0;
+}
+
+const char* hyperprism_parameter_id(const hyperprism_processor* processor, int index)
+{
+    if (processor == nullptr || index < 0 || index >= static_cast<int>(processor->parameterIDs.size()))
+        return nullptr;
+
+    return processor->parameterIDs[static_cast<size_t>(index)].c_str();
+}
+
+hyperprism_result hyperprism_set_parameter(hyperprism_processor* processor, const char* parameterID, float value)
+{
+    if (processor == nullptr || parameterID == nullptr)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        auto* parameter = findParameter(*processor, parameterID);
+
+        if (parameter == nullptr)
+            return HYPERPRISM_ERROR_UNKNOWN_PARAMETER;
+
+        // Applied exactly as a plugin wrapper applies host automation
+        parameter->setValue(juce::jlimit(0.0f, 1.0f, toNormalised(*parameter, value)));
+        parameter->sendValueChangedMessageToListeners(parameter->getValue());
+        return HYPERPRISM_OK;
+    });
+}
+
+hyperprism_result hyperprism_get_parameter(const hyperprism_processor* processor, const char* parameterID, float* value)
+{
+    if (processor == nullptr || parameterID == nullptr || value == nullptr)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        auto* parameter = findParameter(*processor, parameterID);
+
+        if (parameter == nullptr)
+            return HYPERPRISM_ERROR_UNKNOWN_PARAMETER;
+
+        *value = fromNormalised(*parameter, parameter->getValue());
+        return HYPERPRISM_OK;
+    });
+}
+
+hyperprism_result hyperprism_get_parameter_range(const hyperprism_processor* processor, const char* parameterID,
+                                                 float* minimum, float* maximum, float* defaultValue)
+{
+    if (processor == nullptr || parameterID == nullptr)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        auto* parameter = findParameter(*processor, parameterID);
+
+        if (parameter == nullptr)
+            return HYPERPRISM_ERROR_UNKNOWN_PARAMETER;
+
+        if (minimum != nullptr)         *minimum = fromNormalised(*parameter, 0.0f);
+        if (maximum != nullptr)         *maximum = fromNormalised(*parameter, 1.0f);
+        if (defaultValue != nullptr)    *defaultValue = fromNormalised(*parameter, parameter->getDefaultValue());
+        return HYPERPRISM_OK;
+    });
+}
+
+//==============================================================================
+hyperprism_result hyperprism_get_state(const hyperprism_processor* processor, void* data, size_t* size)
+{
+    if (processor == nullptr || size == nullptr)
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        juce::MemoryBlock state;
+        processor->processor->getStateInformation(state);
+
+        const auto capacity = *size;
+        *size = state.getSize();
+
+        if (data == nullptr)
+            return HYPERPRISM_OK;
+
+        if (capacity < state.getSize())
+            return HYPERPRISM_ERROR_BUFFER_TOO_SMALL;
+
+        state.copyTo(data, 0, state.getSize());
+        return HYPERPRISM_OK;
+    });
+}
+
+hyperprism_result hyperprism_set_state(hyperprism_processor* processor, const void* data, size_t size)
+{
+    if (processor == nullptr || data == nullptr || size == 0 || size > static_cast<size_t>(std::numeric_limits<int>::max()))
+        return HYPERPRISM_ERROR_INVALID_ARGUMENT;
+
+    return guarded([&]
+    {
+        // The plugins silently ignore a blob they cannot parse, so it is checked here
+        if (juce::AudioProcessor::getXmlFromBinary(data, static_cast<int>(size)) == nullptr)
+            return HYPERPRISM_ERROR_INVALID_STATE;
+
+        processor->processor->setStateInformation(data, static_cast<int>(size));
+        return HYPERPRISM_OK;
+    });
+}
@@ -0,0 +1,21 @@
+//==============================================================================
+// HyperPrism Reimagined - Library JuceHeader
+// juce_generate_juce_header only accepts targets made by the juce_add_*
+// functions, and none of those makes a shared library, so libhyperprism
+// carries this by hand. It lists the modules configure_hyperprism_headless
+// links; keep the two in step.
+//==============================================================================
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_core/juce_core.h>
+#include <juce_data_structures/juce_data_structures.h>
+#include <juce_dsp/juce_dsp.h>
+#include <juce_events/juce_events.h>
+
+#if ! DONT_SET_USING_JUCE_NAMESPACE
+ using namespace juce;
+#endif
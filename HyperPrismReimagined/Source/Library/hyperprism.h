@@ -0,0 +1,133 @@
+/*==============================================================================
+  HyperPrism Reimagined - C API
+  Runs the 32 HyperPrism processors from any scheduler, without a plugin host.
+
+  Usage:
+
+      hyperprism_processor* delay = NULL;
+      if (hyperprism_create("Delay", &delay) != HYPERPRISM_OK) ...
+
+      hyperprism_set_parameter(delay, "delayTime", 375.0f);     // In the parameter's own units
+      hyperprism_prepare(delay, 48000.0, 4096, 2, 1);            // 1 = offline, as for a bounce
+
+      float* channels[2] = { left, right };
+      hyperprism_process(delay, channels, 2, numSamples);        // In place, non-interleaved
+
+      hyperprism_destroy(delay);
+
+  A processor may be used from any thread, but not from two at once, except
+  that parameters can be set while another thread is processing. Different
+  processors can be created and destroyed on any threads at the same time.
+  The first hyperprism_create initialises JUCE for the whole process, and its
+  thread becomes JUCE's message thread; JUCE then stays up until the process
+  exits or the library is unloaded, whatever is destroyed in between. Every
+  call that can fail returns a hyperprism_result; none of them throws or aborts.
+==============================================================================*/
+
+#ifndef HYPERPRISM_H
+#define HYPERPRISM_H
+
+#include <stddef.h>
+
+#if defined(_WIN32)
+ #if defined(HYPERPRISM_BUILDING_LIBRARY)
+  #define HYPERPRISM_API __declspec(dllexport)
+ #else
+  #define HYPERPRISM_API __declspec(dllimport)
+ #endif
+#else
+ #define HYPERPRISM_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped only when an existing function changes; new functions keep the version */
+#define HYPERPRISM_API_VERSION 1
+
+typedef struct hyperprism_processor hyperprism_processor;
+
+typedef enum hyperprism_result
+{
+    HYPERPRISM_OK = 0,
+    HYPERPRISM_ERROR_INVALID_ARGUMENT,      /* Null pointer, bad count or out-of-range index */
+    HYPERPRISM_ERROR_UNKNOWN_EFFECT,
+    HYPERPRISM_ERROR_UNKNOWN_PARAMETER,
+    HYPERPRISM_ERROR_UNSUPPORTED_LAYOUT,    /* The effect cannot run with this many channels */
+    HYPERPRISM_ERROR_NOT_PREPARED,          /* hyperprism_process before hyperprism_prepare */
+    HYPERPRISM_ERROR_INVALID_STATE,         /* A state blob the effect did not write */
+    HYPERPRISM_ERROR_BUFFER_TOO_SMALL,
+    HYPERPRISM_ERROR_INTERNAL
+} hyperprism_result;
+
+/*------------------------------------------------------------------------------
+  Library
+------------------------------------------------------------------------------*/
+HYPERPRISM_API int hyperprism_api_version(void);
+HYPERPRISM_API const char* hyperprism_result_string(hyperprism_result result);
+
+/* Effect names as accepted by hyperprism_create, e.g. "Delay", "Vocoder" */
+HYPERPRISM_API int hyperprism_effect_count(void);
+HYPERPRISM_API const char* hyperprism_effect_name(int index);
+
+/*------------------------------------------------------------------------------
+  Lifetime and processing
+------------------------------------------------------------------------------*/
+/* Names match case-insensitively; the processor starts at its defaults.
+   Thread-safe against every other create and destroy; destroy must not race
+   any other call on the same processor. */
+HYPERPRISM_API hyperprism_result hyperprism_create(const char* effectName, hyperprism_processor** processor);
+HYPERPRISM_API void hyperprism_destroy(hyperprism_processor* processor);
+
+/* numChannels is 1 or 2. maxBlockSize is a hint: longer blocks are processed
+   in pieces. nonRealtime non-zero prepares the processor as a host does for an
+   offline bounce. Preparing again resets the processor's signal state. */
+HYPERPRISM_API hyperprism_result hyperprism_prepare(hyperprism_processor* processor, double sampleRate,
+                                                    int maxBlockSize, int numChannels, int nonRealtime);
+
+/* Clears delay lines, envelopes and filter state, keeping the prepared settings */
+HYPERPRISM_API hyperprism_result hyperprism_reset(hyperprism_processor* processor);
+
+/* Processes numChannels (as prepared) non-interleaved channels in place */
+HYPERPRISM_API hyperprism_result hyperprism_process(hyperprism_processor* processor, float* const* channels,
+                                                    int numChannels, int numSamples);
+
+/* Valid once prepared; both can depend on the sample rate and parameters */
+HYPERPRISM_API int hyperprism_get_latency_samples(const hyperprism_processor* processor);
+HYPERPRISM_API double hyperprism_get_tail_seconds(const hyperprism_processor* processor);
+
+/*------------------------------------------------------------------------------
+  Parameters
+------------------------------------------------------------------------------*/
+HYPERPRISM_API int hyperprism_parameter_count(const hyperprism_processor* processor);
+
+/* The parameter's ID, e.g. "delayTime" or "bandCount"; valid for the processor's lifetime */
+HYPERPRISM_API const char* hyperprism_parameter_id(const hyperprism_processor* processor, int index);
+
+/* Values are in the parameter's own units (ms, Hz, dB, %); choices and
+   toggles are their index. Out-of-range values are clamped. */
+HYPERPRISM_API hyperprism_result hyperprism_set_parameter(hyperprism_processor* processor, const char* parameterID,
+                                                          float value);
+HYPERPRISM_API hyperprism_result hyperprism_get_parameter(const hyperprism_processor* processor,
+                                                          const char* parameterID, float* value);
+
+/* The parameter's range and default, in its own units */
+HYPERPRISM_API hyperprism_result hyperprism_get_parameter_range(const hyperprism_processor* processor,
+                                                                const char* parameterID, float* minimum,
+                                                                float* maximum, float* defaultValue);
+
+/*------------------------------------------------------------------------------
+  State
+------------------------------------------------------------------------------*/
+/* The same blob the plugin saves in a session. Call with data NULL to get the
+   size; otherwise *size is the buffer's capacity on entry and the blob's size
+   on return. */
+HYPERPRISM_API hyperprism_result hyperprism_get_state(const hyperprism_processor* processor, void* data, size_t* size);
+HYPERPRISM_API hyperprism_result hyperprism_set_state(hyperprism_processor* processor, const void* data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HYPERPRISM_H */
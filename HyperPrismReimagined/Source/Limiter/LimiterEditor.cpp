@@ -5,6 +5,8 @@
 
 #include "LimiterEditor.h"
 
+namespace HyperPrismLimiterUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -162,6 +164,7 @@ void GainReductionMeter::paint(juce::Graphics& g)
 
 void GainReductionMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("GainReductionMeter::timerCallback");
     float newGainReduction = processor.getCurrentGainReduction();
     
     // Smooth the meter display
@@ -175,9 +178,10 @@ void GainReductionMeter::timerCallback()
 // LimiterEditor Implementation
 //==============================================================================
 LimiterEditor::LimiterEditor(LimiterProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), gainReductionMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), gainReductionMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(CEILING_ID);
@@ -295,6 +299,7 @@ LimiterEditor::~LimiterEditor()
 
 void LimiterEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("LimiterEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -330,7 +335,7 @@ void LimiterEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -618,4 +623,6 @@ void LimiterEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismLimiterUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "LimiterProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismLimiterUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -160,5 +163,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LimiterEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismLimiterUI
+
+using HyperPrismLimiterUI::LimiterEditor;
\ No newline at end of file
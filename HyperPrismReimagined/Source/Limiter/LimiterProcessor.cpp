@@ -1,5 +1,7 @@
 #include "LimiterProcessor.h"
-#include "LimiterEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "LimiterEditor.h"
+#endif
 
 static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
 {
@@ -106,6 +108,7 @@ void LimiterProcessor::changeProgramName(int index, const juce::String& newName)
 
 void LimiterProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Calculate maximum lookahead samples needed
@@ -117,8 +120,24 @@ void LimiterProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     lookaheadWritePos = 0;
     
     // Initialize envelope followers and smoothed gains
-    envelopeFollowers.resize(2, 0.0f);
-    smoothedGains.resize(2, 1.0f);
+    envelopeFollowers.resize(2);
+    smoothedGains.resize(2);
+
+    for (auto& envelope : envelopeFollowers)
+    {
+        envelope.setPoles(0.0f, 0.999f);    // Instant attack, fast release
+        envelope.reset();
+    }
+
+    for (auto& smoothedGain : smoothedGains)
+    {
+        smoothedGain.setPoles(0.999f, 0.01f);   // Fast attack, slow release
+        smoothedGain.reset(1.0f);
+    }
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    inputGainRamp.prepare(sampleRate, 0.005, scratchCapacity); // 5ms
+    inputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(inputGainParam->get()));
 }
 
 void LimiterProcessor::releaseResources()
@@ -180,7 +199,11 @@ float LimiterProcessor::processLimiting(float input, float ceiling, float& envel
 
 void LimiterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
-    juce::ignoreUnused(midiMessages);
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Limiter::processBlock");
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -198,14 +221,14 @@ void LimiterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
     float releaseTime = releaseParam->get();
     float lookaheadMs = lookaheadParam->get();
     bool useSoftClip = softClipParam->get();
-    float inputGainDB = inputGainParam->get();
-    float inputGainLinear = juce::Decibels::decibelsToGain(inputGainDB);
-    
     // Calculate lookahead samples
     lookaheadSamples = static_cast<int>(lookaheadMs * currentSampleRate / 1000.0);
     
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
+
+    inputGainRamp.setTarget(juce::Decibels::decibelsToGain(inputGainParam->get()));
+    const auto* inputGains = inputGainRamp.process(numSamples);
     
     float maxGainReduction = 1.0f;
     bool hitCeiling = false;
@@ -217,28 +240,20 @@ void LimiterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
         for (int sample = 0; sample < numSamples; ++sample)
         {
             // Apply input gain
-            float input = channelData[sample] * inputGainLinear;
+            float input = channelData[sample] * inputGains[sample];
             
             // Simplified limiting without expensive lookahead loop
             // Use immediate input instead of complex lookahead processing
             float inputAbs = std::abs(input);
             
             // Fast envelope follower
-            float& envelope = envelopeFollowers[channel];
-            if (inputAbs > envelope)
-                envelope = inputAbs; // Instant attack
-            else
-                envelope = inputAbs + 0.999f * (envelope - inputAbs); // Fast release
+            float envelope = envelopeFollowers[channel].process(inputAbs);
             
             // Calculate gain reduction
-            float& smoothedGain = smoothedGains[channel];
             float targetGain = (envelope > ceilingLinear) ? ceilingLinear / envelope : 1.0f;
             
             // Simple gain smoothing
-            if (targetGain < smoothedGain)
-                smoothedGain = targetGain + 0.01f * (smoothedGain - targetGain); // Fast attack
-            else
-                smoothedGain = targetGain + 0.999f * (smoothedGain - targetGain); // Slow release
+            float smoothedGain = smoothedGains[channel].process(targetGain);
             
             // Apply limiting to original input (no delay for performance)
             float output = input * smoothedGain;
@@ -269,12 +284,20 @@ void LimiterProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
 
 bool LimiterProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* LimiterProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new LimiterEditor(*this);
+   #endif
 }
 
 void LimiterProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -291,4 +314,13 @@ void LimiterProcessor::setStateInformation(const void* data, int sizeInBytes)
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(apvts.state.getType()))
             apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
+}
+
+void LimiterProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("lookahead buffer", lookaheadBuffer);
+    footprint.add("envelope state", envelopeFollowers);
+    footprint.add("envelope state", smoothedGains);
+    footprint.add("parameter ramps", inputGainRamp.getAllocatedBytes());
 }
\ No newline at end of file
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/LargeBlocks.h"
+#include "../DSP/EnvelopeFollower.h"
+#include "../DSP/ParameterRamp.h"
 
-class LimiterProcessor : public juce::AudioProcessor
+class LimiterProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     LimiterProcessor();
@@ -49,6 +55,12 @@ public:
     // Get the AudioProcessorValueTreeState
     juce::AudioProcessorValueTreeState& getStateInformation() { return apvts; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Parameter state
     juce::AudioProcessorValueTreeState apvts;
@@ -62,10 +74,14 @@ private:
     int lookaheadSamples = 0;
     
     // Envelope followers for each channel
-    std::vector<float> envelopeFollowers;
+    std::vector<HyperPrismDSP::EnvelopeFollower> envelopeFollowers;
     
     // Smoothing for gain changes
-    std::vector<float> smoothedGains;
+    std::vector<HyperPrismDSP::EnvelopeFollower> smoothedGains;
+
+    // Input gain ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp inputGainRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Metering
     std::atomic<float> currentGainReduction { 0.0f };
@@ -75,5 +91,8 @@ private:
     float processLimiting(float input, float ceiling, float& envelope, float& smoothedGain, float release);
     float softClip(float input);
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LimiterProcessor)
 };
\ No newline at end of file
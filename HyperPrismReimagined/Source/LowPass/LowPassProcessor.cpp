@@ -3,14 +3,32 @@
 //==============================================================================
 
 #include "LowPassProcessor.h"
-#include "LowPassEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "LowPassEditor.h"
+#endif
+
+namespace
+{
+    using Param = LowPassProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        boolParameter(Param::bypass, "bypass", "Bypass", false),
+        floatParameter(Param::frequency, "frequency", "Frequency", 20.0f, 20000.0f, 1.0f, 0.3f, 10000.0f, 0, " Hz"),
+        floatParameter(Param::resonance, "resonance", "Resonance", 0.0f, 100.0f, 0.1f, 1.0f, 10.0f, 1, " %"),
+        floatParameter(Param::gain, "gain", "Gain", -24.0f, 24.0f, 0.1f, 1.0f, 0.0f, 1, " dB"),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 100.0f, 1, " %")
+    }}};
+
+    static_assert(parameterTable.isValid(), "LowPass parameter table out of step with LowPassProcessor::Param");
+}
 
 // Parameter IDs
-const juce::String LowPassProcessor::BYPASS_ID = "bypass";
-const juce::String LowPassProcessor::FREQUENCY_ID = "frequency";
-const juce::String LowPassProcessor::RESONANCE_ID = "resonance";
-const juce::String LowPassProcessor::GAIN_ID = "gain";
-const juce::String LowPassProcessor::MIX_ID = "mix";
+const juce::String LowPassProcessor::BYPASS_ID = parameterTable[Param::bypass].id;
+const juce::String LowPassProcessor::FREQUENCY_ID = parameterTable[Param::frequency].id;
+const juce::String LowPassProcessor::RESONANCE_ID = parameterTable[Param::resonance].id;
+const juce::String LowPassProcessor::GAIN_ID = parameterTable[Param::gain].id;
+const juce::String LowPassProcessor::MIX_ID = parameterTable[Param::mix].id;
 
 //==============================================================================
 LowPassProcessor::LowPassProcessor()
@@ -24,7 +42,8 @@ LowPassProcessor::LowPassProcessor()
                      #endif
                        ),
 #endif
-    valueTreeState(*this, nullptr, "PARAMETERS", createParameterLayout())
+    valueTreeState(*this, nullptr, "PARAMETERS", HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(valueTreeState, parameterTable)
 {
 }
 
@@ -35,7 +54,7 @@ LowPassProcessor::~LowPassProcessor()
 //==============================================================================
 const juce::String LowPassProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Low-Pass Filter";
 }
 
 bool LowPassProcessor::acceptsMidi() const
@@ -96,6 +115,7 @@ void LowPassProcessor::changeProgramName(int index, const juce::String& newName)
 //==============================================================================
 void LowPassProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     juce::dsp::ProcessSpec spec;
@@ -105,22 +125,16 @@ void LowPassProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     
     lowPassFilter.prepare(spec);
     
-    // Initialize smoothed values
-    const float smoothTime = 0.005f; // 5ms smoothing for real-time response
-    frequencySmoothed.reset(sampleRate, smoothTime);
-    resonanceSmoothed.reset(sampleRate, smoothTime);
-    gainSmoothed.reset(sampleRate, smoothTime);
-    mixSmoothed.reset(sampleRate, smoothTime);
-    
-    // Set initial values
-    frequencySmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(FREQUENCY_ID)->load());
-    resonanceSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(RESONANCE_ID)->load());
-    gainSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(GAIN_ID)->load());
-    mixSmoothed.setCurrentAndTargetValue(valueTreeState.getRawParameterValue(MIX_ID)->load());
-    
     updateFilter();
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.005; // 5ms smoothing for real-time response
+    gainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    gainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(parameterValues.get(Param::gain)));
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void LowPassProcessor::releaseResources()
@@ -149,8 +163,13 @@ bool LowPassProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 }
 #endif
 
-void LowPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void LowPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("LowPass::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -158,18 +177,14 @@ void LowPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    const auto values = parameterValues.snapshot();
+
     // Check bypass
-    if (valueTreeState.getRawParameterValue(BYPASS_ID)->load() > 0.5f)
+    if (values.isOn(Param::bypass))
         return;
 
-    // Update smoothed parameters
-    frequencySmoothed.setTargetValue(valueTreeState.getRawParameterValue(FREQUENCY_ID)->load());
-    resonanceSmoothed.setTargetValue(valueTreeState.getRawParameterValue(RESONANCE_ID)->load());
-    gainSmoothed.setTargetValue(valueTreeState.getRawParameterValue(GAIN_ID)->load());
-    mixSmoothed.setTargetValue(valueTreeState.getRawParameterValue(MIX_ID)->load());
-
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
 
     // Always update filter to ensure real-time parameter changes
     updateFilter();
@@ -180,39 +195,36 @@ void LowPassProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
     lowPassFilter.process(context);
 
     // Apply gain
-    float currentGain = juce::Decibels::decibelsToGain(valueTreeState.getRawParameterValue(GAIN_ID)->load());
+    const int numSamples = buffer.getNumSamples();
+    gainRamp.setTarget(juce::Decibels::decibelsToGain(values[Param::gain]));
+    mixRamp.setTarget(values[Param::mix] * 0.01f); // Convert percentage to ratio
+    const auto* gains = gainRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
+
     for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= currentGain;
-        }
-    }
+        HyperPrismLargeBlocks::applyGain(buffer.getWritePointer(channel), gains, gainRamp.isConstant(), numSamples);
 
     // Mix dry and wet signals
-    float mixValue = valueTreeState.getRawParameterValue(MIX_ID)->load() * 0.01f; // Convert percentage to ratio
-    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-    {
-        auto* wetData = buffer.getWritePointer(channel);
-        auto* dryData = dryBuffer.getReadPointer(channel);
-        
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            wetData[sample] = dryData[sample] * (1.0f - mixValue) + wetData[sample] * mixValue;
-        }
-    }
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumOutputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 //==============================================================================
 bool LowPassProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* LowPassProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new LowPassEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -231,11 +243,19 @@ void LowPassProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void LowPassProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", gainRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+}
+
 //==============================================================================
 void LowPassProcessor::updateFilter()
 {
-    float frequency = valueTreeState.getRawParameterValue(FREQUENCY_ID)->load();
-    float resonance = valueTreeState.getRawParameterValue(RESONANCE_ID)->load();
+    HYPERPRISM_TRACE_SCOPE("LowPass::updateFilter");
+    float frequency = parameterValues.get(Param::frequency);
+    float resonance = parameterValues.get(Param::resonance);
     
     // Clamp frequency to valid range
     frequency = juce::jlimit(20.0f, static_cast<float>(currentSampleRate * 0.45), frequency);
@@ -247,37 +267,3 @@ void LowPassProcessor::updateFilter()
     auto coefficients = CoefficientsType::makeLowPass(currentSampleRate, frequency, q);
     *lowPassFilter.state = *coefficients;
 }
-
-juce::AudioProcessorValueTreeState::ParameterLayout LowPassProcessor::createParameterLayout()
-{
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID, "Bypass", false));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        FREQUENCY_ID, "Frequency", 
-        juce::NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.3f), 10000.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 0) + " Hz"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        RESONANCE_ID, "Resonance", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 10.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        GAIN_ID, "Gain", 
-        juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " dB"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID, "Mix", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 100.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    return { parameters.begin(), parameters.end() };
-}
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "MSMatrixEditor.h"
 
+namespace HyperPrismMSMatrixUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -156,6 +158,7 @@ void MSMeter::paint(juce::Graphics& g)
 
 void MSMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("MSMeter::timerCallback");
     float newLeftLevel = processor.getLeftLevel();
     float newRightLevel = processor.getRightLevel();
     float newMidLevel = processor.getMidLevel();
@@ -175,9 +178,10 @@ void MSMeter::timerCallback()
 // MSMatrixEditor Implementation
 //==============================================================================
 MSMatrixEditor::MSMatrixEditor(MSMatrixProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), msMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), msMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(MSMatrixProcessor::MID_LEVEL_ID);
@@ -325,6 +329,7 @@ MSMatrixEditor::~MSMatrixEditor()
 
 void MSMatrixEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("MSMatrixEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -369,7 +374,7 @@ void MSMatrixEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -669,4 +674,6 @@ void MSMatrixEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismMSMatrixUI
\ No newline at end of file
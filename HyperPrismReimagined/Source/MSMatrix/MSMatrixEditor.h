@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "MSMatrixProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismMSMatrixUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -163,5 +166,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MSMatrixEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismMSMatrixUI
+
+using HyperPrismMSMatrixUI::MSMatrixEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "MSMatrixProcessor.h"
-#include "MSMatrixEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "MSMatrixEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String MSMatrixProcessor::BYPASS_ID = "bypass";
@@ -95,16 +97,19 @@ juce::AudioProcessorValueTreeState::ParameterLayout MSMatrixProcessor::createPar
 //==============================================================================
 void MSMatrixProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused(samplesPerBlock);
+    loadMeter.prepare(sampleRate);
     
-    // Initialize smoothed values
-    smoothedMidLevel.reset(sampleRate, 0.05); // 50ms smoothing
-    smoothedSideLevel.reset(sampleRate, 0.05);
-    smoothedStereoBalance.reset(sampleRate, 0.05);
+    // Initialize gain ramps
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    midLevelRamp.prepare(sampleRate, 0.05, scratchCapacity); // 50ms smoothing
+    sideLevelRamp.prepare(sampleRate, 0.05, scratchCapacity);
+    stereoBalanceRamp.prepare(sampleRate, 0.05, scratchCapacity);
+    outputLevelRamp.prepare(sampleRate, 0.05, scratchCapacity);
     
-    smoothedMidLevel.setCurrentAndTargetValue(1.0f);
-    smoothedSideLevel.setCurrentAndTargetValue(1.0f);
-    smoothedStereoBalance.setCurrentAndTargetValue(0.0f);
+    midLevelRamp.setCurrentAndTarget(1.0f);
+    sideLevelRamp.setCurrentAndTarget(1.0f);
+    stereoBalanceRamp.setCurrentAndTarget(0.0f);
+    outputLevelRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     leftLevel.store(0.0f);
@@ -129,8 +134,13 @@ bool MSMatrixProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return true;
 }
 
-void MSMatrixProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void MSMatrixProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("MSMatrix::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -164,6 +174,7 @@ void MSMatrixProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
 
 void MSMatrixProcessor::processLRToMS(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("MSMatrix::processLRToMS");
     const int numSamples = buffer.getNumSamples();
     
     const float midLevelDB = midLevelParam->load();
@@ -171,7 +182,6 @@ void MSMatrixProcessor::processLRToMS(juce::AudioBuffer<float>& buffer)
     const bool midSolo = midSoloParam->load() > 0.5f;
     const bool sideSolo = sideSoloParam->load() > 0.5f;
     const float stereoBalance = stereoBalanceParam->load() / 100.0f; // -1 to +1
-    const float outputLevel = juce::Decibels::decibelsToGain(outputLevelParam->load());
     
     // Convert to linear gain
     float midGain = (midLevelDB <= -59.9f) ? 0.0f : juce::Decibels::decibelsToGain(midLevelDB);
@@ -183,10 +193,15 @@ void MSMatrixProcessor::processLRToMS(juce::AudioBuffer<float>& buffer)
     else if (sideSolo && !midSolo)
         midGain = 0.0f;
     
-    // Set smoothed target values
-    smoothedMidLevel.setTargetValue(midGain);
-    smoothedSideLevel.setTargetValue(sideGain);
-    smoothedStereoBalance.setTargetValue(stereoBalance);
+    // Render the gain ramps
+    midLevelRamp.setTarget(midGain);
+    sideLevelRamp.setTarget(sideGain);
+    stereoBalanceRamp.setTarget(stereoBalance);
+    const auto* midGains = midLevelRamp.process(numSamples);
+    const auto* sideGains = sideLevelRamp.process(numSamples);
+    const auto* balances = stereoBalanceRamp.process(numSamples);
+    outputLevelRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputLevels = outputLevelRamp.process(numSamples);
     
     auto* leftData = buffer.getWritePointer(0);
     auto* rightData = buffer.getWritePointer(1);
@@ -209,10 +224,10 @@ void MSMatrixProcessor::processLRToMS(juce::AudioBuffer<float>& buffer)
         midLevelSum += std::abs(mid);
         sideLevelSum += std::abs(side);
         
-        // Apply smoothed gains
-        float currentMidGain = smoothedMidLevel.getNextValue();
-        float currentSideGain = smoothedSideLevel.getNextValue();
-        float currentBalance = smoothedStereoBalance.getNextValue();
+        // Apply ramped gains
+        float currentMidGain = midGains[sample];
+        float currentSideGain = sideGains[sample];
+        float currentBalance = balances[sample];
         
         mid *= currentMidGain;
         side *= currentSideGain;
@@ -238,8 +253,8 @@ void MSMatrixProcessor::processLRToMS(juce::AudioBuffer<float>& buffer)
         processedRight *= balanceRightGain;
         
         // Apply output level and store
-        leftData[sample] = processedLeft * outputLevel;
-        rightData[sample] = processedRight * outputLevel;
+        leftData[sample] = processedLeft * outputLevels[sample];
+        rightData[sample] = processedRight * outputLevels[sample];
         
         // Accumulate for output metering
         leftLevelSum += std::abs(leftData[sample]);
@@ -255,6 +270,7 @@ void MSMatrixProcessor::processLRToMS(juce::AudioBuffer<float>& buffer)
 
 void MSMatrixProcessor::processMSToLR(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("MSMatrix::processMSToLR");
     const int numSamples = buffer.getNumSamples();
     
     const float midLevelDB = midLevelParam->load();
@@ -262,7 +278,6 @@ void MSMatrixProcessor::processMSToLR(juce::AudioBuffer<float>& buffer)
     const bool midSolo = midSoloParam->load() > 0.5f;
     const bool sideSolo = sideSoloParam->load() > 0.5f;
     const float stereoBalance = stereoBalanceParam->load() / 100.0f;
-    const float outputLevel = juce::Decibels::decibelsToGain(outputLevelParam->load());
     
     float midGain = (midLevelDB <= -59.9f) ? 0.0f : juce::Decibels::decibelsToGain(midLevelDB);
     float sideGain = (sideLevelDB <= -59.9f) ? 0.0f : juce::Decibels::decibelsToGain(sideLevelDB);
@@ -273,9 +288,14 @@ void MSMatrixProcessor::processMSToLR(juce::AudioBuffer<float>& buffer)
     else if (sideSolo && !midSolo)
         midGain = 0.0f;
     
-    smoothedMidLevel.setTargetValue(midGain);
-    smoothedSideLevel.setTargetValue(sideGain);
-    smoothedStereoBalance.setTargetValue(stereoBalance);
+    midLevelRamp.setTarget(midGain);
+    sideLevelRamp.setTarget(sideGain);
+    stereoBalanceRamp.setTarget(stereoBalance);
+    const auto* midGains = midLevelRamp.process(numSamples);
+    const auto* sideGains = sideLevelRamp.process(numSamples);
+    const auto* balances = stereoBalanceRamp.process(numSamples);
+    outputLevelRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputLevels = outputLevelRamp.process(numSamples);
     
     auto* leftData = buffer.getWritePointer(0);   // Mid input
     auto* rightData = buffer.getWritePointer(1);  // Side input
@@ -294,10 +314,10 @@ void MSMatrixProcessor::processMSToLR(juce::AudioBuffer<float>& buffer)
         midLevelSum += std::abs(mid);
         sideLevelSum += std::abs(side);
         
-        // Apply smoothed gains
-        float currentMidGain = smoothedMidLevel.getNextValue();
-        float currentSideGain = smoothedSideLevel.getNextValue();
-        float currentBalance = smoothedStereoBalance.getNextValue();
+        // Apply ramped gains
+        float currentMidGain = midGains[sample];
+        float currentSideGain = sideGains[sample];
+        float currentBalance = balances[sample];
         
         mid *= currentMidGain;
         side *= currentSideGain;
@@ -323,8 +343,8 @@ void MSMatrixProcessor::processMSToLR(juce::AudioBuffer<float>& buffer)
         right *= balanceRightGain;
         
         // Apply output level and store
-        leftData[sample] = left * outputLevel;
-        rightData[sample] = right * outputLevel;
+        leftData[sample] = left * outputLevels[sample];
+        rightData[sample] = right * outputLevels[sample];
         
         // Accumulate for output metering
         leftLevelSum += std::abs(leftData[sample]);
@@ -340,13 +360,13 @@ void MSMatrixProcessor::processMSToLR(juce::AudioBuffer<float>& buffer)
 
 void MSMatrixProcessor::processMSThrough(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("MSMatrix::processMSThrough");
     const int numSamples = buffer.getNumSamples();
     
     const float midLevelDB = midLevelParam->load();
     const float sideLevelDB = sideLevelParam->load();
     const bool midSolo = midSoloParam->load() > 0.5f;
     const bool sideSolo = sideSoloParam->load() > 0.5f;
-    const float outputLevel = juce::Decibels::decibelsToGain(outputLevelParam->load());
     
     float midGain = (midLevelDB <= -59.9f) ? 0.0f : juce::Decibels::decibelsToGain(midLevelDB);
     float sideGain = (sideLevelDB <= -59.9f) ? 0.0f : juce::Decibels::decibelsToGain(sideLevelDB);
@@ -357,8 +377,12 @@ void MSMatrixProcessor::processMSThrough(juce::AudioBuffer<float>& buffer)
     else if (sideSolo && !midSolo)
         midGain = 0.0f;
     
-    smoothedMidLevel.setTargetValue(midGain);
-    smoothedSideLevel.setTargetValue(sideGain);
+    midLevelRamp.setTarget(midGain);
+    sideLevelRamp.setTarget(sideGain);
+    const auto* midGains = midLevelRamp.process(numSamples);
+    const auto* sideGains = sideLevelRamp.process(numSamples);
+    outputLevelRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputLevels = outputLevelRamp.process(numSamples);
     
     auto* midData = buffer.getWritePointer(0);   // Mid channel
     auto* sideData = buffer.getWritePointer(1);  // Side channel
@@ -377,12 +401,12 @@ void MSMatrixProcessor::processMSThrough(juce::AudioBuffer<float>& buffer)
         midLevelSum += std::abs(mid);
         sideLevelSum += std::abs(side);
         
-        // Apply smoothed gains
-        float currentMidGain = smoothedMidLevel.getNextValue();
-        float currentSideGain = smoothedSideLevel.getNextValue();
+        // Apply ramped gains
+        float currentMidGain = midGains[sample];
+        float currentSideGain = sideGains[sample];
         
-        mid *= currentMidGain * outputLevel;
-        side *= currentSideGain * outputLevel;
+        mid *= currentMidGain * outputLevels[sample];
+        side *= currentSideGain * outputLevels[sample];
         
         // Store processed M/S
         midData[sample] = mid;
@@ -417,7 +441,11 @@ void MSMatrixProcessor::decodeMSToLR(float mid, float side, float& left, float&
 //==============================================================================
 juce::AudioProcessorEditor* MSMatrixProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new MSMatrixEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -432,4 +460,18 @@ void MSMatrixProcessor::setStateInformation(const void* data, int sizeInBytes)
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void MSMatrixProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("parameter ramps", midLevelRamp.getAllocatedBytes() + sideLevelRamp.getAllocatedBytes()
+                                        + stereoBalanceRamp.getAllocatedBytes() + outputLevelRamp.getAllocatedBytes());
+}
+
+int MSMatrixProcessor::getSignalMemorySamples() const
+{
+    // The level and balance smoothers are the only state, and they land exactly
+    // on their targets once the 50 ms ramp after prepareToPlay has run
+    return static_cast<int>(std::ceil(0.05 * getSampleRate()));
 }
\ No newline at end of file
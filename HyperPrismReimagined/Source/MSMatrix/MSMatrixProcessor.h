@@ -5,8 +5,16 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/SignalMemory.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 
-class MSMatrixProcessor : public juce::AudioProcessor
+class MSMatrixProcessor : public juce::AudioProcessor,
+                          public HyperPrismMemory::Reporter,
+                          public HyperPrismSignalMemory::Bounded
 {
 public:
     //==============================================================================
@@ -23,7 +31,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined M+S Matrix"; }
@@ -63,6 +75,15 @@ public:
     float getMidLevel() const { return midLevel.load(); }
     float getSideLevel() const { return sideLevel.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
+    // Input history the output depends on, for chunked offline rendering
+    int getSignalMemorySamples() const override;
+
 private:
     //==============================================================================
     enum MatrixMode
@@ -92,9 +113,11 @@ private:
     std::atomic<float>* outputLevelParam = nullptr;
     
     // State variables
-    juce::SmoothedValue<float> smoothedMidLevel;
-    juce::SmoothedValue<float> smoothedSideLevel;
-    juce::SmoothedValue<float> smoothedStereoBalance;
+    HyperPrismDSP::ParameterRamp midLevelRamp;
+    HyperPrismDSP::ParameterRamp sideLevelRamp;
+    HyperPrismDSP::ParameterRamp stereoBalanceRamp;
+    HyperPrismDSP::ParameterRamp outputLevelRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Metering
     std::atomic<float> leftLevel { 0.0f };
@@ -102,5 +125,8 @@ private:
     std::atomic<float> midLevel { 0.0f };
     std::atomic<float> sideLevel { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MSMatrixProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "MoreStereoEditor.h"
 
+namespace HyperPrismMoreStereoUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -162,6 +164,7 @@ void EnhancedStereoMeter::paint(juce::Graphics& g)
 
 void EnhancedStereoMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("EnhancedStereoMeter::timerCallback");
     float newLeftLevel = processor.getLeftLevel();
     float newRightLevel = processor.getRightLevel();
     float newStereoWidth = processor.getStereoWidth();
@@ -181,9 +184,10 @@ void EnhancedStereoMeter::timerCallback()
 // MoreStereoEditor Implementation
 //==============================================================================
 MoreStereoEditor::MoreStereoEditor(MoreStereoProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), enhancedStereoMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), enhancedStereoMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(MoreStereoProcessor::WIDTH_ID);
@@ -317,6 +321,7 @@ MoreStereoEditor::~MoreStereoEditor()
 
 void MoreStereoEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("MoreStereoEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -362,7 +367,7 @@ void MoreStereoEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -661,4 +666,6 @@ void MoreStereoEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismMoreStereoUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "MoreStereoProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismMoreStereoUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -159,5 +162,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoreStereoEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismMoreStereoUI
+
+using HyperPrismMoreStereoUI::MoreStereoEditor;
\ No newline at end of file
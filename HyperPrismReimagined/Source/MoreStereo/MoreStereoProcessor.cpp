@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "MoreStereoProcessor.h"
-#include "MoreStereoEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "MoreStereoEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String MoreStereoProcessor::BYPASS_ID = "bypass";
@@ -19,7 +21,13 @@ MoreStereoProcessor::MoreStereoProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input",  juce::AudioChannelSet::stereo(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      crossover(valueTreeState, { CROSSOVER_FREQ_ID }, [this](double sampleRate) -> Crossover
+      {
+          const auto crossoverFreq = crossoverFreqParam->load();
+          return { HyperPrismCoefficients::fromJuce(juce::IIRCoefficients::makeLowPass(sampleRate, crossoverFreq)),
+                   HyperPrismCoefficients::fromJuce(juce::IIRCoefficients::makeHighPass(sampleRate, crossoverFreq)) };
+      })
 {
     // Cache parameter pointers for performance
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -87,6 +95,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout MoreStereoProcessor::createP
 //==============================================================================
 void MoreStereoProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare reverb for ambience
@@ -114,26 +123,26 @@ void MoreStereoProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     ambienceDelayLeft.reset();
     ambienceDelayRight.reset();
     
-    // Initialize crossover filters
-    auto defaultLowPassCoeffs = juce::IIRCoefficients::makeLowPass(sampleRate, 120.0);
-    auto defaultHighPassCoeffs = juce::IIRCoefficients::makeHighPass(sampleRate, 120.0);
-    
-    lowPassLeft.setCoefficients(defaultLowPassCoeffs);
-    lowPassRight.setCoefficients(defaultLowPassCoeffs);
-    highPassLeft.setCoefficients(defaultHighPassCoeffs);
-    highPassRight.setCoefficients(defaultHighPassCoeffs);
+    // Initialize crossover filters at the current frequency
+    crossover.prepare(sampleRate);
+    lowPassLeft.setCoefficients(crossover.get().lowPass);
+    lowPassRight.setCoefficients(crossover.get().lowPass);
+    highPassLeft.setCoefficients(crossover.get().highPass);
+    highPassRight.setCoefficients(crossover.get().highPass);
     
     lowPassLeft.reset();
     lowPassRight.reset();
     highPassLeft.reset();
     highPassRight.reset();
-    
-    previousCrossoverFreq = -1.0f;
 
     // Pre-allocate processing buffers
-    bassBuffer.setSize(2, samplesPerBlock);
-    trebleBuffer.setSize(2, samplesPerBlock);
-    ambienceBuffer.setSize(2, samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    bassBuffer.setSize(2, scratchCapacity);
+    trebleBuffer.setSize(2, scratchCapacity);
+    ambienceBuffer.setSize(2, scratchCapacity);
+
+    outputLevelRamp.prepare(sampleRate, 0.005, scratchCapacity); // 5ms
+    outputLevelRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
 
     // Reset metering
     leftLevel.store(0.0f);
@@ -163,8 +172,13 @@ bool MoreStereoProcessor::isBusesLayoutSupported(const BusesLayout& layouts) con
     return true;
 }
 
-void MoreStereoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void MoreStereoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("MoreStereo::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -185,36 +199,33 @@ void MoreStereoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
 
 void MoreStereoProcessor::processMoreStereo(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("MoreStereo::processMoreStereo");
     const int numSamples = buffer.getNumSamples();
     
     const float width = widthParam->load() / 100.0f;
     const float bassMonoAmount = bassMonoParam->load() / 100.0f;
-    const float crossoverFreq = crossoverFreqParam->load();
     const float stereoEnhance = stereoEnhanceParam->load() / 100.0f;
     const float ambienceAmount = ambienceParam->load() / 100.0f;
-    const float outputLevel = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    outputLevelRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputLevels = outputLevelRamp.process(numSamples);
     
-    // Update crossover filters if frequency changed
-    if (std::abs(crossoverFreq - previousCrossoverFreq) > 1.0f)
+    // Glide to crossover coefficients published since the last block
+    if (crossover.update(isNonRealtime()))
     {
-        auto lowPassCoeffs = juce::IIRCoefficients::makeLowPass(currentSampleRate, crossoverFreq);
-        auto highPassCoeffs = juce::IIRCoefficients::makeHighPass(currentSampleRate, crossoverFreq);
-        
-        lowPassLeft.setCoefficients(lowPassCoeffs);
-        lowPassRight.setCoefficients(lowPassCoeffs);
-        highPassLeft.setCoefficients(highPassCoeffs);
-        highPassRight.setCoefficients(highPassCoeffs);
-        
-        previousCrossoverFreq = crossoverFreq;
+        const auto& coefficients = crossover.get();
+        lowPassLeft.rampTo(coefficients.lowPass, HyperPrismCoefficients::rampSamples);
+        lowPassRight.rampTo(coefficients.lowPass, HyperPrismCoefficients::rampSamples);
+        highPassLeft.rampTo(coefficients.highPass, HyperPrismCoefficients::rampSamples);
+        highPassRight.rampTo(coefficients.highPass, HyperPrismCoefficients::rampSamples);
     }
     
     auto* leftData = buffer.getWritePointer(0);
     auto* rightData = buffer.getWritePointer(1);
     
-    // Copy to pre-allocated processing buffers
-    bassBuffer.makeCopyOf(buffer);
-    trebleBuffer.makeCopyOf(buffer);
-    ambienceBuffer.makeCopyOf(buffer);
+    // Copy to pre-allocated processing buffers (shorter blocks reuse the allocation)
+    bassBuffer.makeCopyOf(buffer, true);
+    trebleBuffer.makeCopyOf(buffer, true);
+    ambienceBuffer.makeCopyOf(buffer, true);
     
     // Apply crossover filtering
     auto* bassLeft = bassBuffer.getWritePointer(0);
@@ -222,16 +233,11 @@ void MoreStereoProcessor::processMoreStereo(juce::AudioBuffer<float>& buffer)
     auto* trebleLeft = trebleBuffer.getWritePointer(0);
     auto* trebleRight = trebleBuffer.getWritePointer(1);
     
-    for (int sample = 0; sample < numSamples; ++sample)
-    {
-        // Filter bass frequencies
-        bassLeft[sample] = lowPassLeft.processSingleSampleRaw(bassLeft[sample]);
-        bassRight[sample] = lowPassRight.processSingleSampleRaw(bassRight[sample]);
-        
-        // Filter treble frequencies
-        trebleLeft[sample] = highPassLeft.processSingleSampleRaw(trebleLeft[sample]);
-        trebleRight[sample] = highPassRight.processSingleSampleRaw(trebleRight[sample]);
-    }
+    // A whole channel per filter keeps each one's state in registers
+    lowPassLeft.process(bassLeft, numSamples);
+    lowPassRight.process(bassRight, numSamples);
+    highPassLeft.process(trebleLeft, numSamples);
+    highPassRight.process(trebleRight, numSamples);
     
     // Process bass frequencies (make mono if required)
     if (bassMonoAmount > 0.001f)
@@ -312,8 +318,8 @@ void MoreStereoProcessor::processMoreStereo(juce::AudioBuffer<float>& buffer)
     
     for (int sample = 0; sample < numSamples; ++sample)
     {
-        leftData[sample] = (bassLeft[sample] + trebleLeft[sample]) * outputLevel;
-        rightData[sample] = (bassRight[sample] + trebleRight[sample]) * outputLevel;
+        leftData[sample] = (bassLeft[sample] + trebleLeft[sample]) * outputLevels[sample];
+        rightData[sample] = (bassRight[sample] + trebleRight[sample]) * outputLevels[sample];
         
         // Add ambience
         if (ambienceAmount > 0.001f)
@@ -364,7 +370,11 @@ void MoreStereoProcessor::calculateStereoWidth(const juce::AudioBuffer<float>& b
 //==============================================================================
 juce::AudioProcessorEditor* MoreStereoProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new MoreStereoEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -379,4 +389,15 @@ void MoreStereoProcessor::setStateInformation(const void* data, int sizeInBytes)
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void MoreStereoProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.addUntracked("ambience reverb");
+    footprint.add("ambience delay lines", HyperPrismMemory::bytesOf(ambienceDelayLeft, 1) + HyperPrismMemory::bytesOf(ambienceDelayRight, 1));
+    footprint.add("band buffers", bassBuffer);
+    footprint.add("band buffers", trebleBuffer);
+    footprint.add("ambience buffer", ambienceBuffer);
+    footprint.add("parameter ramps", outputLevelRamp.getAllocatedBytes());
 }
\ No newline at end of file
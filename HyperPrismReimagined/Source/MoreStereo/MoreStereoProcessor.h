@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/ParameterRamp.h"
 
-class MoreStereoProcessor : public juce::AudioProcessor
+class MoreStereoProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +29,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined More Stereo"; }
@@ -62,6 +72,12 @@ public:
     float getStereoWidth() const { return stereoWidth.load(); }
     float getAmbienceLevel() const { return ambienceLevel.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -79,9 +95,16 @@ private:
     std::atomic<float>* ambienceParam = nullptr;
     std::atomic<float>* outputLevelParam = nullptr;
     
-    // DSP components for crossover
-    juce::IIRFilter lowPassLeft, lowPassRight;
-    juce::IIRFilter highPassLeft, highPassRight;
+    // DSP components for crossover, with coefficients designed off the audio thread
+    struct Crossover
+    {
+        HyperPrismDSP::BiquadCoefficients lowPass;
+        HyperPrismDSP::BiquadCoefficients highPass;
+    };
+
+    HyperPrismDSP::Biquad lowPassLeft, lowPassRight;
+    HyperPrismDSP::Biquad highPassLeft, highPassRight;
+    HyperPrismCoefficients::Cache<Crossover> crossover;
     
     // Ambience processing
     juce::dsp::Reverb reverb;
@@ -92,10 +115,13 @@ private:
     juce::AudioBuffer<float> bassBuffer;
     juce::AudioBuffer<float> trebleBuffer;
     juce::AudioBuffer<float> ambienceBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Output level ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp outputLevelRamp;
 
     // State variables
     double currentSampleRate = 44100.0;
-    float previousCrossoverFreq = -1.0f;
     
     // Metering
     std::atomic<float> leftLevel { 0.0f };
@@ -103,5 +129,8 @@ private:
     std::atomic<float> stereoWidth { 0.0f };
     std::atomic<float> ambienceLevel { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoreStereoProcessor)
 };
\ No newline at end of file
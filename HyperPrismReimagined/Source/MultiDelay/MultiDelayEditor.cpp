@@ -5,6 +5,8 @@
 
 #include "MultiDelayEditor.h"
 
+namespace HyperPrismMultiDelayUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -198,6 +200,7 @@ void MultiDelayMeter::paint(juce::Graphics& g)
 
 void MultiDelayMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("MultiDelayMeter::timerCallback");
     float newInputLevel = processor.getInputLevel();
     float newOutputLevel = processor.getOutputLevel();
     auto newDelayLevels = processor.getDelayLevels();
@@ -219,9 +222,10 @@ void MultiDelayMeter::timerCallback()
 // MultiDelayEditor Implementation
 //==============================================================================
 MultiDelayEditor::MultiDelayEditor(MultiDelayProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), multiDelayMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), multiDelayMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments for most commonly used controls
     xParameterIDs.add(MultiDelayProcessor::DELAY1_TIME_ID); // Delay 1 Time
@@ -442,6 +446,7 @@ MultiDelayEditor::~MultiDelayEditor()
 
 void MultiDelayEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("MultiDelayEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -495,7 +500,7 @@ void MultiDelayEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -820,4 +825,6 @@ void MultiDelayEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismMultiDelayUI
\ No newline at end of file
@@ -8,8 +8,11 @@
 #include <JuceHeader.h>
 #include "MultiDelayProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 #include <array>
 
+namespace HyperPrismMultiDelayUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -165,5 +168,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiDelayEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismMultiDelayUI
+
+using HyperPrismMultiDelayUI::MultiDelayEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "MultiDelayProcessor.h"
-#include "MultiDelayEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "MultiDelayEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String MultiDelayProcessor::BYPASS_ID = "bypass";
@@ -196,6 +198,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout MultiDelayProcessor::createP
 //==============================================================================
 void MultiDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare all delay lines
@@ -212,12 +215,21 @@ void MultiDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     inputLevel.store(0.0f);
     outputLevel.store(0.0f);
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    masterMixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    masterMixRamp.setCurrentAndTarget(masterMixParam->load() / 100.0f);
 }
 
 void MultiDelayProcessor::releaseResources()
 {
-    // Nothing specific to release
+    // Unprepared again: the lines hold no samples until the next prepareToPlay
+    for (auto& delayLine : delayLines)
+    {
+        delayLine.leftDelay = juce::dsp::DelayLine<float>(maxDelaySamples);
+        delayLine.rightDelay = juce::dsp::DelayLine<float>(maxDelaySamples);
+    }
 }
 
 bool MultiDelayProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -232,8 +244,13 @@ bool MultiDelayProcessor::isBusesLayoutSupported(const BusesLayout& layouts) con
     return true;
 }
 
-void MultiDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void MultiDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("MultiDelay::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -250,10 +267,12 @@ void MultiDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
 
 void MultiDelayProcessor::processMultiDelay(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("MultiDelay::processMultiDelay");
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
     
-    const float masterMix = masterMixParam->load() / 100.0f;
+    masterMixRamp.setTarget(masterMixParam->load() / 100.0f);
+    const auto* masterMixes = masterMixRamp.process(numSamples);
     const float globalFeedback = globalFeedbackParam->load() / 100.0f;
     
     // Input level metering
@@ -263,7 +282,7 @@ void MultiDelayProcessor::processMultiDelay(juce::AudioBuffer<float>& buffer)
     inputLevel.store(inputRMS);
     
     // Create copies for dry signal
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     // Clear output buffer for wet signal accumulation
     buffer.clear();
@@ -345,16 +364,7 @@ void MultiDelayProcessor::processMultiDelay(juce::AudioBuffer<float>& buffer)
     }
     
     // Mix dry and wet signals
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        const auto* dryData = dryBuffer.getReadPointer(channel);
-        auto* outputData = buffer.getWritePointer(channel);
-        
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            outputData[sample] = (dryData[sample] * (1.0f - masterMix)) + (outputData[sample] * masterMix);
-        }
-    }
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, numChannels, numSamples, masterMixes, masterMixRamp.isConstant());
     
     // Output level metering
     float outputRMS = buffer.getRMSLevel(0, 0, numSamples);
@@ -376,7 +386,11 @@ std::array<float, 4> MultiDelayProcessor::getDelayLevels() const
 //==============================================================================
 juce::AudioProcessorEditor* MultiDelayProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new MultiDelayEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -391,4 +405,15 @@ void MultiDelayProcessor::setStateInformation(const void* data, int sizeInBytes)
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void MultiDelayProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+
+    for (const auto& delayLine : delayLines)
+        footprint.add("delay lines", HyperPrismMemory::bytesOf(delayLine.leftDelay, 1) + HyperPrismMemory::bytesOf(delayLine.rightDelay, 1));
+
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", masterMixRamp.getAllocatedBytes());
 }
\ No newline at end of file
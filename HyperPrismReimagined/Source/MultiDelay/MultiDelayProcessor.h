@@ -5,9 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 #include <array>
 
-class MultiDelayProcessor : public juce::AudioProcessor
+class MultiDelayProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -24,7 +29,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Multi Delay"; }
@@ -79,14 +88,21 @@ public:
     float getOutputLevel() const { return outputLevel.load(); }
     std::array<float, 4> getDelayLevels() const;
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     static constexpr int NUM_DELAYS = 4;
+    static constexpr int maxDelaySamples = 192000;
     
     struct DelayLine
     {
-        juce::dsp::DelayLine<float> leftDelay { 192000 };
-        juce::dsp::DelayLine<float> rightDelay { 192000 };
+        juce::dsp::DelayLine<float> leftDelay { maxDelaySamples };
+        juce::dsp::DelayLine<float> rightDelay { maxDelaySamples };
         std::atomic<float> levelMeter { 0.0f };
     };
     
@@ -113,10 +129,17 @@ private:
     double currentSampleRate = 44100.0;
 
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Master mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp masterMixRamp;
 
     // Metering
     std::atomic<float> inputLevel { 0.0f };
     std::atomic<float> outputLevel { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiDelayProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "NoiseGateEditor.h"
 
+namespace HyperPrismNoiseGateUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -149,6 +151,7 @@ void GateLED::paint(juce::Graphics& g)
 
 void GateLED::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("GateLED::timerCallback");
     bool newState = processor.isGateOpen();
     if (newState != isGateOpen)
     {
@@ -161,9 +164,10 @@ void GateLED::timerCallback()
 // NoiseGateEditor Implementation
 //==============================================================================
 NoiseGateEditor::NoiseGateEditor(NoiseGateProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), gateLED(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), gateLED(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterNames.add("threshold");
@@ -320,6 +324,7 @@ NoiseGateEditor::~NoiseGateEditor()
 
 void NoiseGateEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("NoiseGateEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -361,7 +366,7 @@ void NoiseGateEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -674,4 +679,6 @@ void NoiseGateEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismNoiseGateUI
\ No newline at end of file
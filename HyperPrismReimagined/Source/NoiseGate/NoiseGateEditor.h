@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "NoiseGateProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismNoiseGateUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -148,5 +151,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NoiseGateEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismNoiseGateUI
+
+using HyperPrismNoiseGateUI::NoiseGateEditor;
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "NoiseGateProcessor.h"
-#include "NoiseGateEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "NoiseGateEditor.h"
+#endif
 
 NoiseGateProcessor::NoiseGateProcessor()
     : AudioProcessor(BusesProperties()
@@ -100,12 +102,13 @@ void NoiseGateProcessor::changeProgramName(int index, const juce::String& newNam
 
 void NoiseGateProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Initialize per-channel states
     const int numChannels = getTotalNumInputChannels();
-    envelopeState.resize(numChannels, 0.0f);
-    gateState.resize(numChannels, 0.0f);
+    envelopeState.resize(numChannels);
+    gateState.resize(numChannels);
     holdCounter.resize(numChannels, 0);
     
     // Prepare lookahead buffer
@@ -118,7 +121,11 @@ void NoiseGateProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     lookaheadBuffer.setMaximumDelayInSamples(static_cast<int>(sampleRate * 0.01)); // 10ms max
 
     // Pre-allocate lookahead data buffer
-    lookaheadData.resize(static_cast<size_t>(samplesPerBlock) * 2);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    lookaheadData.resize(static_cast<size_t>(scratchCapacity) * 2);
+
+    rangeRamp.prepare(sampleRate, 0.005, scratchCapacity); // 5ms
+    rangeRamp.setCurrentAndTarget(dbToLinear(range->get()));
 }
 
 void NoiseGateProcessor::releaseResources()
@@ -136,6 +143,11 @@ bool NoiseGateProcessor::isBusesLayoutSupported(const BusesLayout& layouts) cons
 
 void NoiseGateProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("NoiseGate::processBlock");
     juce::ignoreUnused(midiMessages);
 
     juce::ScopedNoDenormals noDenormals;
@@ -159,16 +171,17 @@ void NoiseGateProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mi
     const float attackMs = attack->get();
     const float holdMs = hold->get();
     const float releaseMs = release->get();
-    const float rangeDb = range->get();
-    const float rangeLinear = dbToLinear(rangeDb);
     const float lookaheadMs = lookahead->get();
     
     // Calculate time constants
-    const float attackCoeff = 1.0f - std::exp(-1.0f / (attackMs * 0.001f * currentSampleRate));
-    const float releaseCoeff = 1.0f - std::exp(-1.0f / (releaseMs * 0.001f * currentSampleRate));
+    const float attackPole = std::exp(-1.0f / (attackMs * 0.001f * currentSampleRate));
+    const float releasePole = std::exp(-1.0f / (releaseMs * 0.001f * currentSampleRate));
     const int holdSamples = static_cast<int>(holdMs * 0.001f * currentSampleRate);
     const int lookaheadSamples = static_cast<int>(lookaheadMs * 0.001f * currentSampleRate);
     
+    rangeRamp.setTarget(dbToLinear(range->get()));
+    const auto* rangeGains = rangeRamp.process(numSamples);
+
     // Set lookahead delay
     lookaheadBuffer.setDelay(static_cast<float>(lookaheadSamples));
     
@@ -178,6 +191,12 @@ void NoiseGateProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mi
     for (int channel = 0; channel < totalNumInputChannels; ++channel)
     {
         float* channelData = buffer.getWritePointer(channel);
+
+        // The level rises on attack, and so does the gate as it opens
+        auto& envelope = envelopeState[channel];
+        auto& gate = gateState[channel];
+        envelope.setPoles(attackPole, releasePole);
+        gate.setPoles(attackPole, releasePole);
         
         // Copy data for lookahead processing (pre-allocated buffer)
         jassert(lookaheadData.size() >= static_cast<size_t>(numSamples));
@@ -199,21 +218,12 @@ void NoiseGateProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mi
             }
             
             // Envelope follower
-            if (inputLevel > envelopeState[channel])
-            {
-                // Attack
-                envelopeState[channel] += attackCoeff * (inputLevel - envelopeState[channel]);
-            }
-            else
-            {
-                // Release
-                envelopeState[channel] += releaseCoeff * (inputLevel - envelopeState[channel]);
-            }
+            const float envelopeLevel = envelope.process(inputLevel);
             
             // Gate logic
             float targetGate = 0.0f;
             
-            if (envelopeState[channel] > thresholdLinear)
+            if (envelopeLevel > thresholdLinear)
             {
                 targetGate = 1.0f;
                 holdCounter[channel] = holdSamples;
@@ -229,26 +239,17 @@ void NoiseGateProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mi
             }
             
             // Smooth gate transitions
-            if (targetGate > gateState[channel])
-            {
-                // Opening
-                gateState[channel] += attackCoeff * (targetGate - gateState[channel]);
-            }
-            else
-            {
-                // Closing
-                gateState[channel] += releaseCoeff * (targetGate - gateState[channel]);
-            }
+            const float gateLevel = gate.process(targetGate);
             
             // Apply gate
-            float gateGain = rangeLinear + (1.0f - rangeLinear) * gateState[channel];
+            float gateGain = rangeGains[sample] + (1.0f - rangeGains[sample]) * gateLevel;
             
             // Process through lookahead buffer
             lookaheadBuffer.pushSample(channel, channelData[sample]);
             channelData[sample] = lookaheadBuffer.popSample(channel) * gateGain;
             
             // Update gate status
-            if (gateState[channel] > 0.5f)
+            if (gateLevel > 0.5f)
                 anyGateOpen = true;
         }
     }
@@ -259,12 +260,20 @@ void NoiseGateProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mi
 
 bool NoiseGateProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* NoiseGateProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new NoiseGateEditor(*this);
+   #endif
 }
 
 void NoiseGateProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -302,6 +311,17 @@ void NoiseGateProcessor::setStateInformation(const void* data, int sizeInBytes)
     }
 }
 
+void NoiseGateProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("lookahead delay", HyperPrismMemory::bytesOf(lookaheadBuffer, static_cast<int>(envelopeState.size())));
+    footprint.add("lookahead scratch", lookaheadData);
+    footprint.add("gate state", envelopeState);
+    footprint.add("gate state", gateState);
+    footprint.add("gate state", holdCounter);
+    footprint.add("parameter ramps", rangeRamp.getAllocatedBytes());
+}
+
 float NoiseGateProcessor::dbToLinear(float db) const
 {
     return std::pow(10.0f, db / 20.0f);
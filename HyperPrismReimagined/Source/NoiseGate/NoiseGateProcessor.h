@@ -1,8 +1,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/EnvelopeFollower.h"
+#include "../DSP/ParameterRamp.h"
 
-class NoiseGateProcessor : public juce::AudioProcessor
+class NoiseGateProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     NoiseGateProcessor();
@@ -48,15 +54,21 @@ public:
     // Get gate status for LED
     bool isGateOpen() const { return gateOpen; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // DSP members
     double currentSampleRate;
     
     // Envelope follower state per channel
-    std::vector<float> envelopeState;
+    std::vector<HyperPrismDSP::EnvelopeFollower> envelopeState;
     
     // Gate state per channel
-    std::vector<float> gateState;
+    std::vector<HyperPrismDSP::EnvelopeFollower> gateState;
     std::vector<int> holdCounter;
     
     // Lookahead buffer
@@ -64,6 +76,10 @@ private:
 
     // Pre-allocated lookahead data (real-time safe)
     std::vector<float> lookaheadData;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Closed-gate range ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp rangeRamp;
 
     // Bypass
     juce::AudioParameterBool* bypassParamBool = nullptr;
@@ -75,5 +91,8 @@ private:
     float dbToLinear(float db) const;
     float linearToDb(float linear) const;
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NoiseGateProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "PanEditor.h"
 
+namespace HyperPrismPanUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -191,6 +193,7 @@ void PanMeter::paint(juce::Graphics& g)
 
 void PanMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("PanMeter::timerCallback");
     float newLeftLevel = processor.getLeftLevel();
     float newRightLevel = processor.getRightLevel();
     float newPanPosition = processor.getPanPosition();
@@ -208,9 +211,10 @@ void PanMeter::timerCallback()
 // PanEditor Implementation
 //==============================================================================
 PanEditor::PanEditor(PanProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), panMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), panMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(PanProcessor::PAN_POSITION_ID);
@@ -344,6 +348,7 @@ PanEditor::~PanEditor()
 
 void PanEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("PanEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -390,7 +395,7 @@ void PanEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -676,4 +681,6 @@ void PanEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismPanUI
\ No newline at end of file
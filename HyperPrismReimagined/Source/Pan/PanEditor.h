@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "PanProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismPanUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -153,5 +156,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PanEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismPanUI
+
+using HyperPrismPanUI::PanEditor;
\ No newline at end of file
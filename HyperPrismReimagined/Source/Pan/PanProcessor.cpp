@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "PanProcessor.h"
-#include "PanEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "PanEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String PanProcessor::BYPASS_ID = "bypass";
@@ -82,17 +84,20 @@ juce::AudioProcessorValueTreeState::ParameterLayout PanProcessor::createParamete
 //==============================================================================
 void PanProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Initialize smoothed values
-    smoothedLeftGain.reset(sampleRate, 0.05); // 50ms smoothing
-    smoothedRightGain.reset(sampleRate, 0.05);
-    smoothedLeftGain.setCurrentAndTargetValue(1.0f);
-    smoothedRightGain.setCurrentAndTargetValue(1.0f);
-    
+    loadMeter.prepare(sampleRate);
+
     // Reset metering
     leftLevel.store(0.0f);
     rightLevel.store(0.0f);
 
-    originalBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    originalBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    // Initialize gain ramps
+    leftGainRamp.prepare(sampleRate, 0.05, scratchCapacity); // 50ms smoothing
+    rightGainRamp.prepare(sampleRate, 0.05, scratchCapacity);
+    leftGainRamp.setCurrentAndTarget(1.0f);
+    rightGainRamp.setCurrentAndTarget(1.0f);
 }
 
 void PanProcessor::releaseResources()
@@ -112,8 +117,13 @@ bool PanProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return true;
 }
 
-void PanProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void PanProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Pan::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -130,6 +140,7 @@ void PanProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuff
 
 void PanProcessor::processPanning(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Pan::processPanning");
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
     
@@ -158,15 +169,17 @@ void PanProcessor::processPanning(juce::AudioBuffer<float>& buffer)
         balanceLeftGain = 1.0f - balance;
     }
     
-    // Set target gains for smoothing
-    smoothedLeftGain.setTargetValue(panLeftGain * balanceLeftGain * outputLevel);
-    smoothedRightGain.setTargetValue(panRightGain * balanceRightGain * outputLevel);
+    // Render the gain ramps
+    leftGainRamp.setTarget(panLeftGain * balanceLeftGain * outputLevel);
+    rightGainRamp.setTarget(panRightGain * balanceRightGain * outputLevel);
+    const auto* leftGains = leftGainRamp.process(numSamples);
+    const auto* rightGains = rightGainRamp.process(numSamples);
     
     auto* leftData = buffer.getWritePointer(0);
     auto* rightData = buffer.getWritePointer(1);
     
     // Store original signals for stereo width processing
-    originalBuffer.makeCopyOf(buffer);
+    originalBuffer.makeCopyOf(buffer, true);
     const auto* originalLeft = originalBuffer.getReadPointer(0);
     const auto* originalRight = originalBuffer.getReadPointer(1);
     
@@ -182,17 +195,17 @@ void PanProcessor::processPanning(juce::AudioBuffer<float>& buffer)
         float mono = (leftInput + rightInput) * 0.5f;
         float side = (leftInput - rightInput) * 0.5f * width;
         
-        float widthLeft = mono + side;
-        float widthRight = mono - side;
-        
-        // Apply smoothed gains
-        float currentLeftGain = smoothedLeftGain.getNextValue();
-        float currentRightGain = smoothedRightGain.getNextValue();
-        
-        leftData[sample] = widthLeft * currentLeftGain;
-        rightData[sample] = widthRight * currentRightGain;
-        
-        // Accumulate for metering
+        leftData[sample] = mono + side;
+        rightData[sample] = mono - side;
+    }
+    
+    // Apply ramped gains
+    HyperPrismLargeBlocks::applyGain(leftData, leftGains, leftGainRamp.isConstant(), numSamples);
+    HyperPrismLargeBlocks::applyGain(rightData, rightGains, rightGainRamp.isConstant(), numSamples);
+    
+    // Accumulate for metering
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
         leftLevelSum += std::abs(leftData[sample]);
         rightLevelSum += std::abs(rightData[sample]);
     }
@@ -270,7 +283,11 @@ void PanProcessor::calculatePanGains(float panValue, int panLawType, float& left
 //==============================================================================
 juce::AudioProcessorEditor* PanProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new PanEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -285,4 +302,18 @@ void PanProcessor::setStateInformation(const void* data, int sizeInBytes)
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void PanProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("input copy", originalBuffer);
+    footprint.add("parameter ramps", leftGainRamp.getAllocatedBytes() + rightGainRamp.getAllocatedBytes());
+}
+
+int PanProcessor::getSignalMemorySamples() const
+{
+    // The gain smoothers are the only state, and they land exactly on their
+    // targets once the 50 ms ramp after prepareToPlay has run
+    return static_cast<int>(std::ceil(0.05 * getSampleRate()));
 }
\ No newline at end of file
@@ -5,8 +5,16 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/SignalMemory.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 
-class PanProcessor : public juce::AudioProcessor
+class PanProcessor : public juce::AudioProcessor,
+                     public HyperPrismMemory::Reporter,
+                     public HyperPrismSignalMemory::Bounded
 {
 public:
     //==============================================================================
@@ -23,7 +31,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Pan"; }
@@ -60,6 +72,15 @@ public:
     float getRightLevel() const { return rightLevel.load(); }
     float getPanPosition() const { return panPositionParam ? panPositionParam->load() / 100.0f : 0.0f; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
+    // Input history the output depends on, for chunked offline rendering
+    int getSignalMemorySamples() const override;
+
 private:
     //==============================================================================
     enum PanLawType
@@ -85,14 +106,18 @@ private:
     std::atomic<float>* outputLevelParam = nullptr;
     
     // State variables
-    juce::SmoothedValue<float> smoothedLeftGain;
-    juce::SmoothedValue<float> smoothedRightGain;
+    HyperPrismDSP::ParameterRamp leftGainRamp;
+    HyperPrismDSP::ParameterRamp rightGainRamp;
     
     juce::AudioBuffer<float> originalBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
 
     // Metering
     std::atomic<float> leftLevel { 0.0f };
     std::atomic<float> rightLevel { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PanProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "PhaserEditor.h"
 
+namespace HyperPrismPhaserUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // PhaserEditor Implementation
 //==============================================================================
 PhaserEditor::PhaserEditor(PhaserProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(PhaserProcessor::RATE_ID);
@@ -216,6 +219,7 @@ PhaserEditor::~PhaserEditor()
 
 void PhaserEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("PhaserEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -263,7 +267,7 @@ void PhaserEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -552,4 +556,6 @@ void PhaserEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismPhaserUI
\ No newline at end of file
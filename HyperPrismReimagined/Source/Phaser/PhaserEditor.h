@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "PhaserProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismPhaserUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -130,5 +133,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PhaserEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismPhaserUI
+
+using HyperPrismPhaserUI::PhaserEditor;
\ No newline at end of file
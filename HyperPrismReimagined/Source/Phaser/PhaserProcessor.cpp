@@ -3,15 +3,39 @@
 //==============================================================================
 
 #include "PhaserProcessor.h"
-#include "PhaserEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "PhaserEditor.h"
+#endif
+
+namespace
+{
+    using Param = PhaserProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    // The LFO sweeps the all-pass filters around this centre, in Hz
+    constexpr float centreFrequency = 1100.0f;
+    constexpr float frequencyRange = 900.0f;
+
+    constexpr Table<Param> parameterTable {{{
+        boolParameter(Param::bypass, "bypass", "Bypass", false),
+        floatParameter(Param::rate, "rate", "Rate", 0.01f, 10.0f, 0.01f, 0.5f, 0.5f, 2, " Hz"),
+        floatParameter(Param::depth, "depth", "Depth", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, 1, " %"),
+        floatParameter(Param::feedback, "feedback", "Feedback", -95.0f, 95.0f, 0.1f, 1.0f, 0.0f, 1, " %"),
+        intParameter(Param::stages, "stages", "Stages", 2, 12, 4),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, 1, " %"),
+        HyperPrismModulation::qualityParameter(Param::modulationQuality)
+    }}};
+
+    static_assert(parameterTable.isValid(), "Phaser parameter table out of step with PhaserProcessor::Param");
+}
 
 // Parameter IDs
-const juce::String PhaserProcessor::BYPASS_ID = "bypass";
-const juce::String PhaserProcessor::RATE_ID = "rate";
-const juce::String PhaserProcessor::DEPTH_ID = "depth";
-const juce::String PhaserProcessor::FEEDBACK_ID = "feedback";
-const juce::String PhaserProcessor::STAGES_ID = "stages";
-const juce::String PhaserProcessor::MIX_ID = "mix";
+const juce::String PhaserProcessor::BYPASS_ID = parameterTable[Param::bypass].id;
+const juce::String PhaserProcessor::RATE_ID = parameterTable[Param::rate].id;
+const juce::String PhaserProcessor::DEPTH_ID = parameterTable[Param::depth].id;
+const juce::String PhaserProcessor::FEEDBACK_ID = parameterTable[Param::feedback].id;
+const juce::String PhaserProcessor::STAGES_ID = parameterTable[Param::stages].id;
+const juce::String PhaserProcessor::MIX_ID = parameterTable[Param::mix].id;
 
 //==============================================================================
 PhaserProcessor::PhaserProcessor()
@@ -25,7 +49,8 @@ PhaserProcessor::PhaserProcessor()
                      #endif
                        ),
 #endif
-    valueTreeState(*this, nullptr, "PARAMETERS", createParameterLayout())
+    valueTreeState(*this, nullptr, "PARAMETERS", HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(valueTreeState, parameterTable)
 {
 }
 
@@ -36,7 +61,7 @@ PhaserProcessor::~PhaserProcessor()
 //==============================================================================
 const juce::String PhaserProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Phaser";
 }
 
 bool PhaserProcessor::acceptsMidi() const
@@ -97,30 +122,37 @@ void PhaserProcessor::changeProgramName(int, const juce::String&)
 //==============================================================================
 void PhaserProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
-    // Prepare all-pass filters
+    // Reset all-pass filters
     for (auto& filter : allPassFiltersL)
-        filter.prepare(sampleRate);
+        filter.reset();
     for (auto& filter : allPassFiltersR)
-        filter.prepare(sampleRate);
+        filter.reset();
+    feedbackMemory.fill(0.0f);
     
-    // Initialize smoothed values
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+
+    // Initialize parameter ramps
     const float smoothTime = 0.005f; // 5ms smoothing for real-time response
-    rateSmoothed.reset(sampleRate, smoothTime);
-    depthSmoothed.reset(sampleRate, smoothTime);
-    feedbackSmoothed.reset(sampleRate, smoothTime);
-    mixSmoothed.reset(sampleRate, smoothTime);
+    rateRamp.prepare(sampleRate, smoothTime, scratchCapacity);
+    depthRamp.prepare(sampleRate, smoothTime, scratchCapacity);
+    feedbackRamp.prepare(sampleRate, smoothTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, smoothTime, scratchCapacity);
     
     // Set initial values
-    rateSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(RATE_ID));
-    depthSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(DEPTH_ID));
-    feedbackSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(FEEDBACK_ID));
-    mixSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(MIX_ID));
+    rateRamp.setCurrentAndTarget(parameterValues.get(Param::rate));
+    depthRamp.setCurrentAndTarget(parameterValues.get(Param::depth));
+    feedbackRamp.setCurrentAndTarget(parameterValues.get(Param::feedback));
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
     
-    lfoPhase = 0.0f;
+    // The sweep starts at the centre frequency, where the LFO's zero phase puts it
+    lfo.setPhase(0.0f);
+    coefficients.prepare(HyperPrismModulation::getControlInterval(parameterValues.get(Param::modulationQuality)), scratchCapacity);
+    coefficients.reset(AllPassFilter::getCoefficient(centreFrequency, static_cast<float>(sampleRate)));
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
 }
 
 void PhaserProcessor::releaseResources()
@@ -129,6 +161,7 @@ void PhaserProcessor::releaseResources()
         filter.reset();
     for (auto& filter : allPassFiltersR)
         filter.reset();
+    feedbackMemory.fill(0.0f);
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -152,8 +185,13 @@ bool PhaserProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 }
 #endif
 
-void PhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void PhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Phaser::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -161,81 +199,94 @@ void PhaserProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiB
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    const auto values = parameterValues.snapshot();
+
     // Check bypass
-    if (*valueTreeState.getRawParameterValue(BYPASS_ID) > 0.5f)
+    if (values.isOn(Param::bypass))
         return;
 
-    // Update smoothed parameters
-    rateSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(RATE_ID));
-    depthSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(DEPTH_ID));
-    feedbackSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(FEEDBACK_ID));
-    mixSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(MIX_ID));
+    // Render this block's parameter ramps, shared by both channels
+    const int numSamples = buffer.getNumSamples();
+    rateRamp.setTarget(values[Param::rate]);
+    depthRamp.setTarget(values[Param::depth]);
+    feedbackRamp.setTarget(values[Param::feedback]);
+    mixRamp.setTarget(values[Param::mix] * 0.01f); // Convert to 0-1
+
+    const auto* rates = rateRamp.process(numSamples);
+    const auto* depths = depthRamp.process(numSamples);
+    const auto* feedbacks = feedbackRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
     
-    const int stages = static_cast<int>(*valueTreeState.getRawParameterValue(STAGES_ID));
+    const int stages = static_cast<int>(values[Param::stages]);
+    
+    // Sweep the all-pass coefficient once for both channels, at the control
+    // rate: the LFO's sin and the coefficient's tan run once per control point
+    coefficients.setInterval(HyperPrismModulation::getControlInterval(values[Param::modulationQuality]));
+    const auto* sweep = coefficients.process(numSamples, [&](int sample)
+    {
+        lfo.setFrequency(rates[sample], currentSampleRate);
+        const float lfoValue = lfo.getNextSample(coefficients.getInterval());
+        const float depth = depths[sample] * 0.01f; // Convert to 0-1
+        
+        // Map LFO to frequency range (200Hz - 2000Hz)
+        const float modulatedFreq = centreFrequency + (lfoValue * frequencyRange * depth);
+        return AllPassFilter::getCoefficient(modulatedFreq, static_cast<float>(currentSampleRate));
+    });
     
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     // Process each channel
-    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
+    for (int channel = 0; channel < juce::jmin(totalNumOutputChannels, 2); ++channel)
     {
         auto* channelData = buffer.getWritePointer(channel);
         auto& filters = (channel == 0) ? allPassFiltersL : allPassFiltersR;
+        auto& memory = feedbackMemory[static_cast<size_t>(channel)];
         
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+        for (int sample = 0; sample < numSamples; ++sample)
         {
-            // Update LFO
-            const float rate = rateSmoothed.getNextValue();
-            const float depth = depthSmoothed.getNextValue() * 0.01f; // Convert to 0-1
-            const float feedback = feedbackSmoothed.getNextValue() * 0.01f * 0.95f; // Convert to 0-0.95
-            
-            lfoPhase += rate / static_cast<float>(currentSampleRate);
-            if (lfoPhase >= 1.0f)
-                lfoPhase -= 1.0f;
-            
-            // Calculate LFO value (sine wave)
-            float lfoValue = std::sin(2.0f * juce::MathConstants<float>::pi * lfoPhase);
-            
-            // Map LFO to frequency range (200Hz - 2000Hz)
-            float centerFreq = 1100.0f;
-            float freqRange = 900.0f;
-            float modulatedFreq = centerFreq + (lfoValue * freqRange * depth);
+            const float feedback = feedbacks[sample] * 0.01f * 0.95f; // Convert to 0-0.95
+            const float coefficient = sweep[sample];
             
             // Process through all-pass filters
             float input = channelData[sample];
             float output = input;
             
             // Apply feedback
-            static float feedbackMemoryL = 0.0f;
-            static float feedbackMemoryR = 0.0f;
-            float& feedbackMemory = (channel == 0) ? feedbackMemoryL : feedbackMemoryR;
-            
-            output += feedbackMemory * feedback;
+            output += memory * feedback;
             
             // Process through stages
             for (int stage = 0; stage < stages; ++stage)
             {
-                output = filters[stage].process(output, modulatedFreq);
+                output = filters[stage].process(output, coefficient);
             }
             
-            feedbackMemory = output;
-            
-            // Mix dry and wet signals
-            const float mix = mixSmoothed.getNextValue() * 0.01f;
-            channelData[sample] = input * (1.0f - mix) + output * mix;
+            memory = output;
+            channelData[sample] = output;
         }
     }
+
+    // Mix dry and wet signals
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumOutputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 //==============================================================================
 bool PhaserProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* PhaserProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new PhaserEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -254,40 +305,11 @@ void PhaserProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-//==============================================================================
-juce::AudioProcessorValueTreeState::ParameterLayout PhaserProcessor::createParameterLayout()
+void PhaserProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
 {
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID, "Bypass", false));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        RATE_ID, "Rate", 
-        juce::NormalisableRange<float>(0.01f, 10.0f, 0.01f, 0.5f), 0.5f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 2) + " Hz"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        DEPTH_ID, "Depth", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 50.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        FEEDBACK_ID, "Feedback", 
-        juce::NormalisableRange<float>(-95.0f, 95.0f, 0.1f), 0.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterInt>(
-        STAGES_ID, "Stages", 2, 12, 4));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID, "Mix", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 50.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    return { parameters.begin(), parameters.end() };
-}
\ No newline at end of file
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", rateRamp.getAllocatedBytes() + depthRamp.getAllocatedBytes()
+                                        + feedbackRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+    footprint.add("control signals", coefficients.getAllocatedBytes());
+}
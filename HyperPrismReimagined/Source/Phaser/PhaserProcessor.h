@@ -5,8 +5,17 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-class PhaserProcessor : public juce::AudioProcessor
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/ParameterTable.h"
+#include "../Shared/ModulationQuality.h"
+#include "../DSP/ControlSignal.h"
+#include "../DSP/Lfo.h"
+#include "../DSP/ParameterRamp.h"
+
+class PhaserProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -57,26 +66,33 @@ public:
     static const juce::String STAGES_ID;
     static const juce::String MIX_ID;
 
+    // Parameters in layout order, indexing the table in PhaserProcessor.cpp
+    enum class Param { bypass, rate, depth, feedback, stages, mix, modulationQuality, count };
+
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState valueTreeState;
+    HyperPrismParameters::Values<Param> parameterValues;
     
     // Phaser implementation using all-pass filters
     class AllPassFilter
     {
     public:
-        void prepare(double sampleRate)
+        // All-pass coefficient for a break frequency
+        static float getCoefficient(float frequency, float sampleRate)
         {
-            delay = 0.0f;
-            this->sampleRate = static_cast<float>(sampleRate);
+            float tanValue = std::tan(juce::MathConstants<float>::pi * frequency / sampleRate);
+            return (tanValue - 1.0f) / (tanValue + 1.0f);
         }
         
-        float process(float input, float frequency)
+        float process(float input, float coefficient)
         {
-            // Calculate all-pass coefficient
-            float tanValue = std::tan(juce::MathConstants<float>::pi * frequency / sampleRate);
-            float coefficient = (tanValue - 1.0f) / (tanValue + 1.0f);
-            
             float output = coefficient * input + delay;
             delay = input - coefficient * output;
             
@@ -87,27 +103,31 @@ private:
         
     private:
         float delay = 0.0f;
-        float sampleRate = 44100.0f;
     };
     
     static constexpr int maxStages = 12;
     std::array<AllPassFilter, maxStages> allPassFiltersL;
     std::array<AllPassFilter, maxStages> allPassFiltersR;
+    std::array<float, 2> feedbackMemory {};
     
-    // LFO for modulation
-    float lfoPhase = 0.0f;
+    // LFO for modulation, shared by both channels; the coefficient it sweeps
+    // is computed at the control rate
+    HyperPrismDSP::SineLfo lfo;
+    HyperPrismDSP::ControlSignal coefficients;
     
-    // Parameter smoothing
-    juce::SmoothedValue<float> rateSmoothed;
-    juce::SmoothedValue<float> depthSmoothed;
-    juce::SmoothedValue<float> feedbackSmoothed;
-    juce::SmoothedValue<float> mixSmoothed;
+    // Parameter ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp rateRamp;
+    HyperPrismDSP::ParameterRamp depthRamp;
+    HyperPrismDSP::ParameterRamp feedbackRamp;
+    HyperPrismDSP::ParameterRamp mixRamp;
     
     double currentSampleRate = 44100.0;
 
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
 
-    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PhaserProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "PitchChangerEditor.h"
 
+namespace HyperPrismPitchChangerUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -217,6 +219,7 @@ void PitchMeter::paint(juce::Graphics& g)
 
 void PitchMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("PitchMeter::timerCallback");
     float newInputLevel = processor.getInputLevel();
     float newOutputLevel = processor.getOutputLevel();
     float newDetectedPitch = processor.getPitchDetection();
@@ -237,9 +240,10 @@ void PitchMeter::timerCallback()
 // PitchChangerEditor Implementation
 //==============================================================================
 PitchChangerEditor::PitchChangerEditor(PitchChangerProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), pitchMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), pitchMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(PitchChangerProcessor::PITCH_SHIFT_ID);
@@ -371,6 +375,7 @@ PitchChangerEditor::~PitchChangerEditor()
 
 void PitchChangerEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("PitchChangerEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -415,7 +420,7 @@ void PitchChangerEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -697,4 +702,6 @@ void PitchChangerEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismPitchChangerUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "PitchChangerProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismPitchChangerUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -153,5 +156,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PitchChangerEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismPitchChangerUI
+
+using HyperPrismPitchChangerUI::PitchChangerEditor;
\ No newline at end of file
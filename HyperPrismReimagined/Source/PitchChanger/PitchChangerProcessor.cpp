@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "PitchChangerProcessor.h"
-#include "PitchChangerEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "PitchChangerEditor.h"
+#endif
 
 //==============================================================================
 // PitchShifter Implementation using Signalsmith Stretch
@@ -38,6 +40,16 @@ void PitchChangerProcessor::PitchShifter::reset()
     std::fill(rightOutputBuffer.begin(), rightOutputBuffer.end(), 0.0f);
 }
 
+void PitchChangerProcessor::PitchShifter::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    // The STFT buffers inside Signalsmith Stretch grow with the sample rate but are not exposed
+    footprint.addUntracked("Signalsmith stretcher");
+    footprint.add("stretcher I/O buffers", leftInputBuffer);
+    footprint.add("stretcher I/O buffers", rightInputBuffer);
+    footprint.add("stretcher I/O buffers", leftOutputBuffer);
+    footprint.add("stretcher I/O buffers", rightOutputBuffer);
+}
+
 void PitchChangerProcessor::PitchShifter::setPitchShift(float pitchRatio)
 {
     currentPitchRatio = pitchRatio;
@@ -142,6 +154,12 @@ void PitchChangerProcessor::PitchDetector::reset()
     std::fill(analysisBuffer.begin(), analysisBuffer.end(), 0.0f);
 }
 
+void PitchChangerProcessor::PitchDetector::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("pitch detector", autocorrelationBuffer);
+    footprint.add("pitch detector", analysisBuffer);
+}
+
 float PitchChangerProcessor::PitchDetector::detectPitch(const float* buffer, int bufferSize)
 {
     int analysisLength = std::min(bufferSize, analysisSize);
@@ -205,13 +223,16 @@ const juce::String PitchChangerProcessor::FINE_TUNE_ID = "fineTune";
 const juce::String PitchChangerProcessor::FORMANT_SHIFT_ID = "formantShift";
 const juce::String PitchChangerProcessor::MIX_ID = "mix";
 const juce::String PitchChangerProcessor::OUTPUT_LEVEL_ID = "outputLevel";
+const juce::String PitchChangerProcessor::BACKGROUND_ID = "backgroundThread";
 
 //==============================================================================
 PitchChangerProcessor::PitchChangerProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input",  juce::AudioChannelSet::stereo(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      backgroundWorker(*this, valueTreeState, BACKGROUND_ID,
+                       [this](juce::AudioBuffer<float>& block) { renderBlock(block); })
 {
     // Cache parameter pointers for performance
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -265,19 +286,32 @@ juce::AudioProcessorValueTreeState::ParameterLayout PitchChangerProcessor::creat
         juce::String(), juce::AudioProcessorParameter::genericParameter,
         [](float value, int) { return juce::String(value, 1) + " dB"; }));
 
+    // Signalsmith Stretch is the heaviest DSP in the suite
+    parameters.push_back(HyperPrismBackground::Worker::createParameter(BACKGROUND_ID));
+
     return { parameters.begin(), parameters.end() };
 }
 
 //==============================================================================
 void PitchChangerProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    backgroundWorker.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+    loadMeter.prepare(sampleRate);
+
     // Prepare DSP components
     pitchShifter = std::make_unique<PitchShifter>();
-    pitchShifter->prepare(sampleRate, samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    pitchShifter->prepare(sampleRate, scratchCapacity);
     pitchDetector.prepare(sampleRate);
     
     // Prepare dry buffer for mixing
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.02; // 20ms
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    outputGainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.setCurrentAndTarget(mixParam->load() * 0.01f);
+    outputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     inputLevel.store(0.0f);
@@ -287,6 +321,8 @@ void PitchChangerProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 
 void PitchChangerProcessor::releaseResources()
 {
+    backgroundWorker.release();
+
     if (pitchShifter)
         pitchShifter->reset();
     pitchDetector.reset();
@@ -303,8 +339,18 @@ bool PitchChangerProcessor::isBusesLayoutSupported(const BusesLayout& layouts) c
     return true;
 }
 
-void PitchChangerProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void PitchChangerProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    backgroundWorker.process(buffer);
+}
+
+void PitchChangerProcessor::renderBlock(juce::AudioBuffer<float>& buffer)
+{
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("PitchChanger::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -324,14 +370,17 @@ void PitchChangerProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
 void PitchChangerProcessor::processPitchShifting(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("PitchChanger::processPitchShifting");
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
     
     const float pitchShift = pitchShiftParam->load();
     const float fineTune = fineTuneParam->load();
     const float formantShift = formantShiftParam->load();
-    const float mix = mixParam->load() * 0.01f; // Convert percentage to 0-1
-    const float outputGain = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    mixRamp.setTarget(mixParam->load() * 0.01f); // Convert percentage to 0-1
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* mixes = mixRamp.process(numSamples);
+    const auto* outputGains = outputGainRamp.process(numSamples);
     
     // Calculate pitch ratio from semitones
     float totalPitchShift = pitchShift + (fineTune * 0.01f); // Convert cents to semitones
@@ -346,7 +395,7 @@ void PitchChangerProcessor::processPitchShifting(juce::AudioBuffer<float>& buffe
     }
     
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     float inputLevelSum = 0.0f;
     float outputLevelSum = 0.0f;
@@ -377,7 +426,7 @@ void PitchChangerProcessor::processPitchShifting(juce::AudioBuffer<float>& buffe
             inputLevelSum += std::abs(dry);
             
             // Mix and apply output level
-            float output = (dry * (1.0f - mix) + wet * mix) * outputGain;
+            float output = (dry * (1.0f - mixes[sample]) + wet * mixes[sample]) * outputGains[sample];
             channelData[sample] = output;
             
             outputLevelSum += std::abs(output);
@@ -392,7 +441,11 @@ void PitchChangerProcessor::processPitchShifting(juce::AudioBuffer<float>& buffe
 //==============================================================================
 juce::AudioProcessorEditor* PitchChangerProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new PitchChangerEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -407,4 +460,17 @@ void PitchChangerProcessor::setStateInformation(const void* data, int sizeInByte
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void PitchChangerProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+
+    if (pitchShifter != nullptr)
+        pitchShifter->describeMemory(footprint);
+
+    pitchDetector.describeMemory(footprint);
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes() + outputGainRamp.getAllocatedBytes());
+    backgroundWorker.describeMemory(footprint);
 }
\ No newline at end of file
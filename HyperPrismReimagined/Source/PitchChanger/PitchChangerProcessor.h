@@ -5,9 +5,15 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/BackgroundWorker.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 #include "../../../ThirdParty/signalsmith-stretch/signalsmith-stretch.h"
 
-class PitchChangerProcessor : public juce::AudioProcessor
+class PitchChangerProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -24,7 +30,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Pitch Changer"; }
@@ -55,12 +65,19 @@ public:
     static const juce::String FORMANT_SHIFT_ID;
     static const juce::String MIX_ID;
     static const juce::String OUTPUT_LEVEL_ID;
+    static const juce::String BACKGROUND_ID;
     
     // Metering
     float getInputLevel() const { return inputLevel.load(); }
     float getOutputLevel() const { return outputLevel.load(); }
     float getPitchDetection() const { return pitchDetection.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     // Pitch shifter using Signalsmith Stretch
@@ -77,6 +94,7 @@ private:
         void setFormantShift(float formantRatio);
         
         void processBlock(juce::AudioBuffer<float>& buffer);
+        void describeMemory(HyperPrismMemory::Footprint& footprint) const;
         
     private:
         std::unique_ptr<signalsmith::stretch::SignalsmithStretch<float>> stretcher;
@@ -101,6 +119,7 @@ private:
         void reset();
         
         float detectPitch(const float* buffer, int bufferSize);
+        void describeMemory(HyperPrismMemory::Footprint& footprint) const;
         
     private:
         static constexpr int analysisSize = 1024;
@@ -113,6 +132,7 @@ private:
     };
     
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    void renderBlock(juce::AudioBuffer<float>& buffer);
     void processPitchShifting(juce::AudioBuffer<float>& buffer);
     
     juce::AudioProcessorValueTreeState valueTreeState;
@@ -131,11 +151,22 @@ private:
     
     // State variables
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Mix and output level ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    HyperPrismDSP::ParameterRamp outputGainRamp;
     
     // Metering
     std::atomic<float> inputLevel { 0.0f };
     std::atomic<float> outputLevel { 0.0f };
     std::atomic<float> pitchDetection { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    // Declared last: its thread calls renderBlock until it is destroyed
+    HyperPrismBackground::Worker backgroundWorker;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PitchChangerProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "QuasiStereoEditor.h"
 
+namespace HyperPrismQuasiStereoUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -182,6 +184,7 @@ void StereoWidthMeter::paint(juce::Graphics& g)
 
 void StereoWidthMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("StereoWidthMeter::timerCallback");
     float newLeftLevel = processor.getLeftLevel();
     float newRightLevel = processor.getRightLevel();
     float newStereoWidth = processor.getStereoWidth();
@@ -199,9 +202,10 @@ void StereoWidthMeter::timerCallback()
 // QuasiStereoEditor Implementation
 //==============================================================================
 QuasiStereoEditor::QuasiStereoEditor(QuasiStereoProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), stereoWidthMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), stereoWidthMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(QuasiStereoProcessor::WIDTH_ID);
@@ -343,6 +347,7 @@ QuasiStereoEditor::~QuasiStereoEditor()
 
 void QuasiStereoEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("QuasiStereoEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -388,7 +393,7 @@ void QuasiStereoEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -677,4 +682,6 @@ void QuasiStereoEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismQuasiStereoUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "QuasiStereoProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismQuasiStereoUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -157,5 +160,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(QuasiStereoEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismQuasiStereoUI
+
+using HyperPrismQuasiStereoUI::QuasiStereoEditor;
\ No newline at end of file
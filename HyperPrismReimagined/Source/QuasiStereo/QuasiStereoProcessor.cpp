@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "QuasiStereoProcessor.h"
-#include "QuasiStereoEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "QuasiStereoEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String QuasiStereoProcessor::BYPASS_ID = "bypass";
@@ -19,7 +21,13 @@ QuasiStereoProcessor::QuasiStereoProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input",  juce::AudioChannelSet::mono(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      highFreqShelf(valueTreeState, { HIGH_FREQ_ENHANCE_ID }, [this](double sampleRate)
+      {
+          const float highFreqEnhance = highFreqEnhanceParam->load() / 100.0f;
+          float gain = 1.0f + highFreqEnhance * 2.0f; // Up to +6dB boost
+          return HyperPrismCoefficients::fromJuce(juce::IIRCoefficients::makeHighShelf(sampleRate, 4000.0, 0.7, gain));
+      })
 {
     // Cache parameter pointers for performance
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -87,19 +95,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout QuasiStereoProcessor::create
 //==============================================================================
 void QuasiStereoProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare delay line
     delayLine.prepare({ sampleRate, static_cast<juce::uint32>(samplesPerBlock), 1 });
     delayLine.reset();
     
-    // Prepare all-pass filter for phase shifting
-    allPassFilter.prepare({ sampleRate, static_cast<juce::uint32>(samplesPerBlock), 2 });
-    allPassFilter.reset();
-    
     // Initialize filters
-    previousHighFreqEnhance = -1.0f;
+    highFreqShelf.prepare(sampleRate);
+    highFreqFilterLeft.setCoefficients(highFreqShelf.get());
+    highFreqFilterRight.setCoefficients(highFreqShelf.get());
     phaseAccumulator = 0.0f;
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    outputLevelRamp.prepare(sampleRate, 0.005, scratchCapacity); // 5ms
+    outputLevelRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     leftLevel.store(0.0f);
@@ -112,7 +123,6 @@ void QuasiStereoProcessor::releaseResources()
     // Reset filters
     highFreqFilterLeft.reset();
     highFreqFilterRight.reset();
-    allPassFilter.reset();
 }
 
 bool QuasiStereoProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -128,8 +138,13 @@ bool QuasiStereoProcessor::isBusesLayoutSupported(const BusesLayout& layouts) co
             mainInput == juce::AudioChannelSet::stereo());
 }
 
-void QuasiStereoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void QuasiStereoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("QuasiStereo::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -158,30 +173,23 @@ void QuasiStereoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
 
 void QuasiStereoProcessor::processQuasiStereo(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("QuasiStereo::processQuasiStereo");
     const int numSamples = buffer.getNumSamples();
     
     const float width = widthParam->load() / 100.0f;
     const float delayTimeMs = delayTimeParam->load();
     const float frequencyShift = frequencyShiftParam->load();
     const float phaseShift = phaseShiftParam->load() * juce::MathConstants<float>::pi / 180.0f;
-    const float highFreqEnhance = highFreqEnhanceParam->load() / 100.0f;
-    const float outputLevel = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    outputLevelRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputLevels = outputLevelRamp.process(numSamples);
     
-    // Update high frequency enhancement filter if needed
-    if (std::abs(highFreqEnhance - previousHighFreqEnhance) > 0.001f)
+    // Glide to high frequency enhancement coefficients published since the last block
+    if (highFreqShelf.update(isNonRealtime()))
     {
-        float gain = 1.0f + highFreqEnhance * 2.0f; // Up to +6dB boost
-        auto highShelfCoeffs = juce::IIRCoefficients::makeHighShelf(currentSampleRate, 4000.0, 0.7, gain);
-        highFreqFilterLeft.setCoefficients(highShelfCoeffs);
-        highFreqFilterRight.setCoefficients(highShelfCoeffs);
-        previousHighFreqEnhance = highFreqEnhance;
+        highFreqFilterLeft.rampTo(highFreqShelf.get(), HyperPrismCoefficients::rampSamples);
+        highFreqFilterRight.rampTo(highFreqShelf.get(), HyperPrismCoefficients::rampSamples);
     }
     
-    // Update all-pass filter for phase shifting
-    float allPassFreq = 1000.0f + frequencyShift * 50.0f; // Vary filter frequency
-    auto allPassCoeffs = juce::dsp::IIR::Coefficients<float>::makeAllPass(currentSampleRate, allPassFreq);
-    allPassFilter.state = *allPassCoeffs;
-    
     float delaySamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
     
     auto* leftData = buffer.getWritePointer(0);
@@ -198,13 +206,10 @@ void QuasiStereoProcessor::processQuasiStereo(juce::AudioBuffer<float>& buffer)
         float delayedSample = delayLine.popSample(0, delaySamples, true);
         delayLine.pushSample(0, input);
         
-        // Apply frequency-dependent phase shift using all-pass filter
+        // The phase shifting is handled by the phase accumulator below
         float phasedInput = input;
         float phasedDelayed = delayedSample;
         
-        // Skip all-pass filter processing for now to avoid performance issues
-        // The phase shifting is handled by the phase accumulator below
-        
         // Apply phase shift
         phaseAccumulator += (juce::MathConstants<float>::twoPi * frequencyShift) / static_cast<float>(currentSampleRate);
         if (phaseAccumulator >= juce::MathConstants<float>::twoPi)
@@ -218,15 +223,15 @@ void QuasiStereoProcessor::processQuasiStereo(juce::AudioBuffer<float>& buffer)
         float right = phaseShiftedInput + (phasedDelayed * width);
         
         // Apply high frequency enhancement
-        left = highFreqFilterLeft.processSingleSampleRaw(left);
-        right = highFreqFilterRight.processSingleSampleRaw(right);
+        left = highFreqFilterLeft.processSample(left);
+        right = highFreqFilterRight.processSample(right);
         
         // Apply width control using M/S processing
         float mono = (left + right) * 0.5f;
         float side = (left - right) * 0.5f * width;
         
-        leftData[sample] = (mono + side) * outputLevel;
-        rightData[sample] = (mono - side) * outputLevel;
+        leftData[sample] = (mono + side) * outputLevels[sample];
+        rightData[sample] = (mono - side) * outputLevels[sample];
         
         // Accumulate for metering
         leftLevelSum += std::abs(leftData[sample]);
@@ -275,7 +280,11 @@ void QuasiStereoProcessor::calculateStereoWidth(const juce::AudioBuffer<float>&
 //==============================================================================
 juce::AudioProcessorEditor* QuasiStereoProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new QuasiStereoEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -290,4 +299,11 @@ void QuasiStereoProcessor::setStateInformation(const void* data, int sizeInBytes
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void QuasiStereoProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay line", HyperPrismMemory::bytesOf(delayLine, 1));
+    footprint.add("parameter ramps", outputLevelRamp.getAllocatedBytes());
 }
\ No newline at end of file
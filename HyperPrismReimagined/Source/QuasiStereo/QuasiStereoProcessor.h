@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/ParameterRamp.h"
 
-class QuasiStereoProcessor : public juce::AudioProcessor
+class QuasiStereoProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +29,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Quasi Stereo"; }
@@ -61,6 +71,12 @@ public:
     float getRightLevel() const { return rightLevel.load(); }
     float getStereoWidth() const { return stereoWidth.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -80,12 +96,15 @@ private:
     
     // DSP components
     juce::dsp::DelayLine<float> delayLine { 4800 }; // Max 100ms at 48kHz
-    juce::IIRFilter highFreqFilterLeft, highFreqFilterRight;
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> allPassFilter;
+    HyperPrismDSP::Biquad highFreqFilterLeft, highFreqFilterRight;
+    HyperPrismCoefficients::Cache<HyperPrismDSP::BiquadCoefficients> highFreqShelf; // Designed off the audio thread
+
+    // Output level ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp outputLevelRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // State variables
     double currentSampleRate = 44100.0;
-    float previousHighFreqEnhance = -1.0f;
     float phaseAccumulator = 0.0f;
     
     // Metering
@@ -93,5 +112,8 @@ private:
     std::atomic<float> rightLevel { 0.0f };
     std::atomic<float> stereoWidth { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(QuasiStereoProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,455 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Editor Implementation
+//==============================================================================
+
+#include "RackEditor.h"
+#include "../Shared/EffectRegistry.h"
+
+//==============================================================================
+// RackSlotRow Implementation
+//==============================================================================
+RackSlotRow::RackSlotRow(RackProcessor& p, int slotIndex)
+    : processor(p), slot(slotIndex)
+{
+    // Effect selector: item IDs are registry positions + 1
+    const auto& effects = HyperPrismRegistry::getAllEffects();
+    for (size_t i = 0; i < effects.size(); ++i)
+        effectBox.addItem(effects[i].name, static_cast<int>(i) + 1);
+
+    effectBox.setColour(juce::ComboBox::backgroundColourId, HyperPrismLookAndFeel::Colors::surfaceVariant);
+    effectBox.setColour(juce::ComboBox::textColourId, HyperPrismLookAndFeel::Colors::onSurface);
+    effectBox.setColour(juce::ComboBox::arrowColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    effectBox.setColour(juce::ComboBox::outlineColourId, HyperPrismLookAndFeel::Colors::outline);
+    effectBox.setTextWhenNothingSelected("Add effect...");
+    effectBox.onChange = [this]
+    {
+        const auto name = effectBox.getText();
+        if (name.isEmpty())
+            return;
+
+        if (isEmpty)
+            processor.insertEffect(slot, name);
+        else
+            processor.replaceEffect(slot, name);
+
+        if (onSelect)
+            onSelect(slot);
+    };
+    addAndMakeVisible(effectBox);
+
+    parallelButton.setButtonText("PAR");
+    parallelButton.setClickingTogglesState(true);
+    parallelButton.setTooltip("Take the same input as the slot above and mix with it");
+    parallelButton.onClick = [this] { processor.setSlotParallel(slot, parallelButton.getToggleState()); };
+    addAndMakeVisible(parallelButton);
+
+    oversampleButton.setButtonText("OS");
+    oversampleButton.setClickingTogglesState(true);
+    oversampleButton.setTooltip("Run inside the oversampled section; neighbouring OS slots share one up/down filter pair");
+    oversampleButton.onClick = [this] { processor.setSlotOversampled(slot, oversampleButton.getToggleState()); };
+    addAndMakeVisible(oversampleButton);
+
+    bypassButton.setButtonText("BYP");
+    bypassButton.setClickingTogglesState(true);
+    bypassButton.setTooltip("Bypass this slot");
+    addAndMakeVisible(bypassButton);
+
+    bypassAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        processor.getValueTreeState(), RackProcessor::getSlotBypassID(slot), bypassButton);
+
+    upButton.setButtonText("UP");
+    upButton.setTooltip("Move earlier in the chain");
+    upButton.onClick = [this] { processor.moveEffect(slot, slot - 1); if (onSelect) onSelect(slot - 1); };
+    addAndMakeVisible(upButton);
+
+    downButton.setButtonText("DN");
+    downButton.setTooltip("Move later in the chain");
+    downButton.onClick = [this] { processor.moveEffect(slot, slot + 1); if (onSelect) onSelect(slot + 1); };
+    addAndMakeVisible(downButton);
+
+    removeButton.setButtonText("X");
+    removeButton.setTooltip("Remove from the chain");
+    removeButton.onClick = [this] { processor.removeEffect(slot); };
+    addAndMakeVisible(removeButton);
+}
+
+void RackSlotRow::setEffect(const juce::String& effectName, int numEffects)
+{
+    isEmpty = effectName.isEmpty();
+
+    int itemId = 0;
+    const auto& effects = HyperPrismRegistry::getAllEffects();
+    for (size_t i = 0; i < effects.size(); ++i)
+        if (effects[i].name == effectName)
+            itemId = static_cast<int>(i) + 1;
+
+    effectBox.setSelectedId(itemId, juce::dontSendNotification);
+
+    parallelButton.setVisible(! isEmpty && slot > 0);
+    parallelButton.setToggleState(processor.isSlotParallel(slot), juce::dontSendNotification);
+    oversampleButton.setVisible(! isEmpty);
+    oversampleButton.setToggleState(processor.isSlotOversampled(slot), juce::dontSendNotification);
+    bypassButton.setVisible(! isEmpty);
+    upButton.setVisible(! isEmpty);
+    downButton.setVisible(! isEmpty);
+    removeButton.setVisible(! isEmpty);
+
+    upButton.setEnabled(slot > 0);
+    downButton.setEnabled(slot < numEffects - 1);
+
+    if (isEmpty)
+        load = 0.0f;
+
+    repaint();
+}
+
+void RackSlotRow::setSelected(bool shouldBeSelected)
+{
+    if (isSelected != shouldBeSelected)
+    {
+        isSelected = shouldBeSelected;
+        repaint();
+    }
+}
+
+void RackSlotRow::setLoad(float newLoad)
+{
+    if (std::abs(load - newLoad) > 0.001f)
+    {
+        load = newLoad;
+        repaint();
+    }
+}
+
+void RackSlotRow::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat().reduced(1.0f);
+
+    g.setColour(isSelected ? HyperPrismLookAndFeel::Colors::surfaceVariant
+                           : HyperPrismLookAndFeel::Colors::surface);
+    g.fillRoundedRectangle(bounds, 4.0f);
+
+    g.setColour(isSelected ? HyperPrismLookAndFeel::Colors::primary
+                           : HyperPrismLookAndFeel::Colors::outline.withAlpha(0.5f));
+    g.drawRoundedRectangle(bounds, 4.0f, 1.0f);
+
+    // Parallel slots are marked on the left edge
+    if (! isEmpty && parallelButton.getToggleState())
+    {
+        g.setColour(HyperPrismLookAndFeel::Colors::modulation);
+        g.fillRect(bounds.removeFromLeft(3.0f));
+    }
+
+    // Slot number
+    g.setColour(HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    g.setFont(juce::Font(juce::FontOptions(11.0f).withStyle("Bold")));
+    g.drawText(isEmpty ? juce::String("+") : juce::String(slot + 1),
+               getLocalBounds().removeFromLeft(24), juce::Justification::centred);
+
+    // Time spent in this slot, as a share of the block budget
+    if (! isEmpty)
+    {
+        g.setColour(load >= 0.5f ? HyperPrismLookAndFeel::Colors::warning : HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+        g.setFont(juce::Font(juce::FontOptions(10.0f)));
+        g.drawText(juce::String(load * 100.0f, 1) + "%",
+                   getLocalBounds().removeFromRight(52).withTrimmedRight(6),
+                   juce::Justification::centredRight);
+    }
+}
+
+void RackSlotRow::resized()
+{
+    auto bounds = getLocalBounds().reduced(4);
+    bounds.removeFromLeft(20);
+    bounds.removeFromRight(48);
+
+    removeButton.setBounds(bounds.removeFromRight(26));
+    bounds.removeFromRight(2);
+    downButton.setBounds(bounds.removeFromRight(30));
+    bounds.removeFromRight(2);
+    upButton.setBounds(bounds.removeFromRight(30));
+    bounds.removeFromRight(4);
+    bypassButton.setBounds(bounds.removeFromRight(40));
+    bounds.removeFromRight(2);
+    oversampleButton.setBounds(bounds.removeFromRight(30));
+    bounds.removeFromRight(2);
+    parallelButton.setBounds(bounds.removeFromRight(36));
+    bounds.removeFromRight(6);
+
+    effectBox.setBounds(bounds);
+}
+
+void RackSlotRow::mouseDown(const juce::MouseEvent&)
+{
+    if (! isEmpty && onSelect)
+        onSelect(slot);
+}
+
+//==============================================================================
+// RackEditor Implementation
+//==============================================================================
+RackEditor::RackEditor(RackProcessor& p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
+{
+    setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
+
+    // Title
+    titleLabel.setText("RACK", juce::dontSendNotification);
+    titleLabel.setFont(juce::Font(juce::FontOptions(16.0f).withStyle("Bold")));
+    titleLabel.setColour(juce::Label::textColourId, HyperPrismLookAndFeel::Colors::onSurface);
+    titleLabel.setJustificationType(juce::Justification::centred);
+    addAndMakeVisible(titleLabel);
+
+    // Brand label
+    brandLabel.setText("HyperPrism Reimagined", juce::dontSendNotification);
+    brandLabel.setFont(juce::Font(juce::FontOptions(10.0f)));
+    brandLabel.setColour(juce::Label::textColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    brandLabel.setJustificationType(juce::Justification::centred);
+    addAndMakeVisible(brandLabel);
+
+    // Bypass button (top right)
+    bypassButton.setButtonText("BYPASS");
+    bypassButton.setClickingTogglesState(true);
+    bypassButton.setTooltip("Bypass the whole chain");
+    addAndMakeVisible(bypassButton);
+
+    // Output
+    outputLevelSlider.setSliderStyle(juce::Slider::RotaryVerticalDrag);
+    outputLevelSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 80, 20);
+    outputLevelSlider.setColour(juce::Slider::rotarySliderFillColourId, HyperPrismLookAndFeel::Colors::output);
+    outputLevelSlider.setTooltip("Output level after the last slot");
+    addAndMakeVisible(outputLevelSlider);
+
+    outputLevelLabel.setText("Output", juce::dontSendNotification);
+    outputLevelLabel.setJustificationType(juce::Justification::centred);
+    outputLevelLabel.setColour(juce::Label::textColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    addAndMakeVisible(outputLevelLabel);
+
+    // Oversampling
+    auto setupComboBox = [this](juce::ComboBox& box)
+    {
+        box.setColour(juce::ComboBox::backgroundColourId, HyperPrismLookAndFeel::Colors::surfaceVariant);
+        box.setColour(juce::ComboBox::textColourId, HyperPrismLookAndFeel::Colors::onSurface);
+        box.setColour(juce::ComboBox::arrowColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+        box.setColour(juce::ComboBox::outlineColourId, HyperPrismLookAndFeel::Colors::outline);
+        addAndMakeVisible(box);
+    };
+
+    oversamplingFactorBox.addItem("2x", 2);
+    oversamplingFactorBox.addItem("4x", 4);
+    oversamplingFactorBox.addItem("8x", 8);
+    oversamplingFactorBox.setTooltip("Oversampling factor for the slots marked OS");
+    setupComboBox(oversamplingFactorBox);
+
+    oversamplingFilterBox.addItem("IIR", 1);
+    oversamplingFilterBox.addItem("Linear phase", 2);
+    oversamplingFilterBox.setTooltip("IIR filters add little latency; linear-phase filters keep the phase intact at the cost of more latency");
+    setupComboBox(oversamplingFilterBox);
+
+    auto applyOversampling = [this]
+    {
+        audioProcessor.setOversampling(oversamplingFactorBox.getSelectedId(),
+                                       oversamplingFilterBox.getSelectedId() == 2);
+    };
+    oversamplingFactorBox.onChange = applyOversampling;
+    oversamplingFilterBox.onChange = applyOversampling;
+
+    oversamplingLabel.setText("Oversampling", juce::dontSendNotification);
+    oversamplingLabel.setJustificationType(juce::Justification::centred);
+    oversamplingLabel.setColour(juce::Label::textColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    addAndMakeVisible(oversamplingLabel);
+
+    // Create attachments
+    auto& vts = audioProcessor.getValueTreeState();
+    bypassAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        vts, RackProcessor::BYPASS_ID, bypassButton);
+    outputLevelAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        vts, RackProcessor::OUTPUT_LEVEL_ID, outputLevelSlider);
+
+    // Slot list
+    for (int slot = 0; slot < RackProcessor::maxSlots; ++slot)
+    {
+        auto* row = rows.add(new RackSlotRow(audioProcessor, slot));
+        row->onSelect = [this](int slotToSelect) { selectSlot(slotToSelect); };
+        addChildComponent(row);
+    }
+
+    // Selected effect
+    nodeEditorViewport.setScrollBarsShown(true, false);
+    addAndMakeVisible(nodeEditorViewport);
+
+    emptyLabel.setText("Add an effect to start the chain", juce::dontSendNotification);
+    emptyLabel.setJustificationType(juce::Justification::centred);
+    emptyLabel.setColour(juce::Label::textColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    addAndMakeVisible(emptyLabel);
+
+    audioProcessor.addChangeListener(this);
+    refreshChain();
+    selectSlot(0);
+
+    // Per-slot load readouts
+    startTimerHz(10);
+
+    setSize(900, 540);
+    setResizable(true, true);
+    setResizeLimits(780, 440, 1400, 1000);
+}
+
+RackEditor::~RackEditor()
+{
+    stopTimer();
+    audioProcessor.removeChangeListener(this);
+
+    // The node's editor must go before the node
+    nodeEditorViewport.setViewedComponent(nullptr, false);
+    nodeEditor.reset();
+    selectedNode.reset();
+
+    setLookAndFeel(nullptr);
+}
+
+void RackEditor::paint(juce::Graphics& g)
+{
+    HYPERPRISM_TRACE_SCOPE("RackEditor::paint");
+    g.fillAll(HyperPrismLookAndFeel::Colors::background);
+
+    // Accent line
+    g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
+    g.fillRect(12, 4, getWidth() - 24, 2);
+
+    // Version
+    g.setColour(HyperPrismLookAndFeel::Colors::outline);
+    g.setFont(juce::Font(juce::FontOptions(9.0f)));
+    g.drawText("v1.0.0", getLocalBounds().removeFromBottom(20).removeFromRight(70),
+               juce::Justification::centredRight);
+
+    // Column section headers
+    auto paintColumnHeader = [&](int x, int y, int width,
+                                  const juce::String& title, juce::Colour color)
+    {
+        g.setColour(color.withAlpha(0.7f));
+        g.setFont(juce::Font(juce::FontOptions(9.0f).withStyle("Bold")));
+        g.drawText(title, x, y, width, 14, juce::Justification::centredLeft);
+        g.setColour(HyperPrismLookAndFeel::Colors::outline.withAlpha(0.3f));
+        g.drawLine(static_cast<float>(x), static_cast<float>(y + 14),
+                   static_cast<float>(x + width), static_cast<float>(y + 14), 0.5f);
+    };
+
+    paintColumnHeader(rows[0]->getX(), rows[0]->getY() - 20, rows[0]->getWidth(),
+                      "CHAIN", HyperPrismLookAndFeel::Colors::primary);
+
+    const auto selectedTitle = selectedNode != nullptr
+        ? "SLOT " + juce::String(selectedSlot + 1) + ": " + selectedNode->effect.toUpperCase()
+        : juce::String("EFFECT");
+    paintColumnHeader(nodeEditorViewport.getX(), nodeEditorViewport.getY() - 20, nodeEditorViewport.getWidth(),
+                      selectedTitle, HyperPrismLookAndFeel::Colors::modulation);
+}
+
+void RackEditor::resized()
+{
+    auto bounds = getLocalBounds();
+
+    // === HEADER (72px) ===
+    auto header = bounds.removeFromTop(72);
+    titleLabel.setBounds(header.getX() + 12, 30, header.getWidth() - 112, 20);
+    brandLabel.setBounds(header.getX() + 12, 50, header.getWidth() - 112, 16);
+    bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
+
+    // === FOOTER ===
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
+
+    // === CONTENT ===
+    bounds.reduce(12, 4);
+    bounds.removeFromTop(20);
+
+    // --- Left: slot list with the output knob underneath ---
+    auto chainArea = bounds.removeFromLeft(412);
+    const int rowHeight = 36;
+
+    for (auto* row : rows)
+        row->setBounds(chainArea.removeFromTop(rowHeight));
+
+    chainArea.removeFromTop(12);
+    auto controlsArea = chainArea.removeFromTop(100);
+    auto outputArea = controlsArea.removeFromLeft(100);
+    outputLevelSlider.setBounds(outputArea.removeFromTop(82).withSizeKeepingCentre(64, 82));
+    outputLevelLabel.setBounds(outputArea);
+
+    auto oversamplingArea = controlsArea.withSizeKeepingCentre(160, 80);
+    oversamplingFactorBox.setBounds(oversamplingArea.removeFromTop(24));
+    oversamplingArea.removeFromTop(6);
+    oversamplingFilterBox.setBounds(oversamplingArea.removeFromTop(24));
+    oversamplingLabel.setBounds(oversamplingArea.removeFromTop(20));
+
+    // --- Right: the selected effect's parameters ---
+    bounds.removeFromLeft(16);
+    nodeEditorViewport.setBounds(bounds);
+    emptyLabel.setBounds(bounds);
+
+    if (nodeEditor != nullptr)
+        nodeEditor->setSize(nodeEditorViewport.getMaximumVisibleWidth(), nodeEditor->getHeight());
+}
+
+//==============================================================================
+void RackEditor::changeListenerCallback(juce::ChangeBroadcaster*)
+{
+    refreshChain();
+}
+
+void RackEditor::timerCallback()
+{
+    for (int slot = 0; slot < rows.size(); ++slot)
+        if (auto node = audioProcessor.getNode(slot))
+            rows[slot]->setLoad(node->loadMeter.getLoad());
+}
+
+void RackEditor::refreshChain()
+{
+    oversamplingFactorBox.setSelectedId(audioProcessor.getOversamplingFactor(), juce::dontSendNotification);
+    oversamplingFilterBox.setSelectedId(audioProcessor.isOversamplingLinearPhase() ? 2 : 1, juce::dontSendNotification);
+
+    const auto effects = audioProcessor.getChainEffects();
+    const int numEffects = effects.size();
+
+    for (int slot = 0; slot < rows.size(); ++slot)
+    {
+        rows[slot]->setEffect(slot < numEffects ? effects[slot] : juce::String(), numEffects);
+        rows[slot]->setVisible(slot <= numEffects);
+    }
+
+    // Follow the selected effect if it moved; otherwise stay near the old slot
+    int slotToSelect = juce::jmin(selectedSlot, numEffects - 1);
+    for (int slot = 0; slot < numEffects; ++slot)
+        if (selectedNode != nullptr && audioProcessor.getNode(slot) == selectedNode)
+            slotToSelect = slot;
+
+    selectSlot(slotToSelect);
+}
+
+void RackEditor::selectSlot(int slot)
+{
+    auto node = audioProcessor.getNode(slot);
+    selectedSlot = node != nullptr ? slot : -1;
+
+    for (int i = 0; i < rows.size(); ++i)
+        rows[i]->setSelected(i == selectedSlot);
+
+    if (node != selectedNode)
+    {
+        // The node's editor must go before the node
+        nodeEditorViewport.setViewedComponent(nullptr, false);
+        nodeEditor.reset();
+        selectedNode = std::move(node);
+
+        if (selectedNode != nullptr)
+        {
+            nodeEditor = std::make_unique<juce::GenericAudioProcessorEditor>(*selectedNode->processor);
+            nodeEditor->setSize(nodeEditorViewport.getMaximumVisibleWidth(), nodeEditor->getHeight());
+            nodeEditorViewport.setViewedComponent(nodeEditor.get(), false);
+        }
+    }
+
+    emptyLabel.setVisible(selectedNode == nullptr);
+    repaint();
+}
@@ -0,0 +1,114 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Editor
+// Slot list for building the chain, plus the selected effect's parameters
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RackProcessor.h"
+#include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
+
+//==============================================================================
+// One row of the slot list: effect selector, parallel routing, oversampling,
+// slot bypass, move and remove
+//==============================================================================
+class RackSlotRow : public juce::Component
+{
+public:
+    RackSlotRow(RackProcessor& processor, int slotIndex);
+    ~RackSlotRow() override = default;
+
+    // Shows the effect at this slot, or an "add" row when effectName is empty
+    void setEffect(const juce::String& effectName, int numEffects);
+    void setSelected(bool shouldBeSelected);
+    void setLoad(float newLoad);
+
+    std::function<void(int)> onSelect;
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void mouseDown(const juce::MouseEvent& event) override;
+
+private:
+    RackProcessor& processor;
+    const int slot;
+    bool isEmpty = true;
+    bool isSelected = false;
+    float load = 0.0f;
+
+    juce::ComboBox effectBox;
+    juce::TextButton parallelButton;
+    juce::TextButton oversampleButton;
+    juce::TextButton bypassButton;
+    juce::TextButton upButton;
+    juce::TextButton downButton;
+    juce::TextButton removeButton;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> bypassAttachment;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RackSlotRow)
+};
+
+//==============================================================================
+// Main Editor
+//==============================================================================
+class RackEditor : public juce::AudioProcessorEditor,
+                   private juce::ChangeListener,
+                   private juce::Timer
+{
+public:
+    RackEditor(RackProcessor&);
+    ~RackEditor() override;
+
+    void paint(juce::Graphics&) override;
+    void resized() override;
+
+private:
+    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
+    void timerCallback() override;
+
+    // Re-reads the chain after an edit and keeps the selection on the same effect
+    void refreshChain();
+    void selectSlot(int slot);
+
+    RackProcessor& audioProcessor;
+    HyperPrismLookAndFeel customLookAndFeel;
+
+    // Title
+    juce::Label titleLabel;
+    juce::Label brandLabel;
+
+    // Bypass
+    juce::TextButton bypassButton;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> bypassAttachment;
+
+    // Output
+    juce::Slider outputLevelSlider;
+    juce::Label outputLevelLabel;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> outputLevelAttachment;
+
+    // Oversampling for the slots marked OS
+    juce::ComboBox oversamplingFactorBox;
+    juce::ComboBox oversamplingFilterBox;
+    juce::Label oversamplingLabel;
+
+    // Chain
+    juce::OwnedArray<RackSlotRow> rows;
+    int selectedSlot = -1;
+
+    // The selected effect's parameters. The node is held so it outlives its
+    // editor even if the chain drops it first; declared before the editor so
+    // the editor is destroyed first.
+    std::shared_ptr<RackProcessor::Node> selectedNode;
+    std::unique_ptr<juce::GenericAudioProcessorEditor> nodeEditor;
+    juce::Viewport nodeEditorViewport;
+    juce::Label emptyLabel;
+
+    juce::TooltipWindow tooltipWindow { this, 500 };
+
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RackEditor)
+};
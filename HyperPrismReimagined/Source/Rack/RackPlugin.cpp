@@ -0,0 +1,12 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Plugin Entry Point
+//==============================================================================
+
+#include "RackProcessor.h"
+
+//==============================================================================
+// This creates new instances of the plugin..
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new RackProcessor();
+}
\ No newline at end of file
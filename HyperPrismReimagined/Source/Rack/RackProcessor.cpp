@@ -0,0 +1,992 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Processor
+//==============================================================================
+
+#include "RackProcessor.h"
+#include "../Shared/EffectRegistry.h"
+
+#if ! HYPERPRISM_RACK_HEADLESS
+ #include "RackEditor.h"
+#endif
+
+// Parameter IDs
+const juce::String RackProcessor::BYPASS_ID = "bypass";
+const juce::String RackProcessor::OUTPUT_LEVEL_ID = "outputLevel";
+
+juce::String RackProcessor::getSlotBypassID(int slot)
+{
+    return "slot" + juce::String(slot + 1) + "Bypass";
+}
+
+//==============================================================================
+RackProcessor::RackProcessor()
+    : AudioProcessor(BusesProperties()
+                     .withInput("Input",  juce::AudioChannelSet::stereo(), true)
+                     .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      numWorkerThreads(juce::jlimit(0, maxSlots - 1, juce::SystemStats::getNumPhysicalCpus() - 1))
+{
+    // Cache parameter pointers for performance
+    bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
+    outputLevelParam = valueTreeState.getRawParameterValue(OUTPUT_LEVEL_ID);
+
+    for (int slot = 0; slot < maxSlots; ++slot)
+        slotBypassParams[static_cast<size_t>(slot)] = valueTreeState.getRawParameterValue(getSlotBypassID(slot));
+
+    publishChain(std::make_unique<Chain>());
+
+    // Retired chain versions are freed on the message thread
+    startTimerHz(10);
+}
+
+RackProcessor::~RackProcessor()
+{
+    stopTimer();
+    workerPool.setNumWorkers(0, 0, 0.0);
+
+    // Versions are distinct objects; latestChain is always one of these
+    delete retiredChain.exchange(nullptr);
+    delete pendingChain.exchange(nullptr);
+    delete activeChain;
+}
+
+juce::AudioProcessorValueTreeState::ParameterLayout RackProcessor::createParameterLayout()
+{
+    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
+
+    // Bypass
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
+        BYPASS_ID, "Bypass", false));
+
+    // Output Level (-24 to +12 dB)
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
+        OUTPUT_LEVEL_ID, "Output Level",
+        juce::NormalisableRange<float>(-24.0f, 12.0f, 0.1f), 0.0f,
+        juce::String(), juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 1) + " dB"; }));
+
+    // Per-slot bypass
+    for (int slot = 0; slot < maxSlots; ++slot)
+        parameters.push_back(std::make_unique<juce::AudioParameterBool>(
+            getSlotBypassID(slot), "Slot " + juce::String(slot + 1) + " Bypass", false));
+
+    return { parameters.begin(), parameters.end() };
+}
+
+//==============================================================================
+void RackProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+    loadMeter.prepare(sampleRate);
+
+    outputGain.reset(sampleRate, 0.05); // 50ms smoothing
+    outputGain.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+
+    for (auto& branchBuffer : branchBuffers)
+        branchBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+
+    workerPool.setNumWorkers(numWorkerThreads.load(), samplesPerBlock, sampleRate);
+
+    const juce::ScopedLock sl(chainLock);
+
+    preparedSampleRate = sampleRate;
+    preparedBlockSize = samplesPerBlock;
+
+    // The audio thread is stopped, so the latest version can be made active now
+    collectRetiredChain();
+    adoptPendingChain();
+    collectRetiredChain();
+
+    for (const auto& section : latestChain->sections)
+    {
+        const int factor = section.oversampler != nullptr ? oversamplingFactor : 1;
+
+        if (section.oversampler != nullptr)
+        {
+            section.oversampler->initProcessing(static_cast<size_t>(samplesPerBlock));
+            section.oversampler->reset();
+        }
+
+        for (size_t i = section.firstStage; i < section.firstStage + section.numStages; ++i)
+        {
+            const auto& stage = latestChain->stages[i];
+            for (size_t slot = stage.firstSlot; slot < stage.firstSlot + stage.numSlots; ++slot)
+                prepareNode(*latestChain->nodes[slot], factor);
+        }
+    }
+
+    // Node latencies can depend on the sample rate and the Background Thread
+    // toggle, both of which only settle here
+    updateBranchDelays(*latestChain);
+    updateLatencyAndTail();
+}
+
+void RackProcessor::releaseResources()
+{
+    workerPool.setNumWorkers(0, 0, 0.0);
+
+    const juce::ScopedLock sl(chainLock);
+
+    for (auto& node : latestChain->nodes)
+        node->processor->releaseResources();
+}
+
+bool RackProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    // Several hosted effects are stereo-only
+    return layouts.getMainInputChannelSet() == juce::AudioChannelSet::stereo()
+        && layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
+}
+
+void RackProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Rack::processBlock");
+    juce::ScopedNoDenormals noDenormals;
+
+    adoptPendingChain();
+
+    if (bypassParam->load() > 0.5f || activeChain == nullptr)
+        return;
+
+    for (const auto& section : activeChain->sections)
+    {
+        if (section.oversampler != nullptr)
+            processOversampledSection(*activeChain, section, buffer, midiMessages);
+        else
+            processStages(*activeChain, section, buffer, midiMessages);
+    }
+
+    outputGain.setTargetValue(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    outputGain.applyGain(buffer, buffer.getNumSamples());
+}
+
+void RackProcessor::processStages(const Chain& chain, const Chain::Section& section,
+                                  juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    // Serial stages work in place on the buffer
+    for (size_t i = section.firstStage; i < section.firstStage + section.numStages; ++i)
+    {
+        const auto& stage = chain.stages[i];
+
+        if (stage.isTiled)
+        {
+            processTiledStage(chain, stage, buffer, midiMessages);
+            continue;
+        }
+
+        if (stage.numSlots > 1)
+        {
+            processParallelStage(chain, stage, buffer);
+            continue;
+        }
+
+        if (slotBypassParams[stage.firstSlot]->load() > 0.5f)
+            continue;
+
+        auto& node = *chain.nodes[stage.firstSlot];
+        const HyperPrismLoad::LoadMeter::ScopedTimer nodeTimer(node.loadMeter, buffer.getNumSamples());
+        node.processor->processBlock(buffer, midiMessages);
+    }
+}
+
+void RackProcessor::processOversampledSection(const Chain& chain, const Chain::Section& section,
+                                              juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    HYPERPRISM_TRACE_SCOPE("Rack::processOversampledSection");
+    auto& oversampler = *section.oversampler;
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+
+    if (preparedBlockSize == 0)
+        return;
+
+    juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers(),
+                                       static_cast<size_t>(numChannels),
+                                       static_cast<size_t>(buffer.getNumSamples()));
+
+    // Blocks larger than prepared are split into chunks the oversampler takes
+    for (int start = 0; start < buffer.getNumSamples(); start += preparedBlockSize)
+    {
+        const int numSamples = juce::jmin(preparedBlockSize, buffer.getNumSamples() - start);
+        auto subBlock = block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(numSamples));
+
+        // One filter pair for the whole section, whatever the number of stages
+        auto upBlock = oversampler.processSamplesUp(subBlock);
+
+        std::array<float*, 2> upChannels {};
+        for (int ch = 0; ch < numChannels; ++ch)
+            upChannels[static_cast<size_t>(ch)] = upBlock.getChannelPointer(static_cast<size_t>(ch));
+
+        juce::AudioBuffer<float> upBuffer(upChannels.data(), numChannels, static_cast<int>(upBlock.getNumSamples()));
+        processStages(chain, section, upBuffer, midiMessages);
+
+        oversampler.processSamplesDown(subBlock);
+    }
+}
+
+void RackProcessor::processTiledStage(const Chain& chain, const Chain::Stage& stage,
+                                      juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    HYPERPRISM_TRACE_SCOPE("Rack::processTiledStage");
+    const int numChannels = buffer.getNumChannels();
+    const int blockSize = buffer.getNumSamples();
+
+    // Below the threshold the whole block is one tile, i.e. slot by slot
+    const int tileLength = blockSize >= minTiledBlockSize.load(std::memory_order_relaxed) ? tileSize : blockSize;
+
+    // Each slot's time over every tile, so its meter sees the whole block
+    std::array<juce::int64, maxSlots> elapsedTicks {};
+
+    // Every effect in the run handles one tile before the next tile is
+    // touched, instead of each effect making its own pass over the block
+    for (int start = 0; start < blockSize; start += tileLength)
+    {
+        const int numSamples = juce::jmin(tileLength, blockSize - start);
+        juce::AudioBuffer<float> tile(buffer.getArrayOfWritePointers(), numChannels, start, numSamples);
+
+        for (size_t slot = stage.firstSlot; slot < stage.firstSlot + stage.numSlots; ++slot)
+        {
+            if (slotBypassParams[slot]->load() > 0.5f)
+                continue;
+
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+            chain.nodes[slot]->processor->processBlock(tile, midiMessages);
+            elapsedTicks[slot] += juce::Time::getHighResolutionTicks() - startTicks;
+        }
+    }
+
+    for (size_t slot = stage.firstSlot; slot < stage.firstSlot + stage.numSlots; ++slot)
+        if (elapsedTicks[slot] > 0)
+            chain.nodes[slot]->loadMeter.addBlock(elapsedTicks[slot], blockSize);
+}
+
+void RackProcessor::processParallelStage(const Chain& chain, const Chain::Stage& stage, juce::AudioBuffer<float>& buffer)
+{
+    HYPERPRISM_TRACE_SCOPE("Rack::processParallelStage");
+    const int numChannels = juce::jmin(buffer.getNumChannels(), branchBuffers[0].getNumChannels());
+    const int capacity = branchBuffers[0].getNumSamples();
+    const float branchGain = 1.0f / static_cast<float>(stage.numSlots);
+
+    if (capacity == 0)
+        return;
+
+    // Blocks larger than prepared are split into chunks the branch buffers hold
+    for (int start = 0; start < buffer.getNumSamples(); start += capacity)
+    {
+        const int numSamples = juce::jmin(capacity, buffer.getNumSamples() - start);
+        juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, start, numSamples);
+
+        for (size_t branch = 0; branch < stage.numSlots; ++branch)
+        {
+            const auto slot = stage.firstSlot + branch;
+            auto& task = branchTasks[branch];
+            task.node = chain.nodes[slot].get();
+            task.bypassed = slotBypassParams[slot]->load() > 0.5f;
+            task.midi.clear();
+
+            // The first branch works in place; the others on a copy of the input
+            if (branch == 0)
+            {
+                task.buffer.setDataToReferTo(block.getArrayOfWritePointers(), numChannels, numSamples);
+            }
+            else
+            {
+                auto& branchBuffer = branchBuffers[branch];
+                for (int ch = 0; ch < numChannels; ++ch)
+                    branchBuffer.copyFrom(ch, 0, block, ch, 0, numSamples);
+
+                task.buffer.setDataToReferTo(branchBuffer.getArrayOfWritePointers(), numChannels, numSamples);
+            }
+
+            branchTaskPointers[branch] = &task;
+        }
+
+        workerPool.runAll(branchTaskPointers.data(), static_cast<int>(stage.numSlots));
+
+        for (size_t branch = 0; branch < stage.numSlots; ++branch)
+            chain.branchDelays[stage.firstSlot + branch].process(branchTasks[branch].buffer, branchTasks[branch].bypassed);
+
+        // Equal-gain mix of the branch outputs
+        for (size_t branch = 1; branch < stage.numSlots; ++branch)
+            for (int ch = 0; ch < numChannels; ++ch)
+                block.addFrom(ch, 0, branchTasks[branch].buffer, ch, 0, numSamples);
+
+        block.applyGain(branchGain);
+    }
+}
+
+void RackProcessor::BranchTask::run() noexcept
+{
+    HYPERPRISM_TRACE_SCOPE("Rack::branch");
+    juce::ScopedNoDenormals noDenormals;
+
+    // A bypassed branch contributes its input unchanged
+    if (bypassed)
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer nodeTimer(node->loadMeter, buffer.getNumSamples());
+    node->processor->processBlock(buffer, midi);
+}
+
+void RackProcessor::Chain::BranchDelay::process(juce::AudioBuffer<float>& buffer, bool bypassed) noexcept
+{
+    const int length = history.getNumSamples();
+    const int numSamples = buffer.getNumSamples();
+
+    if (length == 0)
+        return;
+
+    // The input is recorded even at no delay, so a bypass switch picks up
+    // from the right history
+    const int delay = bypassed ? length - 1 : compensation;
+
+    for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), history.getNumChannels()); ++ch)
+    {
+        auto* data = buffer.getWritePointer(ch);
+        auto* line = history.getWritePointer(ch);
+        int position = writePosition;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            line[position] = data[i];
+            data[i] = line[position >= delay ? position - delay : position - delay + length];
+
+            if (++position == length)
+                position = 0;
+        }
+    }
+
+    writePosition = (writePosition + numSamples) % length;
+}
+
+double RackProcessor::getTailLengthSeconds() const
+{
+    return tailLengthSeconds.load(std::memory_order_relaxed);
+}
+
+void RackProcessor::updateLatencyAndTail()
+{
+    double latency = 0.0;
+    double tail = 0.0;
+
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        // Stages add up; a parallel stage lasts as long as its longest branch,
+        // which the others are delayed to match
+        for (const auto& section : latestChain->sections)
+        {
+            // Latency inside an oversampled section is counted at the higher rate
+            const double factor = section.oversampler != nullptr ? static_cast<double>(oversamplingFactor) : 1.0;
+
+            if (section.oversampler != nullptr)
+                latency += static_cast<double>(section.oversampler->getLatencyInSamples());
+
+            for (size_t i = section.firstStage; i < section.firstStage + section.numStages; ++i)
+            {
+                const auto& stage = latestChain->stages[i];
+                int stageLatency = 0;
+                double stageTail = 0.0;
+
+                // A tiled stage is serial, so its slots add up too
+                for (size_t slot = stage.firstSlot; slot < stage.firstSlot + stage.numSlots; ++slot)
+                {
+                    const auto& processor = *latestChain->nodes[slot]->processor;
+
+                    if (stage.isTiled)
+                    {
+                        stageLatency += processor.getLatencySamples();
+                        stageTail += processor.getTailLengthSeconds();
+                    }
+                    else
+                    {
+                        stageLatency = juce::jmax(stageLatency, processor.getLatencySamples());
+                        stageTail = juce::jmax(stageTail, processor.getTailLengthSeconds());
+                    }
+                }
+
+                latency += stageLatency / factor;
+                tail += stageTail;
+            }
+        }
+    }
+
+    tailLengthSeconds.store(tail, std::memory_order_relaxed);
+    setLatencySamples(juce::roundToInt(latency));
+}
+
+//==============================================================================
+void RackProcessor::adoptPendingChain() noexcept
+{
+    // Wait until the previous version has been collected, so there is always
+    // somewhere to hand the current one back
+    if (retiredChain.load(std::memory_order_acquire) != nullptr)
+        return;
+
+    if (auto* next = pendingChain.exchange(nullptr, std::memory_order_acq_rel))
+    {
+        retiredChain.store(activeChain, std::memory_order_release);
+        activeChain = next;
+    }
+}
+
+void RackProcessor::collectRetiredChain()
+{
+    delete retiredChain.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void RackProcessor::timerCallback()
+{
+    const juce::ScopedLock sl(chainLock);
+    collectRetiredChain();
+}
+
+void RackProcessor::audioProcessorChanged(juce::AudioProcessor*, const juce::AudioProcessorListener::ChangeDetails& details)
+{
+    // The host prepares the rack again, which prepares every node and
+    // re-reads their latencies
+    if (details.latencyChanged)
+        updateHostDisplay(juce::AudioProcessor::ChangeDetails().withLatencyChanged(true));
+}
+
+void RackProcessor::publishChain(std::unique_ptr<Chain> chain)
+{
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        collectRetiredChain();
+        buildChain(*chain);
+        latestChain = chain.get();
+
+        // A version the audio thread never picked up can go straight away
+        delete pendingChain.exchange(chain.release(), std::memory_order_acq_rel);
+    }
+
+    updateLatencyAndTail();
+
+    if (juce::MessageManager::existsAndIsCurrentThread())
+        sendSynchronousChangeMessage();
+    else
+        sendChangeMessage();
+}
+
+void RackProcessor::buildChain(Chain& chain)
+{
+    chain.stages.clear();
+    chain.sections.clear();
+
+    for (size_t slot = 0; slot < chain.nodes.size(); ++slot)
+    {
+        if (slot > 0 && chain.nodes[slot]->parallelWithPrevious)
+            ++chain.stages.back().numSlots;
+        else
+            chain.stages.push_back({ slot, 1 });
+    }
+
+    // Neighbouring lightweight effects at the same rate share one tiled stage
+    std::vector<Chain::Stage> stages;
+
+    for (const auto& stage : chain.stages)
+    {
+        const auto& node = *chain.nodes[stage.firstSlot];
+        const bool canTile = stage.numSlots == 1 && node.isLightweightStereo;
+
+        if (canTile && ! stages.empty() && stages.back().isTiled
+            && chain.nodes[stages.back().firstSlot]->oversampled == node.oversampled)
+        {
+            ++stages.back().numSlots;
+        }
+        else
+        {
+            stages.push_back({ stage.firstSlot, stage.numSlots, canTile });
+        }
+    }
+
+    for (auto& stage : stages)
+        stage.isTiled = stage.isTiled && stage.numSlots > 1;
+
+    chain.stages = std::move(stages);
+
+    for (size_t i = 0; i < chain.stages.size(); ++i)
+    {
+        const auto& stage = chain.stages[i];
+
+        // A parallel stage is oversampled only if all of its branches are
+        // (a tiled stage is all one way)
+        bool isOversampled = true;
+        for (size_t slot = stage.firstSlot; slot < stage.firstSlot + stage.numSlots; ++slot)
+            isOversampled = isOversampled && chain.nodes[slot]->oversampled;
+
+        // Nodes are prepared once when first built. One that has to change
+        // rate is replaced by a copy, because the audio thread may still be
+        // running the original in the current version.
+        const int factor = isOversampled ? oversamplingFactor : 1;
+
+        for (size_t slot = stage.firstSlot; slot < stage.firstSlot + stage.numSlots; ++slot)
+        {
+            auto& node = chain.nodes[slot];
+
+            if (node->preparedFactor != 0 && node->preparedFactor != factor)
+                node = cloneNode(*node);
+
+            if (node->preparedFactor == 0)
+                prepareNode(*node, factor);
+        }
+
+        const bool continuesSection = ! chain.sections.empty()
+                                   && (chain.sections.back().oversampler != nullptr) == isOversampled;
+
+        if (continuesSection)
+        {
+            ++chain.sections.back().numStages;
+        }
+        else
+        {
+            Chain::Section section;
+            section.firstStage = i;
+            section.oversampler = isOversampled ? createOversampler() : nullptr;
+            chain.sections.push_back(std::move(section));
+        }
+    }
+
+    updateBranchDelays(chain);
+}
+
+void RackProcessor::updateBranchDelays(Chain& chain) const
+{
+    chain.branchDelays.resize(chain.nodes.size());
+
+    for (const auto& stage : chain.stages)
+    {
+        const auto lastSlot = stage.firstSlot + stage.numSlots;
+        int stageLatency = 0;
+
+        if (! stage.isTiled && stage.numSlots > 1)
+            for (size_t slot = stage.firstSlot; slot < lastSlot; ++slot)
+                stageLatency = juce::jmax(stageLatency, chain.nodes[slot]->processor->getLatencySamples());
+
+        for (size_t slot = stage.firstSlot; slot < lastSlot; ++slot)
+        {
+            auto& delay = chain.branchDelays[slot];
+            delay.history.setSize(2, stageLatency > 0 ? stageLatency + 1 : 0);
+            delay.history.clear();
+            delay.compensation = stageLatency - chain.nodes[slot]->processor->getLatencySamples();
+            delay.writePosition = 0;
+        }
+    }
+}
+
+std::unique_ptr<juce::dsp::Oversampling<float>> RackProcessor::createOversampler() const
+{
+    const auto filterType = oversamplingLinearPhase
+        ? juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple
+        : juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR;
+
+    // Integer latency so the host can compensate it exactly
+    auto oversampler = std::make_unique<juce::dsp::Oversampling<float>>(
+        2, static_cast<size_t>(std::log2(oversamplingFactor)), filterType, true, true);
+
+    if (preparedBlockSize > 0)
+        oversampler->initProcessing(static_cast<size_t>(preparedBlockSize));
+
+    return oversampler;
+}
+
+//==============================================================================
+std::shared_ptr<RackProcessor::Node> RackProcessor::createNode(const juce::String& effectName)
+{
+    const auto* info = HyperPrismRegistry::findEffect(effectName);
+    if (info == nullptr)
+        return nullptr;
+
+    auto node = std::make_shared<Node>();
+    node->effect = info->name;
+    node->processor = info->create();
+    node->processor->addListener(this);
+    node->isLightweightStereo = info->isLightweightStereo;
+    return node;
+}
+
+std::shared_ptr<RackProcessor::Node> RackProcessor::cloneNode(const Node& node)
+{
+    auto clone = createNode(node.effect);
+
+    juce::MemoryBlock state;
+    node.processor->getStateInformation(state);
+    clone->processor->setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+
+    clone->parallelWithPrevious = node.parallelWithPrevious;
+    clone->oversampled = node.oversampled;
+    return clone;
+}
+
+void RackProcessor::prepareNode(Node& node, int factor)
+{
+    node.preparedFactor = factor;
+
+    if (preparedSampleRate <= 0.0)
+        return;
+
+    const double sampleRate = preparedSampleRate * factor;
+    const int blockSize = preparedBlockSize * factor;
+
+    node.processor->setPlayConfigDetails(2, 2, sampleRate, blockSize);
+    node.processor->setNonRealtime(isNonRealtime());
+
+    // The latency it settles on here is read straight after, so only
+    // changes requested later go to the host
+    node.processor->removeListener(this);
+    node.processor->prepareToPlay(sampleRate, blockSize);
+    node.processor->addListener(this);
+    node.loadMeter.prepare(sampleRate);
+}
+
+void RackProcessor::editChain(const std::function<void(std::vector<std::shared_ptr<Node>>&)>& edit)
+{
+    auto chain = std::make_unique<Chain>();
+
+    {
+        const juce::ScopedLock sl(chainLock);
+        chain->nodes = latestChain->nodes;
+        edit(chain->nodes);
+
+        if (chain->nodes.size() > static_cast<size_t>(maxSlots))
+            chain->nodes.resize(static_cast<size_t>(maxSlots));
+    }
+
+    publishChain(std::move(chain));
+}
+
+juce::StringArray RackProcessor::getChainEffects() const
+{
+    const juce::ScopedLock sl(chainLock);
+
+    juce::StringArray effects;
+    for (const auto& node : latestChain->nodes)
+        effects.add(node->effect);
+
+    return effects;
+}
+
+std::shared_ptr<RackProcessor::Node> RackProcessor::getNode(int slot) const
+{
+    const juce::ScopedLock sl(chainLock);
+
+    if (! juce::isPositiveAndBelow(slot, static_cast<int>(latestChain->nodes.size())))
+        return nullptr;
+
+    return latestChain->nodes[static_cast<size_t>(slot)];
+}
+
+void RackProcessor::setChain(const juce::StringArray& effectNames)
+{
+    auto chain = std::make_unique<Chain>();
+
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        for (const auto& name : effectNames)
+        {
+            if (chain->nodes.size() >= static_cast<size_t>(maxSlots))
+                break;
+
+            if (auto node = createNode(name))
+                chain->nodes.push_back(std::move(node));
+        }
+    }
+
+    publishChain(std::move(chain));
+}
+
+void RackProcessor::insertEffect(int slot, const juce::String& effectName)
+{
+    auto node = createNode(effectName);
+    if (node == nullptr)
+        return;
+
+    auto bypassStates = getSlotBypassStates();
+
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        if (latestChain->nodes.size() >= static_cast<size_t>(maxSlots))
+            return;
+    }
+
+    editChain([&](std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        const auto index = static_cast<size_t>(juce::jlimit(0, static_cast<int>(nodes.size()), slot));
+        nodes.insert(nodes.begin() + static_cast<std::ptrdiff_t>(index), node);
+
+        bypassStates.insert(bypassStates.begin() + static_cast<std::ptrdiff_t>(index), false);
+        bypassStates.pop_back();
+    });
+
+    setSlotBypassStates(bypassStates);
+}
+
+void RackProcessor::replaceEffect(int slot, const juce::String& effectName)
+{
+    auto node = createNode(effectName);
+    if (node == nullptr)
+        return;
+
+    editChain([&](std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        if (! juce::isPositiveAndBelow(slot, static_cast<int>(nodes.size())))
+            return;
+
+        node->parallelWithPrevious = nodes[static_cast<size_t>(slot)]->parallelWithPrevious;
+        node->oversampled = nodes[static_cast<size_t>(slot)]->oversampled;
+        nodes[static_cast<size_t>(slot)] = node;
+    });
+}
+
+void RackProcessor::removeEffect(int slot)
+{
+    auto bypassStates = getSlotBypassStates();
+
+    editChain([&](std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        if (! juce::isPositiveAndBelow(slot, static_cast<int>(nodes.size())))
+            return;
+
+        nodes.erase(nodes.begin() + slot);
+
+        bypassStates.erase(bypassStates.begin() + slot);
+        bypassStates.push_back(false);
+    });
+
+    setSlotBypassStates(bypassStates);
+}
+
+void RackProcessor::moveEffect(int fromSlot, int toSlot)
+{
+    auto bypassStates = getSlotBypassStates();
+
+    editChain([&](std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        const int numNodes = static_cast<int>(nodes.size());
+        if (! juce::isPositiveAndBelow(fromSlot, numNodes) || ! juce::isPositiveAndBelow(toSlot, numNodes) || fromSlot == toSlot)
+            return;
+
+        auto node = nodes[static_cast<size_t>(fromSlot)];
+        nodes.erase(nodes.begin() + fromSlot);
+        nodes.insert(nodes.begin() + toSlot, node);
+
+        const bool wasBypassed = bypassStates[static_cast<size_t>(fromSlot)];
+        bypassStates.erase(bypassStates.begin() + fromSlot);
+        bypassStates.insert(bypassStates.begin() + toSlot, wasBypassed);
+    });
+
+    setSlotBypassStates(bypassStates);
+}
+
+void RackProcessor::setSlotParallel(int slot, bool shouldRunInParallel)
+{
+    editChain([&](std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        if (juce::isPositiveAndBelow(slot, static_cast<int>(nodes.size())))
+            nodes[static_cast<size_t>(slot)]->parallelWithPrevious = shouldRunInParallel;
+    });
+}
+
+bool RackProcessor::isSlotParallel(int slot) const
+{
+    const juce::ScopedLock sl(chainLock);
+
+    return juce::isPositiveAndBelow(slot, static_cast<int>(latestChain->nodes.size()))
+        && latestChain->nodes[static_cast<size_t>(slot)]->parallelWithPrevious;
+}
+
+void RackProcessor::setSlotOversampled(int slot, bool shouldBeOversampled)
+{
+    editChain([&](std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        if (juce::isPositiveAndBelow(slot, static_cast<int>(nodes.size())))
+            nodes[static_cast<size_t>(slot)]->oversampled = shouldBeOversampled;
+    });
+}
+
+bool RackProcessor::isSlotOversampled(int slot) const
+{
+    const juce::ScopedLock sl(chainLock);
+
+    return juce::isPositiveAndBelow(slot, static_cast<int>(latestChain->nodes.size()))
+        && latestChain->nodes[static_cast<size_t>(slot)]->oversampled;
+}
+
+int RackProcessor::sanitiseOversamplingFactor(int factor)
+{
+    return factor >= 8 ? 8 : (factor >= 4 ? 4 : 2);
+}
+
+void RackProcessor::setOversampling(int factor, bool useLinearPhase)
+{
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        oversamplingFactor = sanitiseOversamplingFactor(factor);
+        oversamplingLinearPhase = useLinearPhase;
+    }
+
+    // Rebuilding re-prepares the oversampled nodes and filters
+    editChain([](std::vector<std::shared_ptr<Node>>&) {});
+}
+
+int RackProcessor::getOversamplingFactor() const
+{
+    const juce::ScopedLock sl(chainLock);
+    return oversamplingFactor;
+}
+
+bool RackProcessor::isOversamplingLinearPhase() const
+{
+    const juce::ScopedLock sl(chainLock);
+    return oversamplingLinearPhase;
+}
+
+void RackProcessor::setNumWorkerThreads(int numThreads)
+{
+    numWorkerThreads.store(juce::jlimit(0, maxSlots - 1, numThreads));
+}
+
+std::vector<bool> RackProcessor::getSlotBypassStates() const
+{
+    std::vector<bool> states;
+    for (auto* param : slotBypassParams)
+        states.push_back(param->load() > 0.5f);
+
+    return states;
+}
+
+void RackProcessor::setSlotBypassStates(const std::vector<bool>& states)
+{
+    for (int slot = 0; slot < maxSlots; ++slot)
+    {
+        if (auto* param = valueTreeState.getParameter(getSlotBypassID(slot)))
+        {
+            const float value = states[static_cast<size_t>(slot)] ? 1.0f : 0.0f;
+            if (param->getValue() != value)
+                param->setValueNotifyingHost(value);
+        }
+    }
+}
+
+//==============================================================================
+juce::AudioProcessorEditor* RackProcessor::createEditor()
+{
+   #if HYPERPRISM_RACK_HEADLESS
+    return nullptr;
+   #else
+    return new RackEditor(*this);
+   #endif
+}
+
+//==============================================================================
+void RackProcessor::getStateInformation(juce::MemoryBlock& destData)
+{
+    juce::XmlElement xml("HyperPrismRack");
+    xml.setAttribute("version", 1);
+
+    if (auto parameters = valueTreeState.copyState().createXml())
+        xml.addChildElement(parameters.release());
+
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        xml.setAttribute("oversamplingFactor", oversamplingFactor);
+        xml.setAttribute("oversamplingLinearPhase", oversamplingLinearPhase);
+
+        // Each node saves itself exactly as the standalone plugin would
+        for (const auto& node : latestChain->nodes)
+        {
+            juce::MemoryBlock nodeState;
+            node->processor->getStateInformation(nodeState);
+
+            auto* slot = xml.createNewChildElement("Slot");
+            slot->setAttribute("effect", node->effect);
+            slot->setAttribute("parallel", node->parallelWithPrevious);
+            slot->setAttribute("oversampled", node->oversampled);
+            slot->setAttribute("state", nodeState.toBase64Encoding());
+        }
+    }
+
+    copyXmlToBinary(xml, destData);
+}
+
+void RackProcessor::setStateInformation(const void* data, int sizeInBytes)
+{
+    auto xml = getXmlFromBinary(data, sizeInBytes);
+    if (xml == nullptr || ! xml->hasTagName("HyperPrismRack"))
+        return;
+
+    if (auto* parameters = xml->getChildByName(valueTreeState.state.getType()))
+        valueTreeState.replaceState(juce::ValueTree::fromXml(*parameters));
+
+    auto chain = std::make_unique<Chain>();
+
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        oversamplingFactor = sanitiseOversamplingFactor(xml->getIntAttribute("oversamplingFactor", 2));
+        oversamplingLinearPhase = xml->getBoolAttribute("oversamplingLinearPhase");
+
+        for (auto* slot : xml->getChildWithTagNameIterator("Slot"))
+        {
+            if (chain->nodes.size() >= static_cast<size_t>(maxSlots))
+                break;
+
+            auto node = createNode(slot->getStringAttribute("effect"));
+            if (node == nullptr)
+                continue;
+
+            juce::MemoryBlock nodeState;
+            if (nodeState.fromBase64Encoding(slot->getStringAttribute("state")) && nodeState.getSize() > 0)
+                node->processor->setStateInformation(nodeState.getData(), static_cast<int>(nodeState.getSize()));
+
+            node->parallelWithPrevious = slot->getBoolAttribute("parallel");
+            node->oversampled = slot->getBoolAttribute("oversampled");
+            chain->nodes.push_back(std::move(node));
+        }
+    }
+
+    publishChain(std::move(chain));
+}
+
+void RackProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+
+    for (const auto& branchBuffer : branchBuffers)
+        footprint.add("branch buffers", branchBuffer);
+
+    const juce::ScopedLock sl(chainLock);
+
+    for (const auto& delay : latestChain->branchDelays)
+        footprint.add("branch delays", delay.history);
+
+    for (const auto& section : latestChain->sections)
+    {
+        if (section.oversampler != nullptr)
+        {
+            footprint.addUntracked("oversampling filters");
+            break;
+        }
+    }
+
+    for (size_t slot = 0; slot < latestChain->nodes.size(); ++slot)
+    {
+        const auto& node = *latestChain->nodes[slot];
+        const auto name = juce::String(static_cast<int>(slot) + 1) + ": " + node.effect;
+
+        if (auto* reporter = dynamic_cast<const HyperPrismMemory::Reporter*>(node.processor.get()))
+        {
+            HyperPrismMemory::Footprint nodeFootprint;
+            reporter->describeMemory(nodeFootprint);
+            footprint.add(name, nodeFootprint.getTotalBytes());
+
+            for (const auto& untracked : nodeFootprint.getUntrackedNames())
+                footprint.addUntracked(name + " " + untracked);
+        }
+    }
+}
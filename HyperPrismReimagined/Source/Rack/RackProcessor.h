@@ -0,0 +1,283 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Processor
+// Hosts a serial chain of the HyperPrism effects as in-process nodes: one
+// plugin instance, one processBlock, the host buffer processed in place by
+// every stage, and the whole chain saved as a single state
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "RackWorkerPool.h"
+
+class RackProcessor : public juce::AudioProcessor,
+                      public HyperPrismMemory::Reporter,
+                      public juce::ChangeBroadcaster,
+                      private juce::AudioProcessorListener,
+                      private juce::Timer
+{
+public:
+    //==============================================================================
+    static constexpr int maxSlots = 8;
+
+    // Samples per tile when running lightweight effects back to back: a stereo
+    // tile is 4 KiB, so it stays in L1 from one effect to the next alongside
+    // their state, and each effect's per-block overhead is paid once per 512
+    static constexpr int tileSize = 512;
+
+    // Shorter blocks (every realtime one, in practice) fit in a 32 KiB L1 whole,
+    // so tiling them only repeats that overhead; they run slot by slot. Large
+    // offline bounce blocks are tiled. HyperPrismBench --rack-tiling times both.
+    static constexpr int defaultMinTiledBlockSize = 4096;
+
+    // One effect in the chain. Shared between chain versions so edits keep the
+    // instance (and its state) of every effect that stays in the chain.
+    struct Node
+    {
+        juce::String effect;
+        std::unique_ptr<juce::AudioProcessor> processor;
+        HyperPrismLoad::LoadMeter loadMeter;    // Time spent in this node's processBlock
+        bool parallelWithPrevious = false;      // Shares its input with the slot before it
+        bool oversampled = false;               // Runs inside an oversampled section
+        bool isLightweightStereo = false;       // From the registry; neighbours run tile by tile
+        int preparedFactor = 0;                 // Rate multiple it was prepared for; 0 until first built
+    };
+
+    //==============================================================================
+    RackProcessor();
+    ~RackProcessor() override;
+
+    //==============================================================================
+    void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
+
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    //==============================================================================
+    juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_RACK_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
+    bool hasEditor() const override { return true; }
+   #endif
+
+    //==============================================================================
+    const juce::String getName() const override { return "HyperPrism Reimagined Rack"; }
+
+    bool acceptsMidi() const override { return false; }
+    bool producesMidi() const override { return false; }
+    bool isMidiEffect() const override { return false; }
+    double getTailLengthSeconds() const override;
+
+    //==============================================================================
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+
+    //==============================================================================
+    void getStateInformation(juce::MemoryBlock& destData) override;
+    void setStateInformation(const void* data, int sizeInBytes) override;
+
+    //==============================================================================
+    // Chain editing. Call from the message thread (or any thread but the audio
+    // thread); each edit builds a new chain version that the audio thread picks
+    // up at its next block. Listeners get a change message after every edit.
+    juce::StringArray getChainEffects() const;
+    std::shared_ptr<Node> getNode(int slot) const;
+
+    void setChain(const juce::StringArray& effectNames);
+    void insertEffect(int slot, const juce::String& effectName);
+    void replaceEffect(int slot, const juce::String& effectName);
+    void removeEffect(int slot);
+    void moveEffect(int fromSlot, int toSlot);
+
+    // A slot marked parallel takes the same input as the slot before it, and
+    // the outputs of a run of such slots are mixed at equal gain. The branches
+    // of a parallel stage run concurrently on the worker pool, each delayed to
+    // line up with the stage's longest latency.
+    void setSlotParallel(int slot, bool shouldRunInParallel);
+    bool isSlotParallel(int slot) const;
+
+    // Consecutive oversampled slots form one section that is upsampled once,
+    // run at the higher rate, and downsampled once. The factor (2, 4 or 8) and
+    // the filter type apply to every section; changing either re-creates the
+    // oversampled effects, prepared at the new rate, from their current state.
+    void setSlotOversampled(int slot, bool shouldBeOversampled);
+    bool isSlotOversampled(int slot) const;
+
+    void setOversampling(int factor, bool useLinearPhase);
+    int getOversamplingFactor() const;
+    bool isOversamplingLinearPhase() const;
+
+    // Worker threads helping with parallel stages; applied at the next prepareToPlay
+    void setNumWorkerThreads(int numThreads);
+    int getNumWorkerThreads() const { return numWorkerThreads.load(); }
+
+    // Blocks of at least this many samples run lightweight stages tile by tile;
+    // the bench moves it to time tiled against serial. Any thread.
+    void setMinTiledBlockSize(int numSamples) { minTiledBlockSize.store(juce::jmax(0, numSamples)); }
+    int getMinTiledBlockSize() const { return minTiledBlockSize.load(); }
+
+    //==============================================================================
+    juce::AudioProcessorValueTreeState& getValueTreeState() { return valueTreeState; }
+
+    // Parameter IDs
+    static const juce::String BYPASS_ID;
+    static const juce::String OUTPUT_LEVEL_ID;
+    static juce::String getSlotBypassID(int slot);
+
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
+private:
+    //==============================================================================
+    // An immutable snapshot of the chain. The audio thread only ever reads one
+    // through a raw pointer; versions are created and destroyed elsewhere.
+    struct Chain
+    {
+        // Consecutive slots that share one input, or a serial run of
+        // lightweight effects processed tile by tile; a single slot runs in place
+        struct Stage
+        {
+            size_t firstSlot = 0;
+            size_t numSlots = 1;
+            bool isTiled = false;
+        };
+
+        // Consecutive stages at one rate; oversampler is null at the host rate
+        struct Section
+        {
+            size_t firstStage = 0;
+            size_t numStages = 1;
+            std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;
+        };
+
+        // Lines a parallel branch up with the longest one in its stage: its
+        // output is delayed by what its latency falls short of the stage's,
+        // or by the whole stage latency while bypassed
+        struct BranchDelay
+        {
+            void process(juce::AudioBuffer<float>& buffer, bool bypassed) noexcept;
+
+            juce::AudioBuffer<float> history;   // Stage latency + 1 samples; empty when none is needed
+            int compensation = 0;
+            int writePosition = 0;
+        };
+
+        std::vector<std::shared_ptr<Node>> nodes;
+        std::vector<Stage> stages;
+        std::vector<Section> sections;
+
+        // One per slot. Audio-thread state of this version, like the oversamplers.
+        mutable std::vector<BranchDelay> branchDelays;
+    };
+
+    // One branch of a parallel stage, run by the audio thread or a worker
+    struct BranchTask : public RackWorkerPool::Task
+    {
+        void run() noexcept override;
+
+        Node* node = nullptr;
+        bool bypassed = false;
+        juce::AudioBuffer<float> buffer;    // Refers to the host block or a branch buffer
+        juce::MidiBuffer midi;
+    };
+
+    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+
+    // Nodes report latency changes (the Background Thread toggle) to the rack
+    std::shared_ptr<Node> createNode(const juce::String& effectName);
+    std::shared_ptr<Node> cloneNode(const Node& node);
+    void prepareNode(Node& node, int factor);
+
+    // Builds a new chain version from the latest one and publishes it
+    void editChain(const std::function<void(std::vector<std::shared_ptr<Node>>&)>& edit);
+    void publishChain(std::unique_ptr<Chain> chain);
+    void updateLatencyAndTail();
+
+    // Groups the nodes into stages and sections, and prepares every node for
+    // the rate of its section. Called with chainLock held.
+    void buildChain(Chain& chain);
+
+    // Sizes the branch delays from the nodes' current latencies. Called with
+    // chainLock held, before the audio thread can see the chain.
+    void updateBranchDelays(Chain& chain) const;
+    std::unique_ptr<juce::dsp::Oversampling<float>> createOversampler() const;
+    static int sanitiseOversamplingFactor(int factor);
+
+    void processStages(const Chain& chain, const Chain::Section& section,
+                       juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages);
+    void processOversampledSection(const Chain& chain, const Chain::Section& section,
+                                   juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages);
+    void processTiledStage(const Chain& chain, const Chain::Stage& stage,
+                           juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages);
+    void processParallelStage(const Chain& chain, const Chain::Stage& stage, juce::AudioBuffer<float>& buffer);
+
+    // Audio side of the hand-over; also called from prepareToPlay
+    void adoptPendingChain() noexcept;
+
+    // Frees the version the audio thread has finished with
+    void collectRetiredChain();
+    void timerCallback() override;
+
+    // A hosted effect's latency only changes when it is prepared again, and
+    // its own request for that reaches no host, so the rack asks in its place
+    void audioProcessorChanged(juce::AudioProcessor*, const juce::AudioProcessorListener::ChangeDetails& details) override;
+    void audioProcessorParameterChanged(juce::AudioProcessor*, int, float) override {}
+
+    // Slot bypass values follow their effect when the chain is rearranged
+    std::vector<bool> getSlotBypassStates() const;
+    void setSlotBypassStates(const std::vector<bool>& states);
+
+    juce::AudioProcessorValueTreeState valueTreeState;
+
+    // Parameter pointers for performance
+    std::atomic<float>* bypassParam = nullptr;
+    std::atomic<float>* outputLevelParam = nullptr;
+    std::array<std::atomic<float>*, maxSlots> slotBypassParams {};
+
+    juce::SmoothedValue<float> outputGain;
+
+    // Chain versions: latestChain is what edits start from and what gets saved;
+    // activeChain is what the audio thread processes. Edits hand a new version
+    // over through pendingChain and the audio thread hands the old one back
+    // through retiredChain.
+    mutable juce::CriticalSection chainLock;
+    Chain* latestChain = nullptr;
+    Chain* activeChain = nullptr;
+    std::atomic<Chain*> pendingChain { nullptr };
+    std::atomic<Chain*> retiredChain { nullptr };
+
+    std::atomic<double> tailLengthSeconds { 0.0 };
+    std::atomic<int> minTiledBlockSize { defaultMinTiledBlockSize };
+
+    // Parallel stages: branch 0 works on the host buffer, the others on copies
+    RackWorkerPool workerPool;
+    std::atomic<int> numWorkerThreads;
+    std::array<BranchTask, maxSlots> branchTasks;
+    std::array<RackWorkerPool::Task*, maxSlots> branchTaskPointers {};
+    std::array<juce::AudioBuffer<float>, maxSlots> branchBuffers;
+
+    // Settings new nodes are prepared with; 0 until the first prepareToPlay
+    double preparedSampleRate = 0.0;
+    int preparedBlockSize = 0;
+
+    // Oversampled sections; guarded by chainLock
+    int oversamplingFactor = 2;
+    bool oversamplingLinearPhase = false;
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RackProcessor)
+};
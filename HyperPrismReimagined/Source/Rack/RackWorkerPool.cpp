@@ -0,0 +1,169 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Worker Pool
+//==============================================================================
+
+#include "RackWorkerPool.h"
+
+//==============================================================================
+bool RackWorkerPool::WorkStealingDeque::push(Task* task) noexcept
+{
+    const auto b = bottom.load(std::memory_order_relaxed);
+    const auto t = top.load(std::memory_order_acquire);
+
+    if (b - t > mask)
+        return false;
+
+    slots[static_cast<size_t>(b & mask)].store(task, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+RackWorkerPool::Task* RackWorkerPool::WorkStealingDeque::pop() noexcept
+{
+    const auto b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    auto* task = slots[static_cast<size_t>(b & mask)].load(std::memory_order_relaxed);
+
+    // Last task: race any thief for it
+    if (t == b)
+    {
+        if (! top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            task = nullptr;
+
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    return task;
+}
+
+RackWorkerPool::Task* RackWorkerPool::WorkStealingDeque::steal() noexcept
+{
+    auto t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b)
+        return nullptr;
+
+    auto* task = slots[static_cast<size_t>(t & mask)].load(std::memory_order_relaxed);
+
+    if (! top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+
+    return task;
+}
+
+//==============================================================================
+RackWorkerPool::Worker::Worker(RackWorkerPool& owner, int index)
+    : juce::Thread("HyperPrism Rack worker " + juce::String(index + 1)), pool(owner)
+{
+}
+
+RackWorkerPool::Worker::~Worker()
+{
+    signalThreadShouldExit();
+    wakeSemaphore.signal();
+    stopThread(1000);
+}
+
+void RackWorkerPool::Worker::run()
+{
+    while (! threadShouldExit())
+    {
+        if (auto* task = pool.deque.steal())
+        {
+            pool.runTask(task);
+            continue;
+        }
+
+        // Nothing left to steal; sleep until the next parallel stage. A wake
+        // that arrived while a task ran just costs one more empty steal.
+        wakeSemaphore.wait();
+    }
+}
+
+//==============================================================================
+RackWorkerPool::~RackWorkerPool()
+{
+    workers.clear();
+}
+
+void RackWorkerPool::setNumWorkers(int numWorkers, int blockSize, double sampleRate)
+{
+    numWorkers = juce::jmax(0, numWorkers);
+
+    // The scheduling hints are fixed when a thread starts, so a new block size
+    // or sample rate needs new threads even when the count is the same
+    if (numWorkers == requestedWorkers && blockSize == preparedBlockSize
+        && juce::exactlyEqual(sampleRate, preparedSampleRate))
+        return;
+
+    workers.clear();
+    requestedWorkers = numWorkers;
+    preparedBlockSize = blockSize;
+    preparedSampleRate = sampleRate;
+    spinTicks = juce::Time::getHighResolutionTicksPerSecond() * maxSpinMicroseconds / 1000000;
+
+    const auto options = juce::Thread::RealtimeOptions{}
+                             .withApproximateAudioProcessingTime(juce::jmax(1, blockSize), sampleRate);
+
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        std::unique_ptr<Worker> worker(new Worker(*this, i));
+
+        // Where real-time scheduling is refused the audio thread runs the
+        // branches itself rather than wait on a lower-priority thread
+        if (! worker->startRealtimeThread(options))
+            break;
+
+        workers.add(worker.release());
+    }
+}
+
+void RackWorkerPool::runTask(Task* task) noexcept
+{
+    task->run();
+    remainingTasks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void RackWorkerPool::runAll(Task* const* tasks, int numTasks) noexcept
+{
+    numTasks = juce::jmin(numTasks, maxTasks);
+    if (numTasks <= 0)
+        return;
+
+    remainingTasks.store(numTasks, std::memory_order_relaxed);
+
+    // Queue in reverse so the owner pops the first task and thieves take the last
+    for (int i = numTasks; --i >= 0;)
+        deque.push(tasks[i]);
+
+    // One wake per task beyond the one this thread starts on
+    for (int i = 0; i < juce::jmin(workers.size(), numTasks - 1); ++i)
+        workers.getUnchecked(i)->wake();
+
+    while (auto* task = deque.pop())
+        runTask(task);
+
+    // Join: the remaining tasks are already running on real-time workers, so
+    // they are close to done; spin briefly, then give the core up between checks
+    const auto spinUntil = juce::Time::getHighResolutionTicks() + spinTicks;
+
+    while (remainingTasks.load(std::memory_order_acquire) > 0)
+    {
+        if (juce::Time::getHighResolutionTicks() < spinUntil)
+            HyperPrismThreads::pause();
+        else
+            juce::Thread::yield();
+    }
+}
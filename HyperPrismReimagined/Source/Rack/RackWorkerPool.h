@@ -0,0 +1,93 @@
+//==============================================================================
+// HyperPrism Reimagined - Rack Worker Pool
+// A few real-time priority threads that help the audio thread through the
+// independent branches of a parallel stage. The audio thread queues the
+// branches on a lock-free work-stealing deque, runs what the workers have not
+// stolen, and returns once every branch has finished.
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Shared/RealtimeSemaphore.h"
+
+class RackWorkerPool
+{
+public:
+    //==============================================================================
+    // A unit of work; run() is called exactly once, on whichever thread claims it
+    struct Task
+    {
+        virtual ~Task() = default;
+        virtual void run() noexcept = 0;
+    };
+
+    static constexpr int maxTasks = 64;
+
+    RackWorkerPool() = default;
+    ~RackWorkerPool();
+
+    // Restarts the worker threads whenever the count, block size or sample rate
+    // changes; the last two set the threads' real-time scheduling hints. Only
+    // threads the system grants real-time priority are kept: the audio thread
+    // would otherwise wait on a thread it can preempt. Call from the message
+    // thread while the audio thread is not in runAll().
+    void setNumWorkers(int numWorkers, int blockSize, double sampleRate);
+    int getNumWorkers() const noexcept { return workers.size(); }
+
+    // Runs every task and returns when all of them have finished. The calling
+    // thread takes part, and runs every task no worker has claimed by the time
+    // it gets to it, so with no workers (or late ones) this runs them in order.
+    // Never allocates or takes a lock: workers are woken through a semaphore.
+    // It does wait for tasks a worker is already running, spinning with a CPU
+    // pause for up to maxSpinMicroseconds and then yielding between checks.
+    void runAll(Task* const* tasks, int numTasks) noexcept;
+
+    static constexpr int maxSpinMicroseconds = 50;
+
+private:
+    //==============================================================================
+    // Bounded Chase-Lev deque: the owner pushes and pops at the bottom, other
+    // threads steal from the top
+    class WorkStealingDeque
+    {
+    public:
+        bool push(Task* task) noexcept;
+        Task* pop() noexcept;
+        Task* steal() noexcept;
+
+    private:
+        static constexpr juce::int64 mask = maxTasks - 1;
+
+        std::atomic<juce::int64> top { 0 };
+        std::atomic<juce::int64> bottom { 0 };
+        std::array<std::atomic<Task*>, maxTasks> slots {};
+    };
+
+    class Worker : public juce::Thread
+    {
+    public:
+        Worker(RackWorkerPool& owner, int index);
+        ~Worker() override;
+
+        void wake() noexcept { wakeSemaphore.signal(); }
+
+    private:
+        void run() override;
+
+        RackWorkerPool& pool;
+        HyperPrismThreads::Semaphore wakeSemaphore;
+    };
+
+    void runTask(Task* task) noexcept;
+
+    WorkStealingDeque deque;    // Owned by the thread calling runAll()
+    std::atomic<int> remainingTasks { 0 };
+
+    juce::OwnedArray<Worker> workers;
+    int requestedWorkers = 0, preparedBlockSize = 0;
+    double preparedSampleRate = 0.0;
+    juce::int64 spinTicks = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RackWorkerPool)
+};
@@ -0,0 +1,491 @@
+//==============================================================================
+// HyperPrism Reimagined - Batch Renderer Implementation
+//==============================================================================
+
+#include "BatchRenderer.h"
+
+namespace HyperPrismRender
+{
+    namespace
+    {
+        // Formats the renderer can write; anything else is written as WAV
+        const juce::StringArray writableExtensions { "wav", "aif", "aiff", "flac" };
+
+        juce::String formatSeconds(double seconds)
+        {
+            return juce::String(seconds, 1) + " s";
+        }
+    }
+
+    //==============================================================================
+    std::vector<InputFile> collectInputFiles(const juce::StringArray& paths)
+    {
+        juce::AudioFormatManager formats;
+        formats.registerBasicFormats();
+        const auto wildcard = formats.getWildcardForAllFormats();
+
+        std::vector<InputFile> inputs;
+
+        for (const auto& path : paths)
+        {
+            const auto location = juce::File::getCurrentWorkingDirectory().getChildFile(path);
+
+            if (location.isDirectory())
+            {
+                for (const auto& entry : juce::RangedDirectoryIterator(location, true, wildcard, juce::File::findFiles))
+                    inputs.push_back({ entry.getFile(), entry.getFile().getRelativePathFrom(location) });
+            }
+            else if (location.existsAsFile())
+            {
+                inputs.push_back({ location, location.getFileName() });
+            }
+            else
+            {
+                juce::ConsoleApplication::fail("Not found: " + path);
+            }
+        }
+
+        // Longest first, so the batch does not end with one thread working
+        // through a long file while the others sit idle
+        std::stable_sort(inputs.begin(), inputs.end(), [](const InputFile& a, const InputFile& b)
+        {
+            return a.file.getSize() > b.file.getSize();
+        });
+
+        return inputs;
+    }
+
+    //==============================================================================
+    BatchRenderer::BatchRenderer(const RenderSettings& settingsToUse)
+        : settings(settingsToUse)
+    {
+        formats.registerBasicFormats();
+    }
+
+    RenderSummary BatchRenderer::run(const std::vector<InputFile>& inputs)
+    {
+        RenderSummary summary;
+
+        if (inputs.empty())
+            return summary;
+
+        const auto startTime = juce::Time::getMillisecondCounterHiRes();
+        const auto numInputs = static_cast<int>(inputs.size());
+
+        // Chains are built here, where an unknown parameter can still stop the run
+        idleChains.push_back(std::make_unique<RenderChain>(settings.chain));
+
+        // Signal memory does not depend on the file, only whether it is bounded
+        idleChains.back()->prepare(44100.0, settings.blockSize);
+        const auto canChunk = settings.chunkSeconds > 0.0 && settings.numThreads > 1
+                                && idleChains.back()->getSignalMemorySamples() >= 0;
+
+        // A chunked file keeps every thread busy however few files there are
+        const auto numThreads = canChunk ? settings.numThreads : juce::jlimit(1, numInputs, settings.numThreads);
+
+        while (static_cast<int>(idleChains.size()) < numThreads)
+            idleChains.push_back(std::make_unique<RenderChain>(settings.chain));
+
+        int numFinished = 0;
+        juce::WaitableEvent allFinished;
+
+        const auto report = [&](const InputFile& input, Outcome outcome, const juce::String& message, double audioSeconds)
+        {
+            const juce::ScopedLock sl(outputLock);
+
+            switch (outcome)
+            {
+                case Outcome::rendered: ++summary.rendered; summary.audioSeconds += audioSeconds; break;
+                case Outcome::skipped:  ++summary.skipped; break;
+                case Outcome::failed:   ++summary.failed; break;
+            }
+
+            ++numFinished;
+            std::cout << "[" << numFinished << "/" << numInputs << "] " << input.relativePath
+                      << "  " << message << std::endl;
+
+            if (numFinished == numInputs)
+                allFinished.signal();
+        };
+
+        juce::ThreadPool pool(juce::ThreadPoolOptions{}
+                                  .withThreadName("HyperPrism render")
+                                  .withNumberOfThreads(numThreads));
+
+        // Long files go first, one at a time across every thread; this thread
+        // reads and writes them while the pool renders their chunks
+        std::vector<const InputFile*> remaining;
+
+        for (const auto& input : inputs)
+        {
+            if (canChunk && isLongEnoughToChunk(input.file))
+            {
+                juce::String message;
+                double audioSeconds = 0.0;
+                const auto outcome = renderFile(input, &pool, message, audioSeconds);
+                report(input, outcome, message, audioSeconds);
+            }
+            else
+            {
+                remaining.push_back(&input);
+            }
+        }
+
+        for (const auto* input : remaining)
+        {
+            pool.addJob([this, input, &report]
+            {
+                juce::String message;
+                double audioSeconds = 0.0;
+                const auto outcome = renderFile(*input, nullptr, message, audioSeconds);
+                report(*input, outcome, message, audioSeconds);
+
+                return juce::ThreadPoolJob::jobHasFinished;
+            });
+        }
+
+        // The pool's destructor would only wait a few seconds for running jobs
+        allFinished.wait();
+
+        summary.wallSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+        return summary;
+    }
+
+    //==============================================================================
+    BatchRenderer::Outcome BatchRenderer::renderFile(const InputFile& input, juce::ThreadPool* chunkPool,
+                                                     juce::String& message, double& audioSeconds)
+    {
+        const auto outputFile = getOutputFile(input);
+
+        if (outputFile == input.file)
+        {
+            message = "would overwrite its input; choose another --output or a --suffix";
+            return Outcome::failed;
+        }
+
+        if (outputFile.exists() && ! settings.overwrite)
+        {
+            message = "exists, skipped";
+            return Outcome::skipped;
+        }
+
+        auto reader = openReader(input.file);
+
+        if (reader == nullptr)
+        {
+            message = "could not be read";
+            return Outcome::failed;
+        }
+
+        const auto numChannels = static_cast<int>(reader->numChannels);
+
+        if (numChannels < 1 || numChannels > 2)
+        {
+            message = "has " + juce::String(numChannels) + " channels; only mono and stereo files are rendered";
+            return Outcome::failed;
+        }
+
+        if (! outputFile.getParentDirectory().createDirectory())
+        {
+            message = "could not create " + outputFile.getParentDirectory().getFullPathName();
+            return Outcome::failed;
+        }
+
+        // Written next to the target and moved into place once complete, so an
+        // interrupted batch never leaves a truncated file that looks finished
+        juce::TemporaryFile temporary(outputFile);
+        auto writer = createWriter(temporary.getFile(), *reader, numChannels);
+
+        if (writer == nullptr)
+        {
+            message = "could not write " + outputFile.getFullPathName();
+            return Outcome::failed;
+        }
+
+        const auto sampleRate = reader->sampleRate;
+        auto chain = acquireChain();
+        chain->prepare(sampleRate, settings.blockSize);
+
+        // The chain delays its output by its latency: that many samples are
+        // dropped from the start and rendered past the end of the input instead
+        const auto latency = static_cast<juce::int64>(chain->getLatencySamples());
+        const auto signalMemory = chain->getSignalMemorySamples();
+        juce::int64 tail = 0;
+
+        if (settings.renderTails)
+        {
+            const auto tailSeconds = juce::jmin(chain->getTailLengthSeconds(), settings.maxTailSeconds);
+            tail = static_cast<juce::int64>(std::ceil(tailSeconds * sampleRate));
+        }
+
+        const auto inputLength = reader->lengthInSamples;
+        const auto renderLength = inputLength + latency + tail;
+        const auto chunkLength = getChunkLength(sampleRate);
+        const auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+        // Splitting only pays off with a few chunks that are each much longer
+        // than the input they have to re-render before them
+        const auto useChunks = chunkPool != nullptr && signalMemory >= 0
+                                 && renderLength >= 2 * chunkLength && signalMemory < chunkLength / 2;
+        bool succeeded = false;
+
+        if (useChunks)
+        {
+            // The chunks borrow every chain, this one included
+            releaseChain(std::move(chain));
+            succeeded = renderInChunks(*chunkPool, *reader, *writer, renderLength, latency, signalMemory, message);
+        }
+        else
+        {
+            succeeded = renderSerially(*chain, *reader, *writer, renderLength, latency, message);
+            releaseChain(std::move(chain));
+        }
+
+        if (! succeeded)
+            return Outcome::failed;
+
+        // Flushes and closes the file before it is moved
+        writer.reset();
+
+        if (! temporary.overwriteTargetFileWithTemporary())
+        {
+            message = "could not replace " + outputFile.getFullPathName();
+            return Outcome::failed;
+        }
+
+        const auto renderSeconds = juce::jmax(1.0e-6, (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0);
+        audioSeconds = static_cast<double>(inputLength) / sampleRate;
+
+        message = formatSeconds(audioSeconds) + " + " + formatSeconds(static_cast<double>(tail) / sampleRate) + " tail, "
+                + juce::String(audioSeconds / renderSeconds, 1) + "x real time" + (useChunks ? " in chunks" : "");
+        return Outcome::rendered;
+    }
+
+    bool BatchRenderer::renderSerially(RenderChain& chain, juce::AudioFormatReader& reader, juce::AudioFormatWriter& writer,
+                                       juce::int64 renderLength, juce::int64 latency, juce::String& message)
+    {
+        const auto blockSize = settings.blockSize;
+        const auto inputLength = reader.lengthInSamples;
+
+        // Mono files run through the chain as dual mono and are written back as mono
+        juce::AudioBuffer<float> buffer(2, blockSize);
+
+        for (juce::int64 position = 0; position < renderLength; position += blockSize)
+        {
+            const auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(blockSize), renderLength - position));
+            const auto numToRead = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0),
+                                                                 static_cast<juce::int64>(numSamples),
+                                                                 inputLength - position));
+
+            if (numToRead > 0 && ! reader.read(&buffer, 0, numToRead, position, true, true))
+            {
+                message = "read error at sample " + juce::String(position);
+                return false;
+            }
+
+            if (numToRead < numSamples)
+                buffer.clear(numToRead, numSamples - numToRead);
+
+            juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), 2, numSamples);
+            chain.process(block);
+
+            const auto skip = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0),
+                                                            static_cast<juce::int64>(numSamples),
+                                                            latency - position));
+
+            if (skip < numSamples && ! writer.writeFromAudioSampleBuffer(block, skip, numSamples - skip))
+            {
+                message = "write error";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool BatchRenderer::renderInChunks(juce::ThreadPool& pool, juce::AudioFormatReader& reader, juce::AudioFormatWriter& writer,
+                                       juce::int64 renderLength, juce::int64 latency, int signalMemory, juce::String& message)
+    {
+        const auto blockSize = static_cast<juce::int64>(settings.blockSize);
+        const auto sampleRate = reader.sampleRate;
+        const auto inputLength = reader.lengthInSamples;
+        const auto chunkLength = getChunkLength(sampleRate);
+        const auto preRoll = (static_cast<juce::int64>(signalMemory) + blockSize - 1) / blockSize * blockSize;
+        const auto numThreads = pool.getNumThreads();
+
+        struct Chunk
+        {
+            juce::int64 start = 0;          // First sample this chunk writes
+            juce::int64 end = 0;
+            juce::int64 readStart = 0;      // Up to preRoll earlier, where processing starts
+            juce::AudioBuffer<float> buffer;
+        };
+
+        // One round of chunks per thread at a time bounds memory to a few chunks
+        std::vector<Chunk> chunks(static_cast<size_t>(numThreads));
+
+        for (juce::int64 roundStart = 0; roundStart < renderLength; roundStart += chunkLength * numThreads)
+        {
+            int numChunks = 0;
+
+            // Readers are not thread-safe, so the input is read here rather than in the jobs
+            for (; numChunks < numThreads && roundStart + chunkLength * numChunks < renderLength; ++numChunks)
+            {
+                auto& chunk = chunks[static_cast<size_t>(numChunks)];
+                chunk.start = roundStart + chunkLength * numChunks;
+                chunk.end = juce::jmin(renderLength, chunk.start + chunkLength);
+                chunk.readStart = juce::jmax(static_cast<juce::int64>(0), chunk.start - preRoll);
+
+                const auto length = static_cast<int>(chunk.end - chunk.readStart);
+                const auto numToRead = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0),
+                                                                     static_cast<juce::int64>(length),
+                                                                     inputLength - chunk.readStart));
+                chunk.buffer.setSize(2, length, false, false, true);
+
+                if (numToRead > 0 && ! reader.read(&chunk.buffer, 0, numToRead, chunk.readStart, true, true))
+                {
+                    message = "read error at sample " + juce::String(chunk.readStart);
+                    return false;
+                }
+
+                if (numToRead < length)
+                    chunk.buffer.clear(numToRead, length - numToRead);
+            }
+
+            std::atomic<int> numRemaining { numChunks };
+            juce::WaitableEvent roundFinished;
+
+            for (int i = 0; i < numChunks; ++i)
+            {
+                pool.addJob([this, &chunk = chunks[static_cast<size_t>(i)], &numRemaining, &roundFinished, sampleRate]
+                {
+                    auto chain = acquireChain();
+                    chain->prepare(sampleRate, settings.blockSize);
+
+                    const auto length = chunk.buffer.getNumSamples();
+
+                    for (int offset = 0; offset < length; offset += settings.blockSize)
+                    {
+                        juce::AudioBuffer<float> block(chunk.buffer.getArrayOfWritePointers(), 2, offset,
+                                                       juce::jmin(settings.blockSize, length - offset));
+                        chain->process(block);
+                    }
+
+                    releaseChain(std::move(chain));
+
+                    if (--numRemaining == 0)
+                        roundFinished.signal();
+
+                    return juce::ThreadPoolJob::jobHasFinished;
+                });
+            }
+
+            roundFinished.wait();
+
+            // Each chunk writes only its own region, in order, dropping the pre-roll
+            for (int i = 0; i < numChunks; ++i)
+            {
+                const auto& chunk = chunks[static_cast<size_t>(i)];
+                const auto from = juce::jmax(chunk.start, latency);
+
+                if (from < chunk.end
+                    && ! writer.writeFromAudioSampleBuffer(chunk.buffer, static_cast<int>(from - chunk.readStart),
+                                                           static_cast<int>(chunk.end - from)))
+                {
+                    message = "write error";
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    juce::int64 BatchRenderer::getChunkLength(double sampleRate) const
+    {
+        const auto blockSize = static_cast<juce::int64>(settings.blockSize);
+        const auto length = static_cast<juce::int64>(std::ceil(settings.chunkSeconds * sampleRate));
+
+        return (length + blockSize - 1) / blockSize * blockSize;
+    }
+
+    bool BatchRenderer::isLongEnoughToChunk(const juce::File& file)
+    {
+        auto reader = openReader(file);
+        return reader != nullptr && reader->lengthInSamples >= 2 * getChunkLength(reader->sampleRate);
+    }
+
+    //==============================================================================
+    std::unique_ptr<juce::AudioFormatReader> BatchRenderer::openReader(const juce::File& file)
+    {
+        if (auto* format = formats.findFormatForFileExtension(file.getFileExtension()))
+        {
+            // Reads straight from the page cache instead of copying through a stream
+            std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped(format->createMemoryMappedReader(file));
+
+            if (mapped != nullptr && mapped->mapEntireFile())
+                return mapped;
+        }
+
+        return std::unique_ptr<juce::AudioFormatReader>(formats.createReaderFor(file));
+    }
+
+    std::unique_ptr<juce::AudioFormatWriter> BatchRenderer::createWriter(const juce::File& file,
+                                                                         const juce::AudioFormatReader& reader,
+                                                                         int numChannels) const
+    {
+        auto* format = formats.findFormatForFileExtension(file.getFileExtension());
+        if (format == nullptr)
+            return nullptr;
+
+        // The requested depth if the format has it, otherwise the deepest it offers
+        const auto possibleDepths = format->getPossibleBitDepths();
+        auto bitDepth = settings.bitDepth > 0 ? settings.bitDepth : static_cast<int>(reader.bitsPerSample);
+
+        if (! possibleDepths.contains(bitDepth) && ! possibleDepths.isEmpty())
+            bitDepth = possibleDepths.getLast();
+
+        std::unique_ptr<juce::OutputStream> stream = file.createOutputStream();
+        if (stream == nullptr)
+            return nullptr;
+
+        // Metadata chunks (BWF, iXML, ...) are carried over where the format can hold them
+        std::unique_ptr<juce::AudioFormatWriter> writer(format->createWriterFor(stream.get(), reader.sampleRate,
+                                                                                static_cast<unsigned int>(numChannels),
+                                                                                bitDepth, reader.metadataValues, 0));
+        if (writer != nullptr)
+            stream.release();   // Now owned by the writer
+
+        return writer;
+    }
+
+    juce::File BatchRenderer::getOutputFile(const InputFile& input) const
+    {
+        auto extension = settings.outputFormat.isNotEmpty() ? settings.outputFormat
+                                                            : input.file.getFileExtension().substring(1);
+
+        if (! writableExtensions.contains(extension, true))
+            extension = "wav";
+
+        const auto target = settings.outputDirectory.getChildFile(input.relativePath);
+        return target.getSiblingFile(target.getFileNameWithoutExtension() + settings.suffix + "." + extension.toLowerCase());
+    }
+
+    //==============================================================================
+    std::unique_ptr<RenderChain> BatchRenderer::acquireChain()
+    {
+        const juce::ScopedLock sl(chainLock);
+
+        // There is one chain per worker thread, so one is always free here
+        jassert(! idleChains.empty());
+        auto chain = std::move(idleChains.back());
+        idleChains.pop_back();
+        return chain;
+    }
+
+    void BatchRenderer::releaseChain(std::unique_ptr<RenderChain> chain)
+    {
+        const juce::ScopedLock sl(chainLock);
+        idleChains.push_back(std::move(chain));
+    }
+}
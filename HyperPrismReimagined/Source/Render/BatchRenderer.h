@@ -0,0 +1,97 @@
+//==============================================================================
+// HyperPrism Reimagined - Batch Renderer
+// Renders a list of audio files through one chain, a file per worker thread at
+// a time, streaming each file from reader to writer block by block. Long files
+// through a chain with bounded memory are instead split into chunks rendered
+// side by side.
+//==============================================================================
+
+#pragma once
+
+#include "RenderChain.h"
+
+namespace HyperPrismRender
+{
+    struct RenderSettings
+    {
+        ChainDescription chain;
+        juce::File outputDirectory;
+        juce::String outputFormat;          // File extension such as "wav"; empty keeps each input's
+        juce::String suffix;                // Appended to each output file name
+        int bitDepth = 0;                   // 0 keeps each input's
+        int blockSize = 4096;
+        int numThreads = 1;
+        bool renderTails = true;            // Flush each effect's reported tail after the input ends
+        double maxTailSeconds = 30.0;       // Cap for effects that report an infinite tail
+        bool overwrite = false;             // Otherwise outputs that already exist are skipped
+        double chunkSeconds = 10.0;         // Chunk length for splitting long files across threads; 0 never splits
+    };
+
+    struct InputFile
+    {
+        juce::File file;
+        juce::String relativePath;          // Path below the output directory
+    };
+
+    // Expands files and directories (searched recursively for readable audio
+    // files) into inputs; a directory's files keep their relative paths
+    std::vector<InputFile> collectInputFiles(const juce::StringArray& paths);
+
+    struct RenderSummary
+    {
+        int rendered = 0;
+        int skipped = 0;
+        int failed = 0;
+        double audioSeconds = 0.0;          // Input audio rendered, excluding tails
+        double wallSeconds = 0.0;
+    };
+
+    class BatchRenderer
+    {
+    public:
+        explicit BatchRenderer(const RenderSettings& settings);
+
+        // Renders every file and prints one line per file as it completes
+        RenderSummary run(const std::vector<InputFile>& inputs);
+
+    private:
+        enum class Outcome { rendered, skipped, failed };
+
+        // Splits the file across chunkPool's threads when the chain allows it;
+        // without a pool the file is rendered on the calling thread
+        Outcome renderFile(const InputFile& input, juce::ThreadPool* chunkPool, juce::String& message, double& audioSeconds);
+
+        bool renderSerially(RenderChain& chain, juce::AudioFormatReader& reader, juce::AudioFormatWriter& writer,
+                            juce::int64 renderLength, juce::int64 latency, juce::String& message);
+
+        // Every chunk starts with enough of the input before it to rebuild the
+        // chain's state, and on a block boundary, so the output matches a
+        // serial render sample for sample
+        bool renderInChunks(juce::ThreadPool& pool, juce::AudioFormatReader& reader, juce::AudioFormatWriter& writer,
+                            juce::int64 renderLength, juce::int64 latency, int signalMemory, juce::String& message);
+
+        // Rounded up to whole blocks; 0 when chunking is off
+        juce::int64 getChunkLength(double sampleRate) const;
+        bool isLongEnoughToChunk(const juce::File& file);
+
+        // Memory-mapped where the format supports it, streamed otherwise
+        std::unique_ptr<juce::AudioFormatReader> openReader(const juce::File& file);
+        std::unique_ptr<juce::AudioFormatWriter> createWriter(const juce::File& file, const juce::AudioFormatReader& reader,
+                                                              int numChannels) const;
+        juce::File getOutputFile(const InputFile& input) const;
+
+        // One chain per worker; a job borrows one for the length of a file or chunk
+        std::unique_ptr<RenderChain> acquireChain();
+        void releaseChain(std::unique_ptr<RenderChain> chain);
+
+        const RenderSettings settings;
+        juce::AudioFormatManager formats;
+
+        juce::CriticalSection chainLock;
+        std::vector<std::unique_ptr<RenderChain>> idleChains;
+
+        juce::CriticalSection outputLock;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BatchRenderer)
+    };
+}
@@ -0,0 +1,234 @@
+//==============================================================================
+// HyperPrism Reimagined - Render Chain Implementation
+//==============================================================================
+
+#include "RenderChain.h"
+#include "../Shared/EffectRegistry.h"
+#include "../Shared/SignalMemory.h"
+
+namespace HyperPrismRender
+{
+    namespace
+    {
+        juce::String getParameterID(juce::AudioProcessorParameter& parameter)
+        {
+            if (auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(&parameter))
+                return withID->paramID;
+
+            return parameter.getName(64);
+        }
+
+        juce::AudioProcessorParameter* findParameter(juce::AudioProcessor& processor, const juce::String& id)
+        {
+            for (auto* parameter : processor.getParameters())
+                if (getParameterID(*parameter).equalsIgnoreCase(id) || parameter->getName(64).equalsIgnoreCase(id))
+                    return parameter;
+
+            return nullptr;
+        }
+
+        // Numbers are in the parameter's own units (Hz, dB, ms, %); strings go
+        // through the parameter's text conversion, so choices can be given by name
+        float toNormalisedValue(juce::AudioProcessorParameter& parameter, const juce::var& value)
+        {
+            if (value.isString())
+                return parameter.getValueForText(value.toString());
+
+            if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(&parameter))
+                return ranged->convertTo0to1(static_cast<float>(value));
+
+            return static_cast<float>(value);
+        }
+
+        // Applies a value exactly as a plugin wrapper does for host automation
+        void setFromHost(juce::AudioProcessorParameter& parameter, float normalisedValue)
+        {
+            parameter.setValue(juce::jlimit(0.0f, 1.0f, normalisedValue));
+            parameter.sendValueChangedMessageToListeners(parameter.getValue());
+        }
+
+        juce::MemoryBlock loadPreset(const juce::File& file)
+        {
+            juce::MemoryBlock state;
+
+            if (! file.loadFileAsData(state))
+                juce::ConsoleApplication::fail("Could not read preset " + file.getFullPathName());
+
+            // Plain XML is wrapped the way the plugins' getStateInformation writes it
+            if (auto xml = juce::parseXML(file))
+            {
+                state.reset();
+                juce::AudioProcessor::copyXmlToBinary(*xml, state);
+            }
+
+            return state;
+        }
+
+        ChainSlot makeSlot(const juce::String& effect)
+        {
+            const auto* info = HyperPrismRegistry::findEffect(effect);
+
+            if (info == nullptr)
+                juce::ConsoleApplication::fail("Unknown effect '" + effect + "'");
+
+            ChainSlot slot;
+            slot.effect = info->name;
+            return slot;
+        }
+    }
+
+    //==============================================================================
+    ChainDescription parseChain(const juce::String& fileOrEffectList)
+    {
+        ChainDescription chain;
+        const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(fileOrEffectList);
+
+        if (! file.existsAsFile())
+        {
+            for (const auto& name : juce::StringArray::fromTokens(fileOrEffectList, ",", {}))
+                if (name.trim().isNotEmpty())
+                    chain.push_back(makeSlot(name.trim()));
+        }
+        else
+        {
+            juce::var json;
+            const auto result = juce::JSON::parse(file.loadFileAsString(), json);
+
+            if (result.failed())
+                juce::ConsoleApplication::fail("Could not parse " + file.getFullPathName() + ": " + result.getErrorMessage());
+
+            const auto* slots = json["chain"].getArray();
+
+            if (slots == nullptr)
+                juce::ConsoleApplication::fail(file.getFullPathName() + " has no \"chain\" array");
+
+            for (const auto& entry : *slots)
+            {
+                auto slot = makeSlot(entry["effect"].toString());
+
+                if (entry.hasProperty("preset"))
+                    slot.state = loadPreset(file.getParentDirectory().getChildFile(entry["preset"].toString()));
+
+                if (auto* parameters = entry["parameters"].getDynamicObject())
+                    slot.parameters = parameters->getProperties();
+
+                chain.push_back(std::move(slot));
+            }
+        }
+
+        if (chain.empty())
+            juce::ConsoleApplication::fail("The chain is empty");
+
+        return chain;
+    }
+
+    //==============================================================================
+    RenderChain::RenderChain(const ChainDescription& description)
+    {
+        for (const auto& slot : description)
+        {
+            auto processor = HyperPrismRegistry::createEffect(slot.effect);
+
+            if (slot.state.getSize() > 0)
+                processor->setStateInformation(slot.state.getData(), static_cast<int>(slot.state.getSize()));
+
+            for (const auto& parameter : slot.parameters)
+            {
+                auto* target = findParameter(*processor, parameter.name.toString());
+
+                if (target == nullptr)
+                    juce::ConsoleApplication::fail("Unknown parameter '" + parameter.name.toString()
+                                                   + "' for " + slot.effect + " (see --params=" + slot.effect + ")");
+
+                setFromHost(*target, toNormalisedValue(*target, parameter.value));
+            }
+
+            processors.push_back(std::move(processor));
+        }
+    }
+
+    void RenderChain::prepare(double sampleRate, int blockSize)
+    {
+        for (auto& processor : processors)
+        {
+            processor->setPlayConfigDetails(2, 2, sampleRate, blockSize);
+            processor->setNonRealtime(true);
+            processor->prepareToPlay(sampleRate, blockSize);
+        }
+    }
+
+    void RenderChain::process(juce::AudioBuffer<float>& buffer)
+    {
+        for (auto& processor : processors)
+        {
+            midi.clear();
+            processor->processBlock(buffer, midi);
+        }
+    }
+
+    int RenderChain::getLatencySamples() const
+    {
+        int latency = 0;
+
+        for (const auto& processor : processors)
+            latency += processor->getLatencySamples();
+
+        return latency;
+    }
+
+    double RenderChain::getTailLengthSeconds() const
+    {
+        double tail = 0.0;
+
+        for (const auto& processor : processors)
+            tail += processor->getTailLengthSeconds();
+
+        return tail;
+    }
+
+    int RenderChain::getSignalMemorySamples() const
+    {
+        int memory = 0;
+
+        for (const auto& processor : processors)
+        {
+            const auto processorMemory = HyperPrismSignalMemory::getSignalMemorySamples(*processor);
+            if (processorMemory < 0)
+                return -1;
+
+            memory += processorMemory;
+        }
+
+        return memory;
+    }
+
+    //==============================================================================
+    void printParameters(const juce::String& effect)
+    {
+        const auto slot = makeSlot(effect);
+        auto processor = HyperPrismRegistry::createEffect(slot.effect);
+
+        std::cout << slot.effect << std::endl;
+
+        for (auto* parameter : processor->getParameters())
+        {
+            juce::String line = "  " + getParameterID(*parameter) + " (" + parameter->getName(64) + ")";
+
+            if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+            {
+                const auto& range = ranged->getNormalisableRange();
+                line << "  " << range.start << " .. " << range.end;
+            }
+
+            const auto label = parameter->getLabel();
+            line << (label.isNotEmpty() ? " " + label : juce::String())
+                 << ", default " << parameter->getText(parameter->getDefaultValue(), 64);
+
+            const auto choices = parameter->getAllValueStrings();
+            if (choices.size() > 0 && choices.size() <= 16)
+                line << "  [" << choices.joinIntoString(", ") << "]";
+
+            std::cout << line << std::endl;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+//==============================================================================
+// HyperPrism Reimagined - Render Chain
+// A serial chain of processors built from a chain description, for offline
+// rendering without a host
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismRender
+{
+    //==============================================================================
+    // One effect in a chain description: a saved state to start from, then
+    // individual parameter values on top of it
+    struct ChainSlot
+    {
+        juce::String effect;
+        juce::MemoryBlock state;            // As written by getStateInformation; empty for defaults
+        juce::NamedValueSet parameters;     // Parameter ID -> value in the parameter's own units, or its text
+    };
+
+    using ChainDescription = std::vector<ChainSlot>;
+
+    // Reads a chain from a JSON file:
+    //
+    //   { "chain": [ { "effect": "HighPass", "parameters": { "cutoff": 80 } },
+    //                { "effect": "Compressor", "preset": "vocal.xml" } ] }
+    //
+    // "preset" is a file saved from the plugin (its state blob or the XML inside
+    // it), relative to the chain file. A comma-separated list of effect names is
+    // accepted instead of a file and gives each effect its defaults. Fails the
+    // console application on any error.
+    ChainDescription parseChain(const juce::String& fileOrEffectList);
+
+    //==============================================================================
+    // The processors for one render thread. Creating a chain applies the presets
+    // and parameters, and fails the console application on unknown names, so
+    // chains are built up front on the main thread.
+    class RenderChain
+    {
+    public:
+        explicit RenderChain(const ChainDescription& description);
+
+        // Prepares every processor for a file; this also clears their state
+        void prepare(double sampleRate, int blockSize);
+        void process(juce::AudioBuffer<float>& buffer);
+
+        // Sums over the chain; a tail is infinite if any effect's is
+        int getLatencySamples() const;
+        double getTailLengthSeconds() const;
+
+        // Input history the chain's output depends on, once prepared; -1 if any
+        // effect's is unbounded. Each effect adds its own on top of what feeds it.
+        int getSignalMemorySamples() const;
+
+    private:
+        std::vector<std::unique_ptr<juce::AudioProcessor>> processors;
+        juce::MidiBuffer midi;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderChain)
+    };
+
+    // Prints each effect's parameter IDs, ranges and defaults for writing chain files
+    void printParameters(const juce::String& effect);
+}
@@ -0,0 +1,138 @@
+//==============================================================================
+// HyperPrism Reimagined - Offline Batch Renderer Entry Point
+// Renders audio files through a chain of the 32 processors without a host
+//==============================================================================
+
+#include <JuceHeader.h>
+#include "BatchRenderer.h"
+#include "../Shared/EffectRegistry.h"
+
+namespace
+{
+    void runRenderCommand(const juce::ArgumentList& args)
+    {
+        using namespace HyperPrismRender;
+
+        if (! args.containsOption("--chain") || ! args.containsOption("--output"))
+            juce::ConsoleApplication::fail("--chain and --output are required");
+
+        RenderSettings settings;
+        settings.chain = parseChain(args.getValueForOption("--chain"));
+
+        settings.outputDirectory = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--output"));
+        settings.suffix = args.getValueForOption("--suffix");
+        settings.overwrite = args.containsOption("--overwrite");
+        settings.renderTails = ! args.containsOption("--no-tail");
+        settings.numThreads = juce::SystemStats::getNumCpus();
+
+        if (args.containsOption("--format"))
+        {
+            settings.outputFormat = args.getValueForOption("--format").trimCharactersAtStart(".").toLowerCase();
+
+            if (! juce::StringArray { "wav", "aif", "aiff", "flac" }.contains(settings.outputFormat))
+                juce::ConsoleApplication::fail("--format must be wav, aiff or flac");
+        }
+
+        if (args.containsOption("--bits"))
+            settings.bitDepth = juce::jmax(0, args.getValueForOption("--bits").getIntValue());
+
+        if (args.containsOption("--block"))
+            settings.blockSize = juce::jlimit(16, 65536, args.getValueForOption("--block").getIntValue());
+
+        if (args.containsOption("--threads"))
+            settings.numThreads = juce::jmax(1, args.getValueForOption("--threads").getIntValue());
+
+        if (args.containsOption("--max-tail"))
+            settings.maxTailSeconds = juce::jmax(0.0, args.getValueForOption("--max-tail").getDoubleValue());
+
+        if (args.containsOption("--chunk-seconds"))
+            settings.chunkSeconds = juce::jmax(0.0, args.getValueForOption("--chunk-seconds").getDoubleValue());
+
+        // Inputs are the arguments that are not options, plus one path per line of --files
+        juce::StringArray paths;
+
+        for (int i = 0; i < args.size(); ++i)
+            if (! args[i].isOption())
+                paths.add(args[i].text);
+
+        if (args.containsOption("--files"))
+        {
+            const auto listFile = args.getExistingFileForOption("--files");
+            paths.addLines(listFile.loadFileAsString());
+            paths.trim();
+            paths.removeEmptyStrings();
+        }
+
+        const auto inputs = collectInputFiles(paths);
+
+        if (inputs.empty())
+            juce::ConsoleApplication::fail("No input files");
+
+        std::cout << "Rendering " << inputs.size() << " files on " << juce::jmin(settings.numThreads, static_cast<int>(inputs.size()))
+                  << " threads" << std::endl;
+
+        BatchRenderer renderer(settings);
+        const auto summary = renderer.run(inputs);
+
+        const auto hours = juce::jmax(1.0e-9, summary.wallSeconds / 3600.0);
+        std::cout << std::endl
+                  << summary.rendered << " rendered, " << summary.skipped << " skipped, " << summary.failed << " failed in "
+                  << juce::String(summary.wallSeconds, 1) << " s" << std::endl
+                  << juce::String(summary.rendered / hours, 0) << " files/hour, "
+                  << juce::String(summary.audioSeconds / juce::jmax(1.0e-9, summary.wallSeconds), 1) << "x real time overall"
+                  << std::endl;
+
+        if (summary.failed > 0)
+            juce::ConsoleApplication::fail(juce::String(summary.failed) + " files failed", 6);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // APVTS relies on timers, so a message manager has to exist even though nothing is shown
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "HyperPrismRender - offline batch rendering through HyperPrism effect chains", true);
+    app.addVersionCommand("--version|-v", "HyperPrismRender 1.0.0");
+
+    app.addCommand({ "--list",
+                     "--list",
+                     "Lists the effect names accepted in a chain",
+                     {},
+                     [](const juce::ArgumentList&)
+                     {
+                         for (const auto& effect : HyperPrismRegistry::getAllEffects())
+                             std::cout << effect.name << std::endl;
+                     } });
+
+    app.addCommand({ "--params",
+                     "--params=Effect",
+                     "Lists an effect's parameter IDs, ranges and defaults",
+                     "Prints the IDs to use in a chain file's \"parameters\" object. Numbers are given in the "
+                     "units shown; choices can also be given by name.",
+                     [](const juce::ArgumentList& args)
+                     {
+                         HyperPrismRender::printParameters(args.getValueForOption("--params"));
+                     } });
+
+    app.addCommand({ "--render",
+                     "--render --chain=chain.json|Effect,Effect --output=dir [--files=list.txt] [--threads=n] [--block=4096] "
+                     "[--format=wav|aiff|flac] [--bits=16|24|32] [--suffix=text] [--no-tail] [--max-tail=30] [--chunk-seconds=10] "
+                     "[--overwrite] "
+                     "files-or-directories...",
+                     "Renders audio files through a chain of effects",
+                     "Each input file (directories are searched recursively) is streamed through the chain and "
+                     "written below --output with the same relative path, sample rate, channel count, bit depth and "
+                     "metadata unless --format or --bits say otherwise. Files are rendered in parallel, one per "
+                     "thread, longest first; WAV and AIFF inputs are memory-mapped. After the input, each effect's "
+                     "reported tail is rendered (infinite tails are capped by --max-tail seconds) and the chain's "
+                     "latency is removed from the start. Outputs that already exist are skipped unless --overwrite "
+                     "is given, so an interrupted batch can be resumed. When every effect in the chain has bounded "
+                     "memory (Pan and M/S Matrix), files longer than two chunks are instead split into chunks of "
+                     "--chunk-seconds rendered on all threads at once, with identical output; 0 turns this off. "
+                     "Exits with code 6 if any file failed.",
+                     runRenderCommand });
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -5,6 +5,8 @@
 
 #include "ReverbEditor.h"
 
+namespace HyperPrismReverbUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -94,9 +96,10 @@ void XYPad::setAxisColors(const juce::Colour& xColor, const juce::Colour& yColor
 // ReverbEditor Implementation
 //==============================================================================
 ReverbEditor::ReverbEditor(ReverbProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(ReverbProcessor::ROOM_SIZE_ID);
@@ -234,6 +237,7 @@ ReverbEditor::~ReverbEditor()
 
 void ReverbEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("ReverbEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -278,7 +282,7 @@ void ReverbEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -572,4 +576,6 @@ void ReverbEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismReverbUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "ReverbProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismReverbUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -141,5 +144,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismReverbUI
+
+using HyperPrismReverbUI::ReverbEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "ReverbProcessor.h"
-#include "ReverbEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "ReverbEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String ReverbProcessor::BYPASS_ID = "bypass";
@@ -14,12 +16,19 @@ const juce::String ReverbProcessor::PRE_DELAY_ID = "preDelay";
 const juce::String ReverbProcessor::WIDTH_ID = "width";
 const juce::String ReverbProcessor::LOW_CUT_ID = "lowCut";
 const juce::String ReverbProcessor::HIGH_CUT_ID = "highCut";
+const juce::String ReverbProcessor::BACKGROUND_ID = "backgroundThread";
 
 ReverbProcessor::ReverbProcessor()
      : AudioProcessor(BusesProperties()
                       .withInput("Input", juce::AudioChannelSet::stereo(), true)
                       .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-       valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+       valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+       cutFilters(valueTreeState, { LOW_CUT_ID, HIGH_CUT_ID }, [this](double sampleRate)
+       {
+           return HyperPrismCoefficients::makeCutFilters(sampleRate, lowCutParam->load(), highCutParam->load());
+       }),
+       backgroundWorker(*this, valueTreeState, BACKGROUND_ID,
+                        [this](juce::AudioBuffer<float>& block) { renderBlock(block); })
 {
     // Cache parameter pointers for efficient access
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -62,12 +71,16 @@ juce::AudioProcessorValueTreeState::ParameterLayout ReverbProcessor::createParam
     parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
         HIGH_CUT_ID, "High Cut", 
         juce::NormalisableRange<float>(200.0f, 20000.0f, 1.0f, 0.3f), 20000.0f));
+
+    parameters.push_back(HyperPrismBackground::Worker::createParameter(BACKGROUND_ID));
     
     return { parameters.begin(), parameters.end() };
 }
 
 void ReverbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    backgroundWorker.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare reverb
@@ -80,11 +93,12 @@ void ReverbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     reverb.setParameters(reverbParams);
     reverb.setSampleRate(sampleRate);
     
-    // Prepare pre-delay (max 500ms)
-    maxPreDelayInSamples = static_cast<int>(sampleRate * 0.5);
-    preDelayBuffer.setSize(2, maxPreDelayInSamples);
-    preDelayBuffer.clear();
-    preDelayWriteIndex = 0;
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+
+    // Prepare pre-delay (max 500ms), with room for a whole block in the ring
+    const auto maxPreDelayInSamples = static_cast<int>(sampleRate * 0.5) - 1;
+    leftPreDelay.prepare(maxPreDelayInSamples, scratchCapacity);
+    rightPreDelay.prepare(maxPreDelayInSamples, scratchCapacity);
     
     // Prepare filters
     leftLowCut.reset();
@@ -92,16 +106,25 @@ void ReverbProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     leftHighCut.reset();
     rightHighCut.reset();
     
-    // Reset filter state
-    previousFilterFreq = -1.0f;
+    // Filters start on the current settings rather than gliding to them
+    cutFilters.prepare(sampleRate);
+    leftLowCut.setCoefficients(cutFilters.get().lowCut);
+    rightLowCut.setCoefficients(cutFilters.get().lowCut);
+    leftHighCut.setCoefficients(cutFilters.get().highCut);
+    rightHighCut.setCoefficients(cutFilters.get().highCut);
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    mixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    mixRamp.setCurrentAndTarget(mixParam->load());
 }
 
 void ReverbProcessor::releaseResources()
 {
+    backgroundWorker.release();
     reverb.reset();
-    preDelayBuffer.clear();
+    leftPreDelay.reset();
+    rightPreDelay.reset();
 }
 
 bool ReverbProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -112,8 +135,18 @@ bool ReverbProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
 }
 
-void ReverbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void ReverbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    backgroundWorker.process(buffer);
+}
+
+void ReverbProcessor::renderBlock(juce::AudioBuffer<float>& buffer)
 {
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Reverb::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -133,6 +166,7 @@ void ReverbProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiB
 
 void ReverbProcessor::processReverb(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Reverb::processReverb");
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
     
@@ -140,7 +174,8 @@ void ReverbProcessor::processReverb(juce::AudioBuffer<float>& buffer)
         return;
     
     // Get parameter values
-    float mix = mixParam->load();
+    mixRamp.setTarget(mixParam->load());
+    const auto* mixes = mixRamp.process(numSamples);
     float roomSize = roomSizeParam->load();
     float damping = dampingParam->load();
     float preDelayMs = preDelayParam->load();
@@ -155,42 +190,34 @@ void ReverbProcessor::processReverb(juce::AudioBuffer<float>& buffer)
     reverbParams.width = width;
     reverb.setParameters(reverbParams);
     
-    // Update filters if needed
-    updateFilters();
+    // Glide to cut filter coefficients published since the last block
+    if (cutFilters.update(isNonRealtime()))
+    {
+        const auto& coefficients = cutFilters.get();
+        leftLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        rightLowCut.rampTo(coefficients.lowCut, HyperPrismCoefficients::rampSamples);
+        leftHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+        rightHighCut.rampTo(coefficients.highCut, HyperPrismCoefficients::rampSamples);
+    }
     
     // Calculate pre-delay in samples
     int preDelayInSamples = static_cast<int>((preDelayMs / 1000.0f) * currentSampleRate);
-    preDelayInSamples = juce::jlimit(0, maxPreDelayInSamples - 1, preDelayInSamples);
+    preDelayInSamples = juce::jlimit(0, leftPreDelay.getMaximumDelay(), preDelayInSamples);
     
     // Create a copy for dry signal
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     // Apply pre-delay
     if (preDelayInSamples > 0)
     {
+        // A fixed delay without feedback runs a block at a time
         auto* leftChannel = buffer.getWritePointer(0);
         auto* rightChannel = buffer.getWritePointer(1);
-        auto* preDelayLeft = preDelayBuffer.getWritePointer(0);
-        auto* preDelayRight = preDelayBuffer.getWritePointer(1);
-        
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            // Read delayed samples
-            int readIndex = (preDelayWriteIndex - preDelayInSamples + maxPreDelayInSamples) % maxPreDelayInSamples;
-            float delayedLeft = preDelayLeft[readIndex];
-            float delayedRight = preDelayRight[readIndex];
-            
-            // Write current samples to delay buffer
-            preDelayLeft[preDelayWriteIndex] = leftChannel[sample];
-            preDelayRight[preDelayWriteIndex] = rightChannel[sample];
-            
-            // Replace current samples with delayed ones
-            leftChannel[sample] = delayedLeft;
-            rightChannel[sample] = delayedRight;
-            
-            // Advance write index
-            preDelayWriteIndex = (preDelayWriteIndex + 1) % maxPreDelayInSamples;
-        }
+
+        leftPreDelay.pushBlock(leftChannel, numSamples);
+        rightPreDelay.pushBlock(rightChannel, numSamples);
+        leftPreDelay.readBlock(leftChannel, preDelayInSamples, numSamples);
+        rightPreDelay.readBlock(rightChannel, preDelayInSamples, numSamples);
     }
     
     // Process reverb
@@ -207,52 +234,23 @@ void ReverbProcessor::processReverb(juce::AudioBuffer<float>& buffer)
     auto* leftChannel = buffer.getWritePointer(0);
     auto* rightChannel = buffer.getWritePointer(1);
     
-    for (int sample = 0; sample < numSamples; ++sample)
-    {
-        leftChannel[sample] = leftLowCut.processSingleSampleRaw(leftChannel[sample]);
-        leftChannel[sample] = leftHighCut.processSingleSampleRaw(leftChannel[sample]);
-        
-        rightChannel[sample] = rightLowCut.processSingleSampleRaw(rightChannel[sample]);
-        rightChannel[sample] = rightHighCut.processSingleSampleRaw(rightChannel[sample]);
-    }
+    // A whole channel per filter keeps each one's state in registers
+    leftLowCut.process(leftChannel, numSamples);
+    leftHighCut.process(leftChannel, numSamples);
+    rightLowCut.process(rightChannel, numSamples);
+    rightHighCut.process(rightChannel, numSamples);
     
     // Mix wet and dry signals
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-        auto* dryData = dryBuffer.getReadPointer(channel);
-        
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            channelData[sample] = dryData[sample] + (mix * (channelData[sample] - dryData[sample]));
-        }
-    }
-}
-
-void ReverbProcessor::updateFilters()
-{
-    float lowCutFreq = lowCutParam->load();
-    float highCutFreq = highCutParam->load();
-    
-    // Only update if frequencies changed
-    if (std::abs(lowCutFreq - previousFilterFreq) > 0.1f || 
-        std::abs(highCutFreq - previousFilterFreq) > 0.1f)
-    {
-        // High-pass filter (low cut)
-        leftLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        rightLowCut.setCoefficients(juce::IIRCoefficients::makeHighPass(currentSampleRate, lowCutFreq, 0.707f));
-        
-        // Low-pass filter (high cut)
-        leftHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-        rightHighCut.setCoefficients(juce::IIRCoefficients::makeLowPass(currentSampleRate, highCutFreq, 0.707f));
-        
-        previousFilterFreq = lowCutFreq; // Track one of them
-    }
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, numChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 juce::AudioProcessorEditor* ReverbProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new ReverbEditor(*this);
+   #endif
 }
 
 void ReverbProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -268,4 +266,14 @@ void ReverbProcessor::setStateInformation(const void* data, int sizeInBytes)
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(valueTreeState.state.getType()))
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
+}
+
+void ReverbProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.addUntracked("reverb tank");
+    footprint.add("pre-delay buffer", leftPreDelay.getAllocatedBytes() + rightPreDelay.getAllocatedBytes());
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes());
+    backgroundWorker.describeMemory(footprint);
 }
\ No newline at end of file
@@ -5,8 +5,16 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/BackgroundWorker.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/DelayLine.h"
+#include "../DSP/ParameterRamp.h"
 
-class ReverbProcessor : public juce::AudioProcessor
+class ReverbProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     ReverbProcessor();
@@ -20,7 +28,11 @@ public:
     
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
     
     // Program/State
     const juce::String getName() const override { return "HyperPrism Reimagined Reverb"; }
@@ -50,27 +62,35 @@ public:
     static const juce::String WIDTH_ID;
     static const juce::String LOW_CUT_ID;
     static const juce::String HIGH_CUT_ID;
+    static const juce::String BACKGROUND_ID;
+
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
 
 private:
     // Parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
     // Audio processing
+    void renderBlock(juce::AudioBuffer<float>& buffer);
     void processReverb(juce::AudioBuffer<float>& buffer);
-    void updateFilters();
     
     // State
     juce::AudioProcessorValueTreeState valueTreeState;
     
     // DSP components
     juce::Reverb reverb;
-    juce::IIRFilter leftLowCut, rightLowCut;
-    juce::IIRFilter leftHighCut, rightHighCut;
+    HyperPrismDSP::Biquad leftLowCut, rightLowCut;
+    HyperPrismDSP::Biquad leftHighCut, rightHighCut;
+
+    // Cut filter coefficients, computed off the audio thread
+    HyperPrismCoefficients::Cache<HyperPrismCoefficients::CutFilters> cutFilters;
     
     // Pre-delay
-    juce::AudioBuffer<float> preDelayBuffer;
-    int preDelayWriteIndex = 0;
-    int maxPreDelayInSamples = 0;
+    HyperPrismDSP::DelayLine leftPreDelay, rightPreDelay;
     
     // Cached parameters
     std::atomic<float>* bypassParam = nullptr;
@@ -84,9 +104,18 @@ private:
     
     // Processing state
     double currentSampleRate = 44100.0;
-    float previousFilterFreq = -1.0f;
 
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    // Declared last: its thread calls renderBlock until it is destroyed
+    HyperPrismBackground::Worker backgroundWorker;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "RingModulatorEditor.h"
 
+namespace HyperPrismRingModulatorUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -198,6 +200,7 @@ void RingModulatorMeter::paint(juce::Graphics& g)
 
 void RingModulatorMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("RingModulatorMeter::timerCallback");
     // Generate sample waveforms for visualization
     // In a real implementation, these would come from the processor
     
@@ -225,9 +228,10 @@ void RingModulatorMeter::timerCallback()
 // RingModulatorEditor Implementation
 //==============================================================================
 RingModulatorEditor::RingModulatorEditor(RingModulatorProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), ringModulatorMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), ringModulatorMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments (using placeholder IDs)
     xParameterIDs.add("carrier_freq");
@@ -360,6 +364,7 @@ RingModulatorEditor::~RingModulatorEditor()
 
 void RingModulatorEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("RingModulatorEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -395,7 +400,7 @@ void RingModulatorEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -688,4 +693,6 @@ void RingModulatorEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismRingModulatorUI
\ No newline at end of file
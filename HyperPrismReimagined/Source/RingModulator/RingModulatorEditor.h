@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "RingModulatorProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismRingModulatorUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -154,5 +157,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RingModulatorEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismRingModulatorUI
+
+using HyperPrismRingModulatorUI::RingModulatorEditor;
\ No newline at end of file
@@ -1,69 +1,49 @@
 #include "RingModulatorProcessor.h"
-#include "RingModulatorEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "RingModulatorEditor.h"
+#endif
+
+namespace
+{
+    using Param = RingModulatorProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        floatParameter(Param::carrierFreq, "carrier_freq", "Carrier Frequency", 1.0f, 8000.0f, 0.1f, 0.5f, 440.0f),
+        floatParameter(Param::modulatorFreq, "modulator_freq", "Modulator Frequency", 0.1f, 1000.0f, 0.01f, 0.5f, 5.0f),
+        choiceParameter(Param::carrierWaveform, "carrier_waveform", "Carrier Waveform", "Sine|Triangle|Square|Saw", 0),
+        choiceParameter(Param::modulatorWaveform, "modulator_waveform", "Modulator Waveform", "Sine|Triangle|Square|Saw", 0),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f),
+        boolParameter(Param::bypass, "bypass", "Bypass", false)
+    }}};
+
+    static_assert(parameterTable.isValid(), "RingModulator parameter table out of step with RingModulatorProcessor::Param");
+}
 
 RingModulatorProcessor::RingModulatorProcessor()
     : AudioProcessor(BusesProperties()
                     .withInput("Input", juce::AudioChannelSet::stereo(), true)
                     .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      apvts(*this, nullptr, "Parameters", createParameterLayout())
+      apvts(*this, nullptr, "Parameters", HyperPrismParameters::createLayout(parameterTable)),
+      parameterValues(apvts, parameterTable)
 {
-    bypassParam = apvts.getRawParameterValue("bypass");
 }
 
 RingModulatorProcessor::~RingModulatorProcessor()
 {
 }
 
-juce::AudioProcessorValueTreeState::ParameterLayout RingModulatorProcessor::createParameterLayout()
-{
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
-
-    // Carrier Frequency (1 Hz to 8000 Hz)
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "carrier_freq",
-        "Carrier Frequency",
-        juce::NormalisableRange<float>(1.0f, 8000.0f, 0.1f, 0.5f),
-        440.0f));
-
-    // Modulator Frequency (0.1 Hz to 1000 Hz)
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "modulator_freq",
-        "Modulator Frequency",
-        juce::NormalisableRange<float>(0.1f, 1000.0f, 0.01f, 0.5f),
-        5.0f));
-
-    // Carrier Waveform (0: Sine, 1: Triangle, 2: Square, 3: Saw)
-    params.push_back(std::make_unique<juce::AudioParameterChoice>(
-        "carrier_waveform",
-        "Carrier Waveform",
-        juce::StringArray{"Sine", "Triangle", "Square", "Saw"},
-        0));
-
-    // Modulator Waveform (0: Sine, 1: Triangle, 2: Square, 3: Saw)
-    params.push_back(std::make_unique<juce::AudioParameterChoice>(
-        "modulator_waveform",
-        "Modulator Waveform",
-        juce::StringArray{"Sine", "Triangle", "Square", "Saw"},
-        0));
-
-    // Mix (0-100%)
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "mix",
-        "Mix",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f),
-        50.0f));
-
-    params.push_back(std::make_unique<juce::AudioParameterBool>(
-        "bypass", "Bypass", false));
-
-    return { params.begin(), params.end() };
-}
-
 void RingModulatorProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
+
     // Reset phases
     carrierPhase = 0.0f;
     modulatorPhase = 0.0f;
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    mixRamp.prepare(sampleRate, 0.005, scratchCapacity); // 5ms
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
 }
 
 void RingModulatorProcessor::releaseResources()
@@ -114,9 +94,16 @@ float RingModulatorProcessor::generateWaveform(float phase, int waveformType)
 
 void RingModulatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("RingModulator::processBlock");
     juce::ScopedNoDenormals noDenormals;
 
-    if (bypassParam->load() > 0.5f)
+    const auto values = parameterValues.snapshot();
+
+    if (values.isOn(Param::bypass))
         return;
 
     const int numSamples = buffer.getNumSamples();
@@ -124,12 +111,12 @@ void RingModulatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     const float sampleRate = static_cast<float>(getSampleRate());
 
     // Get parameter values
-    const float carrierFreq = apvts.getRawParameterValue("carrier_freq")->load();
-    const float modulatorFreq = apvts.getRawParameterValue("modulator_freq")->load();
-    const int carrierWaveform = static_cast<int>(apvts.getRawParameterValue("carrier_waveform")->load());
-    const int modulatorWaveform = static_cast<int>(apvts.getRawParameterValue("modulator_waveform")->load());
-    const float mixPercent = apvts.getRawParameterValue("mix")->load();
-    const float mix = mixPercent * 0.01f;
+    const float carrierFreq = values[Param::carrierFreq];
+    const float modulatorFreq = values[Param::modulatorFreq];
+    const int carrierWaveform = values.getIndex(Param::carrierWaveform);
+    const int modulatorWaveform = values.getIndex(Param::modulatorWaveform);
+    mixRamp.setTarget(values[Param::mix] * 0.01f);
+    const auto* mixes = mixRamp.process(numSamples);
 
     // Calculate phase increments
     const float carrierPhaseInc = (carrierFreq * juce::MathConstants<float>::twoPi) / sampleRate;
@@ -155,7 +142,7 @@ void RingModulatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
 
             const float ringModSignal = channelData[sample] * carrier * (1.0f + modulator) * 0.5f;
 
-            channelData[sample] = (1.0f - mix) * channelData[sample] + mix * ringModSignal;
+            channelData[sample] = (1.0f - mixes[sample]) * channelData[sample] + mixes[sample] * ringModSignal;
 
             localCarrierPhase += carrierPhaseInc;
             localModulatorPhase += modulatorPhaseInc;
@@ -174,12 +161,20 @@ void RingModulatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
 
 bool RingModulatorProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* RingModulatorProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new RingModulatorEditor(*this);
+   #endif
 }
 
 void RingModulatorProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -197,6 +192,12 @@ void RingModulatorProcessor::setStateInformation(const void* data, int sizeInByt
             apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void RingModulatorProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes());
+}
+
 const juce::String RingModulatorProcessor::getName() const
 {
     return "HyperPrism Reimagined Ring Modulator";
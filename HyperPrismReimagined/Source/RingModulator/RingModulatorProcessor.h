@@ -1,8 +1,14 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-class RingModulatorProcessor : public juce::AudioProcessor
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/ParameterTable.h"
+#include "../DSP/ParameterRamp.h"
+
+class RingModulatorProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     RingModulatorProcessor();
@@ -36,19 +42,35 @@ public:
 
     juce::AudioProcessorValueTreeState& getAPVTS() { return apvts; }
 
+    // Parameters in layout order, indexing the table in RingModulatorProcessor.cpp
+    enum class Param { carrierFreq, modulatorFreq, carrierWaveform, modulatorWaveform, mix, bypass, count };
+
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     juce::AudioProcessorValueTreeState apvts;
-    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    HyperPrismParameters::Values<Param> parameterValues;
 
     // Oscillator phases
     float carrierPhase = 0.0f;
     float modulatorPhase = 0.0f;
 
-    // Bypass
-    std::atomic<float>* bypassParam = nullptr;
+    // Mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
 
     // Helper functions for waveform generation
     float generateWaveform(float phase, int waveformType);
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    // Kernel micro-benchmarks (Source/Bench/KernelBenchmark.cpp)
+    friend struct HyperPrismKernelAccess;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RingModulatorProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,299 @@
+//==============================================================================
+// HyperPrism Reimagined - Background Worker
+//==============================================================================
+
+#include "BackgroundWorker.h"
+
+namespace HyperPrismBackground
+{
+    //==============================================================================
+    void Worker::AudioFifo::setSize(int numChannelsToUse, int capacity)
+    {
+        // AbstractFifo keeps one slot free to tell full from empty
+        fifo.setTotalSize(capacity + 1);
+        fifo.reset();
+
+        storage.setSize(numChannelsToUse, capacity + 1);
+        storage.clear();
+        channels = storage.getArrayOfWritePointers();
+        numChannels = numChannelsToUse;
+    }
+
+    int Worker::AudioFifo::write(const juce::AudioBuffer<float>& source, int startSample, int numSamples) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+        for (int channel = 0; channel < juce::jmin(numChannels, source.getNumChannels()); ++channel)
+        {
+            const auto* data = source.getReadPointer(channel, startSample);
+            juce::FloatVectorOperations::copy(channels[channel] + start1, data, size1);
+            juce::FloatVectorOperations::copy(channels[channel] + start2, data + size1, size2);
+        }
+
+        fifo.finishedWrite(size1 + size2);
+        return size1 + size2;
+    }
+
+    int Worker::AudioFifo::writeSilence(int numSamples) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            juce::FloatVectorOperations::clear(channels[channel] + start1, size1);
+            juce::FloatVectorOperations::clear(channels[channel] + start2, size2);
+        }
+
+        fifo.finishedWrite(size1 + size2);
+        return size1 + size2;
+    }
+
+    int Worker::AudioFifo::read(juce::AudioBuffer<float>& destination, int startSample, int numSamples) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(numSamples, start1, size1, start2, size2);
+
+        for (int channel = 0; channel < juce::jmin(numChannels, destination.getNumChannels()); ++channel)
+        {
+            auto* data = destination.getWritePointer(channel, startSample);
+            juce::FloatVectorOperations::copy(data, channels[channel] + start1, size1);
+            juce::FloatVectorOperations::copy(data + size1, channels[channel] + start2, size2);
+        }
+
+        fifo.finishedRead(size1 + size2);
+        return size1 + size2;
+    }
+
+    void Worker::AudioFifo::discard(int numSamples) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(numSamples, start1, size1, start2, size2);
+        fifo.finishedRead(size1 + size2);
+    }
+
+    //==============================================================================
+    Worker::WorkerThread::WorkerThread(Worker& owner)
+        : juce::Thread(owner.processor.getName() + " worker"), worker(owner)
+    {
+    }
+
+    Worker::WorkerThread::~WorkerThread()
+    {
+        // The post after the flag lets a thread asleep in wait() see it
+        signalThreadShouldExit();
+        wakeSemaphore.signal();
+        stopThread(1000);
+    }
+
+    void Worker::WorkerThread::run()
+    {
+        for (;;)
+        {
+            // Sleeps until the audio thread queues a block or the owner
+            // asks the thread to exit
+            wakeSemaphore.wait();
+
+            if (threadShouldExit())
+                return;
+
+            worker.renderQueuedInput();
+        }
+    }
+
+    //==============================================================================
+    Worker::Worker(juce::AudioProcessor& owner, juce::AudioProcessorValueTreeState& state,
+                   const juce::String& parameterID, RenderFunction renderFunction)
+        : processor(owner), valueTreeState(state), modeParameterID(parameterID),
+          render(std::move(renderFunction))
+    {
+        valueTreeState.addParameterListener(modeParameterID, this);
+    }
+
+    Worker::~Worker()
+    {
+        valueTreeState.removeParameterListener(modeParameterID, this);
+        release();
+    }
+
+    std::unique_ptr<juce::AudioParameterBool> Worker::createParameter(const juce::String& parameterID)
+    {
+        // Switching adds or removes latency, which is no use to automate
+        return std::make_unique<juce::AudioParameterBool>(
+            parameterID, "Background Thread", false,
+            juce::AudioParameterBoolAttributes().withAutomatable(false));
+    }
+
+    void Worker::prepare(double sampleRate, int blockSizeToUse, int numChannels)
+    {
+        release();
+
+        const auto enabled = valueTreeState.getRawParameterValue(modeParameterID)->load() > 0.5f;
+
+        if (enabled && ! processor.isNonRealtime() && blockSizeToUse > 0 && numChannels > 0)
+        {
+            blockSize = blockSizeToUse;
+
+            // Room for the block of latency, a block being written and two of slack
+            input.setSize(numChannels, 4 * blockSize);
+            output.setSize(numChannels, 4 * blockSize);
+            output.writeSilence(blockSize);
+            workBuffer.setSize(numChannels, blockSize);
+            firstGap = numGaps = 0;
+            position = 0;
+            samplesToDrop = 0;
+
+            thread = std::make_unique<WorkerThread>(*this);
+
+            const auto options = juce::Thread::RealtimeOptions{}
+                                     .withApproximateAudioProcessingTime(blockSize, sampleRate);
+
+            // Fall back to a normal thread where real-time scheduling is refused
+            if (! thread->startRealtimeThread(options))
+                thread->startThread(juce::Thread::Priority::highest);
+
+            active.store(true, std::memory_order_relaxed);
+        }
+
+        processor.setLatencySamples(isActive() ? blockSize : 0);
+    }
+
+    void Worker::release()
+    {
+        active.store(false, std::memory_order_relaxed);
+        thread.reset();
+    }
+
+    void Worker::parameterChanged(const juce::String&, float newValue)
+    {
+        if ((newValue > 0.5f) != isActive() && ! processor.isNonRealtime())
+            processor.updateHostDisplay(juce::AudioProcessor::ChangeDetails().withLatencyChanged(true));
+    }
+
+    //==============================================================================
+    void Worker::process(juce::AudioBuffer<float>& buffer) noexcept
+    {
+        if (thread == nullptr)
+        {
+            render(buffer);
+            return;
+        }
+
+        const auto numSamples = buffer.getNumSamples();
+
+        for (int start = 0; start < numSamples; start += blockSize)
+        {
+            const auto count = juce::jmin(blockSize, numSamples - start);
+            const auto blockPosition = position + start;
+
+            // Input that finds the FIFO full never comes back. Its output would
+            // have played a block later, so that is where the silence goes;
+            // the output already queued ahead of it was rendered correctly.
+            const auto written = input.write(buffer, start, count);
+
+            if (written < count)
+                addGap(blockPosition + written + blockSize, count - written);
+
+            thread->wake();
+
+            for (int sample = start; sample < start + count;)
+            {
+                const auto samplePosition = position + sample;
+                auto length = start + count - sample;
+
+                if (numGaps > 0)
+                {
+                    auto& gap = gaps[static_cast<size_t>(firstGap)];
+                    const auto untilGap = gap.start - samplePosition;
+
+                    if (untilGap <= 0)
+                    {
+                        // Inside a gap: silence, and nothing taken from the FIFO
+                        const auto silence = static_cast<int>(juce::jmin(static_cast<juce::int64>(length),
+                                                                         gap.start + gap.length - samplePosition));
+                        buffer.clear(sample, silence);
+                        sample += silence;
+
+                        if (samplePosition + silence >= gap.start + gap.length)
+                        {
+                            firstGap = (firstGap + 1) % maxGaps;
+                            --numGaps;
+                        }
+
+                        continue;
+                    }
+
+                    length = static_cast<int>(juce::jmin(static_cast<juce::int64>(length), untilGap));
+                }
+
+                if (samplesToDrop > 0)
+                {
+                    const auto late = juce::jmin(samplesToDrop, output.getNumReady());
+                    output.discard(late);
+                    samplesToDrop -= late;
+                }
+
+                const auto read = output.read(buffer, sample, length);
+
+                if (read < length)
+                {
+                    buffer.clear(sample + read, length - read);
+                    samplesToDrop += length - read;
+                }
+
+                sample += length;
+            }
+        }
+
+        position += numSamples;
+    }
+
+    void Worker::addGap(juce::int64 start, int length) noexcept
+    {
+        if (numGaps > 0)
+        {
+            auto& last = gaps[static_cast<size_t>((firstGap + numGaps - 1) % maxGaps)];
+
+            if (last.start + last.length == start)
+            {
+                last.length += length;
+                return;
+            }
+        }
+
+        // Only reachable with many short host blocks each losing part of
+        // its input; the output after this gap then runs early by its length
+        if (numGaps == maxGaps)
+        {
+            jassertfalse;
+            return;
+        }
+
+        gaps[static_cast<size_t>((firstGap + numGaps) % maxGaps)] = { start, length };
+        ++numGaps;
+    }
+
+    void Worker::renderQueuedInput()
+    {
+        for (;;)
+        {
+            const auto numSamples = juce::jmin(blockSize, input.getNumReady(), output.getFreeSpace());
+
+            if (numSamples <= 0)
+                return;
+
+            juce::AudioBuffer<float> block(workBuffer.getArrayOfWritePointers(), workBuffer.getNumChannels(), numSamples);
+            input.read(block, 0, numSamples);
+            render(block);
+            output.write(block, 0, numSamples);
+        }
+    }
+
+    //==============================================================================
+    void Worker::describeMemory(HyperPrismMemory::Footprint& footprint) const
+    {
+        footprint.add("background FIFOs", input.getBytes() + output.getBytes());
+        footprint.add("background FIFOs", workBuffer);
+    }
+}
@@ -0,0 +1,135 @@
+//==============================================================================
+// HyperPrism Reimagined - Background Worker
+// Opt-in mode for the heaviest effects: their DSP runs on a dedicated
+// real-time thread fed through lock-free FIFOs, and the host's audio thread
+// only copies audio in and out, one prepared block later
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MemoryFootprint.h"
+#include "RealtimeSemaphore.h"
+
+namespace HyperPrismBackground
+{
+    //==============================================================================
+    // The mode switch is a non-automatable toggle in the owner's parameter layout.
+    // It takes effect when the host next prepares the plugin; turning it over
+    // reports a latency change, which prompts hosts to do so.
+    class Worker : private juce::AudioProcessorValueTreeState::Listener
+    {
+    public:
+        // Renders at most the prepared block size; called on the worker thread
+        // while the mode is active and on the audio thread otherwise
+        using RenderFunction = std::function<void(juce::AudioBuffer<float>&)>;
+
+        Worker(juce::AudioProcessor& owner, juce::AudioProcessorValueTreeState& state,
+               const juce::String& parameterID, RenderFunction renderFunction);
+        ~Worker() override;
+
+        static std::unique_ptr<juce::AudioParameterBool> createParameter(const juce::String& parameterID);
+
+        // Call first in prepareToPlay, so a previous thread has stopped before
+        // the DSP is prepared again. Starts the thread if the mode is on and the
+        // host is playing in real time (offline renders stay synchronous so a
+        // bounce never waits on, or outruns, the worker), then reports the
+        // latency: one block while active, none otherwise.
+        void prepare(double sampleRate, int blockSize, int numChannels);
+
+        // Call from releaseResources
+        void release();
+
+        bool isActive() const noexcept { return active.load(std::memory_order_relaxed); }
+
+        // Runs the render function here when inactive. Otherwise queues the
+        // block's input and fills it with output rendered a block earlier, and
+        // never blocks: if the worker falls behind, the late samples become
+        // silence and are dropped on arrival, and input that finds the queue
+        // full plays as silence one block later, where its output would have
+        // been. Either way the latency stays constant.
+        void process(juce::AudioBuffer<float>& buffer) noexcept;
+
+        void describeMemory(HyperPrismMemory::Footprint& footprint) const;
+
+    private:
+        //==============================================================================
+        // Single-producer, single-consumer ring of multichannel audio
+        class AudioFifo
+        {
+        public:
+            void setSize(int numChannels, int capacity);
+            int getNumReady() const noexcept    { return fifo.getNumReady(); }
+            int getFreeSpace() const noexcept   { return fifo.getFreeSpace(); }
+
+            // Each returns the samples actually moved
+            int write(const juce::AudioBuffer<float>& source, int startSample, int numSamples) noexcept;
+            int writeSilence(int numSamples) noexcept;
+            int read(juce::AudioBuffer<float>& destination, int startSample, int numSamples) noexcept;
+            void discard(int numSamples) noexcept;
+
+            size_t getBytes() const { return HyperPrismMemory::bytesOf(storage); }
+
+        private:
+            juce::AbstractFifo fifo { 1 };
+            juce::AudioBuffer<float> storage;
+
+            // Taken once in setSize: the buffer's own accessors update its
+            // isClear flag, which both threads would then race on
+            float* const* channels = nullptr;
+            int numChannels = 0;
+        };
+
+        class WorkerThread : public juce::Thread
+        {
+        public:
+            explicit WorkerThread(Worker& owner);
+            ~WorkerThread() override;
+
+            // Called by the audio thread once per block; never takes a lock
+            void wake() noexcept { wakeSemaphore.signal(); }
+
+        private:
+            void run() override;
+
+            Worker& worker;
+            HyperPrismThreads::Semaphore wakeSemaphore;
+        };
+
+        void parameterChanged(const juce::String& parameterID, float newValue) override;
+        void renderQueuedInput();
+
+        juce::AudioProcessor& processor;
+        juce::AudioProcessorValueTreeState& valueTreeState;
+        const juce::String modeParameterID;
+        const RenderFunction render;
+
+        AudioFifo input, output;
+        juce::AudioBuffer<float> workBuffer;    // Worker thread only
+        int blockSize = 0;
+
+        // Output positions whose input was lost to a full queue, in samples
+        // since prepare. Each block loses at most its tail, so the gaps still
+        // ahead span a block of latency and a few fit.
+        struct Gap
+        {
+            juce::int64 start = 0;
+            int length = 0;
+        };
+
+        static constexpr int maxGaps = 8;
+
+        void addGap(juce::int64 start, int length) noexcept;
+
+        // Audio thread only
+        std::array<Gap, maxGaps> gaps;
+        int firstGap = 0, numGaps = 0;
+        juce::int64 position = 0;               // Samples processed since prepare
+        int samplesToDrop = 0;                  // Late samples still to arrive, already played as silence
+
+        std::unique_ptr<WorkerThread> thread;
+        std::atomic<bool> active { false };
+
+        JUCE_DECLARE_NON_COPYABLE(Worker)
+    };
+}
@@ -0,0 +1,114 @@
+//==============================================================================
+// HyperPrism Reimagined - Coefficient Cache Implementation
+//==============================================================================
+
+#include "CoefficientCache.h"
+
+namespace HyperPrismCoefficients
+{
+    //==============================================================================
+    Service::Service()
+        : juce::Thread("HyperPrism coefficients")
+    {
+        startThread(juce::Thread::Priority::low);
+    }
+
+    Service::~Service()
+    {
+        stopThread(1000);
+    }
+
+    void Service::add(CacheBase& cache)
+    {
+        const juce::ScopedLock sl(lock);
+        caches.addIfNotAlreadyThere(&cache);
+    }
+
+    // Once this returns the thread is not inside the cache, and never will be
+    void Service::remove(CacheBase& cache)
+    {
+        const juce::ScopedLock sl(lock);
+        caches.removeFirstMatchingValue(&cache);
+    }
+
+    void Service::run()
+    {
+        while (! threadShouldExit())
+        {
+            {
+                const juce::ScopedLock sl(lock);
+
+                for (auto* cache : caches)
+                    cache->refreshIfDirty();
+            }
+
+            wait(pollIntervalMs);
+        }
+    }
+
+    //==============================================================================
+    CacheBase::CacheBase(juce::AudioProcessorValueTreeState& state, const juce::StringArray& parameterIDs)
+        : valueTreeState(state), parameters(parameterIDs)
+    {
+        for (const auto& parameterID : parameters)
+            valueTreeState.addParameterListener(parameterID, this);
+    }
+
+    CacheBase::~CacheBase()
+    {
+        detach();
+
+        for (const auto& parameterID : parameters)
+            valueTreeState.removeParameterListener(parameterID, this);
+    }
+
+    void CacheBase::detach()
+    {
+        if (attached)
+        {
+            (*service)->remove(*this);
+            attached = false;
+        }
+    }
+
+    void CacheBase::prepareBase(double sampleRate)
+    {
+        {
+            const juce::ScopedLock sl(writeLock);
+            currentSampleRate = sampleRate;
+        }
+
+        dirty.store(true, std::memory_order_release);
+        refreshIfDirty();
+
+        if (! attached)
+        {
+            if (! service.has_value())
+                service.emplace();
+
+            (*service)->add(*this);
+            attached = true;
+        }
+    }
+
+    void CacheBase::refreshIfDirty()
+    {
+        if (! dirty.load(std::memory_order_acquire))
+            return;
+
+        const juce::ScopedLock sl(writeLock);
+
+        // Cleared before computing: a change that lands mid-computation
+        // marks the cache again and is picked up on the next pass
+        if (currentSampleRate <= 0.0 || ! dirty.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        refresh(currentSampleRate);
+    }
+
+    void CacheBase::parameterChanged(const juce::String&, float)
+    {
+        // May be called on the audio thread, by host automation
+        dirty.store(true, std::memory_order_release);
+    }
+}
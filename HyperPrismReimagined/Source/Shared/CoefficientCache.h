@@ -0,0 +1,193 @@
+//==============================================================================
+// HyperPrism Reimagined - Coefficient Cache
+// Filter coefficients computed off the audio thread when their parameters
+// move, and handed to processBlock through preallocated slots swapped by an
+// atomic index, so the audio callback never designs a filter
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include "../DSP/Biquad.h"
+
+namespace HyperPrismCoefficients
+{
+    // Samples over which a filter glides to newly published coefficients
+    constexpr int rampSamples = 64;
+
+    // How often the shared thread looks for parameters that have moved
+    constexpr int pollIntervalMs = 5;
+
+    inline HyperPrismDSP::BiquadCoefficients fromJuce(const juce::IIRCoefficients& source) noexcept
+    {
+        const auto* c = source.coefficients;
+        return { c[0], c[1], c[2], c[3], c[4] };
+    }
+
+    // Second-order sections only: five raw values, already normalised
+    inline HyperPrismDSP::BiquadCoefficients fromJuce(const juce::dsp::IIR::Coefficients<float>& source) noexcept
+    {
+        jassert(source.getFilterOrder() == 2);
+        const auto* c = source.getRawCoefficients();
+        return { c[0], c[1], c[2], c[3], c[4] };
+    }
+
+    // The low and high cut pair the modulation and space effects put on
+    // their wet signal
+    struct CutFilters
+    {
+        HyperPrismDSP::BiquadCoefficients lowCut;
+        HyperPrismDSP::BiquadCoefficients highCut;
+    };
+
+    inline CutFilters makeCutFilters(double sampleRate, float lowCutFrequency, float highCutFrequency)
+    {
+        return { fromJuce(juce::IIRCoefficients::makeHighPass(sampleRate, lowCutFrequency, 0.707f)),
+                 fromJuce(juce::IIRCoefficients::makeLowPass(sampleRate, highCutFrequency, 0.707f)) };
+    }
+
+    class CacheBase;
+
+    //==============================================================================
+    // One low-priority thread per process, shared by every cache, that refreshes
+    // the dirty ones every pollIntervalMs. Polling keeps the audio thread's
+    // part to an atomic store: nothing it calls can block.
+    class Service : private juce::Thread
+    {
+    public:
+        Service();
+        ~Service() override;
+
+        void add(CacheBase& cache);
+        void remove(CacheBase& cache);
+
+    private:
+        void run() override;
+
+        juce::CriticalSection lock;
+        juce::Array<CacheBase*> caches;
+
+        JUCE_DECLARE_NON_COPYABLE(Service)
+    };
+
+    //==============================================================================
+    // The untyped half of a Cache: the parameter listener that marks it dirty,
+    // and the refresh the shared thread calls
+    class CacheBase : private juce::AudioProcessorValueTreeState::Listener
+    {
+    public:
+        CacheBase(juce::AudioProcessorValueTreeState& state, const juce::StringArray& parameterIDs);
+        ~CacheBase() override;
+
+        // Recomputes if a parameter moved since the last computation. Any
+        // thread but a real-time one: it designs filters and takes a lock.
+        void refreshIfDirty();
+
+    protected:
+        // Computes synchronously for a new sample rate; the audio must be stopped.
+        // The first call registers with the shared thread (starting it if this
+        // is the first cache prepared), so a processor that is constructed but
+        // never played, like an idle effect in the Suite, costs it nothing.
+        void prepareBase(double sampleRate);
+
+        // Stops the shared thread calling refresh; derived destructors call
+        // this first, while the compute function can still run safely
+        void detach();
+
+        // Computes the set into the free slot and publishes it
+        virtual void refresh(double sampleRate) = 0;
+
+    private:
+        void parameterChanged(const juce::String& parameterID, float newValue) override;
+
+        juce::AudioProcessorValueTreeState& valueTreeState;
+        const juce::StringArray parameters;
+        std::optional<juce::SharedResourcePointer<Service>> service;     // From the first prepare
+        bool attached = false;
+
+        juce::CriticalSection writeLock;        // One writer at a time; never taken in real time
+        double currentSampleRate = 0.0;         // Guarded by writeLock; 0 until prepared
+        std::atomic<bool> dirty { false };
+
+        JUCE_DECLARE_NON_COPYABLE(CacheBase)
+    };
+
+    //==============================================================================
+    // A trivially copyable set of coefficients for one processor, recomputed
+    // by the compute function whenever one of the listed parameters changes:
+    //
+    //     struct CutFilters { HyperPrismDSP::BiquadCoefficients lowCut, highCut; };
+    //
+    //     HyperPrismCoefficients::Cache<CutFilters> filterCoefficients { valueTreeState, { LOW_CUT_ID, HIGH_CUT_ID },
+    //                                                                    [this](double sampleRate) { ... } };
+    //
+    // prepareToPlay calls prepare, after which get() holds the current set.
+    // processBlock calls update once at the top and, when it returns true,
+    // glides its filters to the new get().
+    //
+    // In real time the shared thread computes, so a new set arrives within a
+    // few milliseconds. Offline renders compute in update instead, so every
+    // block of a bounce uses the parameters it was rendered with.
+    template <typename Set>
+    class Cache : public CacheBase
+    {
+    public:
+        using ComputeFunction = std::function<Set(double sampleRate)>;
+
+        Cache(juce::AudioProcessorValueTreeState& state, const juce::StringArray& parameterIDs,
+              ComputeFunction computeFunction)
+            : CacheBase(state, parameterIDs), compute(std::move(computeFunction))
+        {
+        }
+
+        ~Cache() override { detach(); }
+
+        void prepare(double sampleRate)
+        {
+            prepareBase(sampleRate);
+            update(false);
+        }
+
+        // Audio thread: takes the newest published set, if any. Returns true
+        // when get() changed.
+        bool update(bool nonRealtime)
+        {
+            if (nonRealtime)
+                refreshIfDirty();
+
+            if ((published.load(std::memory_order_acquire) & freshFlag) == 0)
+                return false;
+
+            readIndex = published.exchange(readIndex, std::memory_order_acq_rel) & indexMask;
+            return true;
+        }
+
+        const Set& get() const noexcept { return slots[static_cast<size_t>(readIndex)]; }
+
+    private:
+        static_assert(std::is_trivially_copyable<Set>::value, "Coefficient sets are copied between threads as plain data");
+
+        static constexpr int indexMask = 3;
+        static constexpr int freshFlag = 4;
+
+        // Called under the write lock
+        void refresh(double sampleRate) override
+        {
+            slots[static_cast<size_t>(writeIndex)] = compute(sampleRate);
+            writeIndex = published.exchange(writeIndex | freshFlag, std::memory_order_acq_rel) & indexMask;
+        }
+
+        const ComputeFunction compute;
+
+        // Triple buffer: the reader's slot, the writer's slot, and the last
+        // one published, which either side swaps for its own
+        std::array<Set, 3> slots {};
+        int readIndex = 0;                      // Audio thread
+        int writeIndex = 1;                     // Writer, under the write lock
+        std::atomic<int> published { 2 };       // Slot index, plus freshFlag until the reader takes it
+    };
+}
@@ -0,0 +1,109 @@
+//==============================================================================
+// HyperPrism Reimagined - Effect Registry Implementation
+//==============================================================================
+
+#include "EffectRegistry.h"
+
+#include "../AutoPan/AutoPanProcessor.h"
+#include "../BandPass/BandPassProcessor.h"
+#include "../BandReject/BandRejectProcessor.h"
+#include "../BassMaximiser/BassMaximiserProcessor.h"
+#include "../Chorus/ChorusProcessor.h"
+#include "../Compressor/CompressorProcessor.h"
+#include "../Delay/DelayProcessor.h"
+#include "../Echo/EchoProcessor.h"
+#include "../Flanger/FlangerProcessor.h"
+#include "../FrequencyShifter/FrequencyShifterProcessor.h"
+#include "../HarmonicExciter/HarmonicExciterProcessor.h"
+#include "../HighPass/HighPassProcessor.h"
+#include "../HyperPhaser/HyperPhaserProcessor.h"
+#include "../Limiter/LimiterProcessor.h"
+#include "../LowPass/LowPassProcessor.h"
+#include "../MSMatrix/MSMatrixProcessor.h"
+#include "../MoreStereo/MoreStereoProcessor.h"
+#include "../MultiDelay/MultiDelayProcessor.h"
+#include "../NoiseGate/NoiseGateProcessor.h"
+#include "../Pan/PanProcessor.h"
+#include "../Phaser/PhaserProcessor.h"
+#include "../PitchChanger/PitchChangerProcessor.h"
+#include "../QuasiStereo/QuasiStereoProcessor.h"
+#include "../Reverb/ReverbProcessor.h"
+#include "../RingModulator/RingModulatorProcessor.h"
+#include "../SingleDelay/SingleDelayProcessor.h"
+#include "../SonicDecimator/SonicDecimatorProcessor.h"
+#include "../StereoDynamics/StereoDynamicsProcessor.h"
+#include "../Tremolo/TremoloProcessor.h"
+#include "../TubeTapeSaturation/TubeTapeSaturationProcessor.h"
+#include "../Vibrato/VibratoProcessor.h"
+#include "../Vocoder/VocoderProcessor.h"
+
+namespace HyperPrismRegistry
+{
+    namespace
+    {
+        template <typename ProcessorType>
+        EffectInfo makeEntry(const char* name, const char* pluginCode, bool isLightweightStereo = false)
+        {
+            return { name, pluginCode, [] { return std::unique_ptr<juce::AudioProcessor>(new ProcessorType()); },
+                     isLightweightStereo };
+        }
+    }
+
+    const std::vector<EffectInfo>& getAllEffects()
+    {
+        static const std::vector<EffectInfo> effects
+        {
+            makeEntry<DelayProcessor>("Delay", "Hdly"),
+            makeEntry<ReverbProcessor>("Reverb", "Hrvb"),
+            makeEntry<ChorusProcessor>("Chorus", "Hchr"),
+            makeEntry<FlangerProcessor>("Flanger", "Hflg"),
+            makeEntry<HighPassProcessor>("HighPass", "Hhpf"),
+            makeEntry<LowPassProcessor>("LowPass", "Hlpf"),
+            makeEntry<BandPassProcessor>("BandPass", "Hbpf"),
+            makeEntry<BandRejectProcessor>("BandReject", "Hbrf"),
+            makeEntry<TremoloProcessor>("Tremolo", "Htrm"),
+            makeEntry<VibratoProcessor>("Vibrato", "Hvib"),
+            makeEntry<PhaserProcessor>("Phaser", "Hphs"),
+            makeEntry<NoiseGateProcessor>("NoiseGate", "Hngt"),
+            makeEntry<CompressorProcessor>("Compressor", "Hcmp"),
+            makeEntry<LimiterProcessor>("Limiter", "Hlmt"),
+            makeEntry<TubeTapeSaturationProcessor>("TubeTapeSaturation", "Hsat"),
+            makeEntry<HarmonicExciterProcessor>("HarmonicExciter", "Hhex"),
+            makeEntry<BassMaximiserProcessor>("BassMaximiser", "Hbmx"),
+            makeEntry<SingleDelayProcessor>("SingleDelay", "Hsdl"),
+            makeEntry<MultiDelayProcessor>("MultiDelay", "Hmdl"),
+            makeEntry<PanProcessor>("Pan", "Hpan", true),
+            makeEntry<AutoPanProcessor>("AutoPan", "Hapn", true),
+            makeEntry<QuasiStereoProcessor>("QuasiStereo", "Hqst", true),
+            makeEntry<MoreStereoProcessor>("MoreStereo", "Hmst"),
+            makeEntry<MSMatrixProcessor>("MSMatrix", "Hmsm", true),
+            makeEntry<StereoDynamicsProcessor>("StereoDynamics", "Hsdy"),
+            makeEntry<FrequencyShifterProcessor>("FrequencyShifter", "Hfrs"),
+            makeEntry<VocoderProcessor>("Vocoder", "Hvoc"),
+            makeEntry<PitchChangerProcessor>("PitchChanger", "Hpch"),
+            makeEntry<SonicDecimatorProcessor>("SonicDecimator", "Hsdc"),
+            makeEntry<RingModulatorProcessor>("RingModulator", "Hrmd"),
+            makeEntry<HyperPhaserProcessor>("HyperPhaser", "Hhph"),
+            makeEntry<EchoProcessor>("Echo", "Hech")
+        };
+
+        return effects;
+    }
+
+    const EffectInfo* findEffect(const juce::String& name)
+    {
+        for (const auto& effect : getAllEffects())
+            if (effect.name.equalsIgnoreCase(name))
+                return &effect;
+
+        return nullptr;
+    }
+
+    std::unique_ptr<juce::AudioProcessor> createEffect(const juce::String& name)
+    {
+        if (auto* effect = findEffect(name))
+            return effect->create();
+
+        return nullptr;
+    }
+}
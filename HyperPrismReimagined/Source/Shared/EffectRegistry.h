@@ -0,0 +1,33 @@
+//==============================================================================
+// HyperPrism Reimagined - Effect Registry
+// Name -> processor factory table for targets that host several effects
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismRegistry
+{
+    struct EffectInfo
+    {
+        juce::String name;          // Short name, matches the Source/ folder (e.g. "Delay")
+        juce::String pluginCode;    // Four-character PLUGIN_CODE from CMakeLists.txt
+        std::function<std::unique_ptr<juce::AudioProcessor>()> create;
+
+        // Cheap per-sample stereo work (gain matrices, a pan LFO, Quasi Stereo's
+        // short delay and shelf) with no state that depends on the block size;
+        // the Rack runs consecutive ones tile by tile over large blocks so the
+        // buffer stays in cache between them
+        bool isLightweightStereo = false;
+    };
+
+    // All 32 effects, in the same order as CMakeLists.txt
+    const std::vector<EffectInfo>& getAllEffects();
+
+    // Case-insensitive lookup by short name; nullptr if unknown
+    const EffectInfo* findEffect(const juce::String& name);
+
+    // Convenience wrapper around findEffect()->create(); nullptr if unknown
+    std::unique_ptr<juce::AudioProcessor> createEffect(const juce::String& name);
+}
@@ -0,0 +1,208 @@
+//==============================================================================
+// HyperPrism Reimagined - Trace Instrumentation Implementation
+//==============================================================================
+
+#include "HyperPrismTrace.h"
+
+#if HYPERPRISM_TRACE
+
+namespace HyperPrismTrace
+{
+    namespace
+    {
+        struct Event
+        {
+            const char* name = nullptr;
+            juce::int64 startTicks = 0;
+            juce::int64 endTicks = 0;
+        };
+
+        // Single producer (the owning thread), single consumer (the writer)
+        class ThreadBuffer
+        {
+        public:
+            static constexpr juce::uint32 capacity = 16384;   // Power of two
+
+            ThreadBuffer(int index, const juce::String& name)
+                : threadIndex(index), threadName(name)
+            {
+            }
+
+            void push(const Event& event) noexcept
+            {
+                const auto write = writeIndex.load(std::memory_order_relaxed);
+
+                if (write - readIndex.load(std::memory_order_acquire) >= capacity)
+                {
+                    numDropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                events[write & (capacity - 1)] = event;
+                writeIndex.store(write + 1, std::memory_order_release);
+            }
+
+            template <typename Callback>
+            void drain(Callback&& callback)
+            {
+                auto read = readIndex.load(std::memory_order_relaxed);
+                const auto write = writeIndex.load(std::memory_order_acquire);
+
+                for (; read != write; ++read)
+                    callback(events[read & (capacity - 1)]);
+
+                readIndex.store(read, std::memory_order_release);
+            }
+
+            const int threadIndex;
+            const juce::String threadName;
+            std::atomic<int> numDropped { 0 };
+
+        private:
+            Event events[capacity];
+            std::atomic<juce::uint32> writeIndex { 0 };
+            std::atomic<juce::uint32> readIndex { 0 };
+        };
+
+        // Buffers live for the rest of the process so a writer can still drain
+        // threads that have already exited
+        struct Registry
+        {
+            juce::SpinLock lock;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        };
+
+        Registry& getRegistry()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        ThreadBuffer* registerCurrentThread()
+        {
+            juce::String name;
+
+            if (juce::MessageManager::existsAndIsCurrentThread())
+                name = "Message thread";
+            else if (auto* thread = juce::Thread::getCurrentThread())
+                name = thread->getThreadName();
+
+            auto& registry = getRegistry();
+            const juce::SpinLock::ScopedLockType scopedLock(registry.lock);
+
+            const auto index = static_cast<int>(registry.buffers.size()) + 1;
+            if (name.isEmpty())
+                name = "Host thread " + juce::String(index);
+
+            registry.buffers.push_back(std::make_unique<ThreadBuffer>(index, name));
+            return registry.buffers.back().get();
+        }
+
+        thread_local ThreadBuffer* currentThreadBuffer = nullptr;
+
+        double ticksToMicroseconds(juce::int64 ticks)
+        {
+            static const double microsecondsPerTick = 1.0e6 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+            return static_cast<double>(ticks) * microsecondsPerTick;
+        }
+    }
+
+    void record(const char* name, juce::int64 startTicks, juce::int64 endTicks) noexcept
+    {
+        if (currentThreadBuffer == nullptr)
+            currentThreadBuffer = registerCurrentThread();
+
+        currentThreadBuffer->push({ name, startTicks, endTicks });
+    }
+
+    //==============================================================================
+    Writer::Writer()
+        : juce::Thread("HyperPrism trace writer")
+    {
+        const auto path = juce::SystemStats::getEnvironmentVariable("HYPERPRISM_TRACE_FILE", {});
+
+        file = path.isNotEmpty() ? juce::File(path)
+                                 : juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                       .getChildFile("HyperPrismTrace-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S") + ".json")
+                                       .getNonexistentSibling();
+
+        stream = std::make_unique<juce::FileOutputStream>(file);
+
+        if (stream->failedToOpen())
+        {
+            DBG("HyperPrismTrace: could not open " << file.getFullPathName());
+            stream.reset();
+            return;
+        }
+
+        stream->setPosition(0);
+        stream->truncate();
+        *stream << "{\"traceEvents\":[\n";
+
+        startThread(juce::Thread::Priority::low);
+    }
+
+    Writer::~Writer()
+    {
+        if (stream == nullptr)
+            return;
+
+        stopThread(2000);
+        flush();
+
+        // Thread names and dropped-event counts as metadata
+        auto& registry = getRegistry();
+        const juce::SpinLock::ScopedLockType scopedLock(registry.lock);
+
+        for (const auto& buffer : registry.buffers)
+        {
+            *stream << (isFirstEvent ? "" : ",\n")
+                    << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                    << ",\"args\":{\"name\":" << juce::JSON::toString(buffer->threadName) << ",\"dropped\":"
+                    << buffer->numDropped.load() << "}}";
+            isFirstEvent = false;
+        }
+
+        *stream << "\n]}\n";
+        stream->flush();
+        DBG("HyperPrismTrace: wrote " << file.getFullPathName());
+    }
+
+    void Writer::run()
+    {
+        while (! threadShouldExit())
+        {
+            flush();
+            wait(100);
+        }
+    }
+
+    void Writer::flush()
+    {
+        std::vector<ThreadBuffer*> buffers;
+
+        {
+            auto& registry = getRegistry();
+            const juce::SpinLock::ScopedLockType scopedLock(registry.lock);
+
+            for (const auto& buffer : registry.buffers)
+                buffers.push_back(buffer.get());
+        }
+
+        for (auto* buffer : buffers)
+        {
+            buffer->drain([this, buffer](const Event& event)
+            {
+                *stream << (isFirstEvent ? "" : ",\n")
+                        << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                        << ",\"ts\":" << juce::String(ticksToMicroseconds(event.startTicks), 3)
+                        << ",\"dur\":" << juce::String(ticksToMicroseconds(event.endTicks - event.startTicks), 3) << "}";
+                isFirstEvent = false;
+            });
+        }
+
+        stream->flush();
+    }
+}
+
+#endif
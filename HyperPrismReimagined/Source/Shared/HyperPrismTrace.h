@@ -0,0 +1,80 @@
+//==============================================================================
+// HyperPrism Reimagined - Trace Instrumentation
+// Scoped markers recorded into per-thread lock-free ring buffers and written
+// to a Chrome trace-event JSON file (chrome://tracing, ui.perfetto.dev) by a
+// background thread. Compiled out entirely unless HYPERPRISM_TRACE=1.
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef HYPERPRISM_TRACE
+ #define HYPERPRISM_TRACE 0
+#endif
+
+#if HYPERPRISM_TRACE
+
+namespace HyperPrismTrace
+{
+    // Records a complete event on the calling thread. The name must be a string
+    // literal (only the pointer is stored). Never allocates or locks, except the
+    // first time a thread records anything, when its ring buffer is registered.
+    void record(const char* name, juce::int64 startTicks, juce::int64 endTicks) noexcept;
+
+    class ScopedEvent
+    {
+    public:
+        explicit ScopedEvent(const char* eventName) noexcept
+            : name(eventName), startTicks(juce::Time::getHighResolutionTicks())
+        {
+        }
+
+        ~ScopedEvent() noexcept
+        {
+            record(name, startTicks, juce::Time::getHighResolutionTicks());
+        }
+
+    private:
+        const char* name;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedEvent)
+    };
+
+    // Drains every thread's ring buffer to the trace file every 100 ms. Shared by
+    // all processors in the process through a SharedResourcePointer; the file is
+    // closed off when the last one goes away. Written to $HYPERPRISM_TRACE_FILE,
+    // or HyperPrismTrace-<time>.json in the temp directory.
+    class Writer : private juce::Thread
+    {
+    public:
+        Writer();
+        ~Writer() override;
+
+        juce::File getFile() const { return file; }
+
+    private:
+        void run() override;
+        void flush();
+
+        juce::File file;
+        std::unique_ptr<juce::FileOutputStream> stream;
+        bool isFirstEvent = true;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Writer)
+    };
+}
+
+ #define HYPERPRISM_TRACE_SCOPE(name) \
+    const HyperPrismTrace::ScopedEvent JUCE_JOIN_MACRO(hyperPrismTraceEvent_, __LINE__) (name)
+
+ #define HYPERPRISM_DECLARE_TRACE_SESSION \
+    juce::SharedResourcePointer<HyperPrismTrace::Writer> traceSession;
+
+#else
+
+ #define HYPERPRISM_TRACE_SCOPE(name)
+ #define HYPERPRISM_DECLARE_TRACE_SESSION
+
+#endif
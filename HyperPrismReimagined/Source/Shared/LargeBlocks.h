@@ -0,0 +1,95 @@
+//==============================================================================
+// HyperPrism Reimagined - Large Block Support
+// Scratch sizing for offline hosts that send whole seconds of audio per block,
+// slicing for blocks beyond what a processor prepared for, and block-wide
+// mixing kernels
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismLargeBlocks
+{
+    //==============================================================================
+    // Bounces and batch renders (isNonRealtime) commonly arrive in 8192-65536
+    // sample blocks, whatever block size the host last prepared for. Offline,
+    // scratch is sized for this many samples so those blocks run in one piece.
+    constexpr int offlineBlockCapacity = 65536;
+
+    // Samples of scratch to allocate in prepareToPlay; call it after the host
+    // has set the processing mode, as the plugin wrappers do
+    inline int getScratchCapacity(const juce::AudioProcessor& processor, int samplesPerBlock)
+    {
+        return processor.isNonRealtime() ? juce::jmax(samplesPerBlock, offlineBlockCapacity)
+                                         : samplesPerBlock;
+    }
+
+    // Runs processBlock on consecutive slices of at most capacity samples and
+    // returns true if the buffer needed slicing, so a processor never grows its
+    // scratch on the audio thread:
+    //
+    //     if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+    //         return;
+    inline bool processInSlices(juce::AudioProcessor& processor, juce::AudioBuffer<float>& buffer,
+                                juce::MidiBuffer& midiMessages, int capacity)
+    {
+        const auto numSamples = buffer.getNumSamples();
+
+        if (capacity <= 0 || numSamples <= capacity)
+            return false;
+
+        for (int start = 0; start < numSamples; start += capacity)
+        {
+            juce::AudioBuffer<float> slice(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                           start, juce::jmin(capacity, numSamples - start));
+            processor.processBlock(slice, midiMessages);
+        }
+
+        return true;
+    }
+
+    //==============================================================================
+    // wet = dry * (1 - mix) + wet * mix for a mix that holds for the block, a
+    // channel at a time so the vector operations run over long contiguous spans
+    inline void mixDryWet(juce::AudioBuffer<float>& wet, const juce::AudioBuffer<float>& dry,
+                          int numChannels, int numSamples, float mix)
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            auto* wetData = wet.getWritePointer(channel);
+            juce::FloatVectorOperations::multiply(wetData, mix, numSamples);
+            juce::FloatVectorOperations::addWithMultiply(wetData, dry.getReadPointer(channel), 1.0f - mix, numSamples);
+        }
+    }
+
+    // The same blend for a mix rendered by a HyperPrismDSP::ParameterRamp: the
+    // vector version while the ramp holds, sample by sample while it moves
+    inline void mixDryWet(juce::AudioBuffer<float>& wet, const juce::AudioBuffer<float>& dry,
+                          int numChannels, int numSamples, const float* mix, bool mixIsConstant)
+    {
+        if (mixIsConstant)
+        {
+            mixDryWet(wet, dry, numChannels, numSamples, mix[0]);
+            return;
+        }
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            auto* wetData = wet.getWritePointer(channel);
+            const auto* dryData = dry.getReadPointer(channel);
+
+            for (int i = 0; i < numSamples; ++i)
+                wetData[i] = dryData[i] * (1.0f - mix[i]) + wetData[i] * mix[i];
+        }
+    }
+
+    // Scales a channel by a gain rendered by a HyperPrismDSP::ParameterRamp
+    inline void applyGain(float* data, const float* gain, bool gainIsConstant, int numSamples)
+    {
+        if (gainIsConstant)
+            juce::FloatVectorOperations::multiply(data, gain[0], numSamples);
+        else
+            juce::FloatVectorOperations::multiply(data, gain, numSamples);
+    }
+}
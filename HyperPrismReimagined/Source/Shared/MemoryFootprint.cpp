@@ -0,0 +1,59 @@
+//==============================================================================
+// HyperPrism Reimagined - Memory Footprint Reporting Implementation
+//==============================================================================
+
+#include "MemoryFootprint.h"
+
+namespace HyperPrismMemory
+{
+    void Footprint::add(const juce::String& name, size_t bytes)
+    {
+        for (auto& component : components)
+        {
+            if (component.name == name)
+            {
+                component.bytes += bytes;
+                return;
+            }
+        }
+
+        components.push_back({ name, bytes, true });
+    }
+
+    void Footprint::addUntracked(const juce::String& name)
+    {
+        components.push_back({ name, 0, false });
+    }
+
+    size_t Footprint::getTotalBytes() const noexcept
+    {
+        size_t total = 0;
+
+        for (const auto& component : components)
+            total += component.bytes;
+
+        return total;
+    }
+
+    juce::StringArray Footprint::getUntrackedNames() const
+    {
+        juce::StringArray names;
+
+        for (const auto& component : components)
+            if (! component.isTracked)
+                names.add(component.name);
+
+        return names;
+    }
+
+    juce::String formatBytes(size_t bytes)
+    {
+        if (bytes < 1024)
+            return juce::String(static_cast<juce::int64>(bytes)) + " B";
+
+        if (bytes < 1024 * 1024)
+            return juce::String(static_cast<double>(bytes) / 1024.0, 1) + " KiB";
+
+        return juce::String(static_cast<double>(bytes) / (1024.0 * 1024.0), 2) + " MiB";
+    }
+}
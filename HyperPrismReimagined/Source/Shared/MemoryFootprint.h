@@ -0,0 +1,83 @@
+//==============================================================================
+// HyperPrism Reimagined - Memory Footprint Reporting
+// Lets each processor list the heap it holds after prepareToPlay, component by
+// component, so session RAM can be planned and oversized buffers spotted
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismMemory
+{
+    //==============================================================================
+    // Byte counts for the containers the processors use
+    //==============================================================================
+    inline size_t bytesOf(const juce::AudioBuffer<float>& buffer)
+    {
+        return static_cast<size_t>(buffer.getNumChannels()) * static_cast<size_t>(buffer.getNumSamples()) * sizeof(float);
+    }
+
+    template <typename ElementType>
+    size_t bytesOf(const std::vector<ElementType>& vector)
+    {
+        return vector.capacity() * sizeof(ElementType);
+    }
+
+    // juce::dsp::DelayLine keeps (maximum delay + 2) samples per prepared channel
+    inline size_t bytesOf(const juce::dsp::DelayLine<float>& delayLine, int numChannels)
+    {
+        return static_cast<size_t>(numChannels) * static_cast<size_t>(delayLine.getMaximumDelayInSamples() + 2) * sizeof(float);
+    }
+
+    //==============================================================================
+    // A processor's breakdown, in the order the components were added
+    //==============================================================================
+    class Footprint
+    {
+    public:
+        struct Component
+        {
+            juce::String name;
+            size_t bytes = 0;
+            bool isTracked = true;      // False when the owner cannot see the size (third-party internals)
+        };
+
+        // Adds bytes to a component, creating it on first use
+        void add(const juce::String& name, size_t bytes);
+
+        template <typename Container>
+        void add(const juce::String& name, const Container& container)
+        {
+            add(name, bytesOf(container));
+        }
+
+        // Names heap held inside an object whose size is not visible from outside;
+        // a measuring host attributes whatever it cannot account for to these
+        void addUntracked(const juce::String& name);
+
+        const std::vector<Component>& getComponents() const noexcept    { return components; }
+
+        // Sum of the tracked components
+        size_t getTotalBytes() const noexcept;
+
+        juce::StringArray getUntrackedNames() const;
+
+    private:
+        std::vector<Component> components;
+    };
+
+    //==============================================================================
+    // Implemented by every processor; call after prepareToPlay
+    //==============================================================================
+    class Reporter
+    {
+    public:
+        virtual ~Reporter() = default;
+
+        virtual void describeMemory(Footprint& footprint) const = 0;
+    };
+
+    // Human-readable size (B, KiB, MiB)
+    juce::String formatBytes(size_t bytes);
+}
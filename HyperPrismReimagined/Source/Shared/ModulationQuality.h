@@ -0,0 +1,44 @@
+//==============================================================================
+// HyperPrism Reimagined - Modulation Quality
+// The per-effect setting that picks how often swept filters and modulated
+// delays recompute their LFOs and coefficients (HyperPrismDSP::ControlSignal)
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "ParameterTable.h"
+
+namespace HyperPrismModulation
+{
+    constexpr auto QUALITY_ID = "modulationQuality";
+
+    // Control intervals in samples, in choice order. Audio Rate recomputes
+    // every sample, as these effects did before the setting existed.
+    constexpr std::array<int, 4> controlIntervals { 1, 8, 16, 32 };
+    constexpr int defaultQuality = 2;
+
+    // Not automatable: it trades CPU for accuracy and is no use to sweep
+    template <typename Index>
+    constexpr HyperPrismParameters::Spec qualityParameter(Index index)
+    {
+        return HyperPrismParameters::asSetting(
+            HyperPrismParameters::choiceParameter(index, QUALITY_ID, "Modulation Quality",
+                                                  "Audio Rate|High (8 samples)|Normal (16 samples)|Low (32 samples)",
+                                                  defaultQuality));
+    }
+
+    // For processors that build their layout by hand
+    inline std::unique_ptr<juce::RangedAudioParameter> createParameter()
+    {
+        return HyperPrismParameters::createParameter(qualityParameter(0));
+    }
+
+    // The interval for a raw choice value
+    inline int getControlInterval(float choice) noexcept
+    {
+        const auto index = juce::jlimit(0, static_cast<int>(controlIntervals.size()) - 1, static_cast<int>(choice));
+        return controlIntervals[static_cast<std::size_t>(index)];
+    }
+}
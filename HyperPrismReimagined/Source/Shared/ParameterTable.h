@@ -0,0 +1,255 @@
+//==============================================================================
+// HyperPrism Reimagined - Parameter Table
+// A processor's parameters declared once, as a constexpr table indexed by an
+// enum: the table builds the APVTS layout, and processing reads cached value
+// pointers or a per-block snapshot instead of looking parameters up by ID
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+namespace HyperPrismParameters
+{
+    enum class Type { Float, Int, Bool, Choice };
+
+    //==============================================================================
+    // One row of a table. Float values are shown with the given decimals and
+    // suffix ("1000 Hz"), truncated to a whole number, or with JUCE's default
+    // text next to the host-facing label.
+    struct Spec
+    {
+        static constexpr int defaultText = -1;
+        static constexpr int integerText = -2;
+
+        int index = -1;
+        const char* id = nullptr;
+        const char* name = nullptr;
+        Type type = Type::Float;
+        float minimum = 0.0f;
+        float maximum = 1.0f;
+        float interval = 0.0f;
+        float skew = 1.0f;
+        float defaultValue = 0.0f;
+        const char* label = "";
+        int decimals = defaultText;
+        const char* suffix = "";
+        const char* choices = "";           // Separated by '|'
+        bool automatable = true;
+    };
+
+    //==============================================================================
+    // Each row names the enumerator it belongs to, so Table::isValid can catch
+    // a table that has drifted out of step with its enum
+    template <typename Index>
+    constexpr Spec floatParameter(Index index, const char* id, const char* name,
+                                  float minimum, float maximum, float interval, float skew, float defaultValue,
+                                  int decimals = Spec::defaultText, const char* suffix = "")
+    {
+        Spec spec;
+        spec.index = static_cast<int>(index);
+        spec.id = id;
+        spec.name = name;
+        spec.minimum = minimum;
+        spec.maximum = maximum;
+        spec.interval = interval;
+        spec.skew = skew;
+        spec.defaultValue = defaultValue;
+        spec.decimals = decimals;
+        spec.suffix = suffix;
+        return spec;
+    }
+
+    template <typename Index>
+    constexpr Spec labelledFloatParameter(Index index, const char* id, const char* name,
+                                          float minimum, float maximum, float interval, float skew, float defaultValue,
+                                          const char* label)
+    {
+        auto spec = floatParameter(index, id, name, minimum, maximum, interval, skew, defaultValue);
+        spec.label = label;
+        return spec;
+    }
+
+    template <typename Index>
+    constexpr Spec intParameter(Index index, const char* id, const char* name, int minimum, int maximum, int defaultValue)
+    {
+        auto spec = floatParameter(index, id, name, static_cast<float>(minimum), static_cast<float>(maximum),
+                                   1.0f, 1.0f, static_cast<float>(defaultValue));
+        spec.type = Type::Int;
+        return spec;
+    }
+
+    template <typename Index>
+    constexpr Spec boolParameter(Index index, const char* id, const char* name, bool defaultValue)
+    {
+        auto spec = floatParameter(index, id, name, 0.0f, 1.0f, 1.0f, 1.0f, defaultValue ? 1.0f : 0.0f);
+        spec.type = Type::Bool;
+        return spec;
+    }
+
+    template <typename Index>
+    constexpr Spec choiceParameter(Index index, const char* id, const char* name, const char* choices, int defaultIndex)
+    {
+        auto spec = floatParameter(index, id, name, 0.0f, 0.0f, 1.0f, 1.0f, static_cast<float>(defaultIndex));
+        spec.type = Type::Choice;
+        spec.choices = choices;
+        return spec;
+    }
+
+    // A setting rather than a control (quality, threading): saved with the
+    // state but hidden from host automation
+    constexpr Spec asSetting(Spec spec)
+    {
+        spec.automatable = false;
+        return spec;
+    }
+
+    namespace detail
+    {
+        constexpr bool idsMatch(const char* a, const char* b)
+        {
+            while (*a != 0 && *a == *b)
+            {
+                ++a;
+                ++b;
+            }
+
+            return *a == *b;
+        }
+    }
+
+    //==============================================================================
+    // Index is an enum class of the parameters in layout order, ending in count:
+    //
+    //     enum class Param { bypass, frequency, mix, count };
+    //
+    //     constexpr HyperPrismParameters::Table<Param> parameterTable {{{
+    //         boolParameter(Param::bypass, "bypass", "Bypass", false),
+    //         ...
+    //     }}};
+    //     static_assert(parameterTable.isValid(), "...");
+    template <typename Index>
+    struct Table
+    {
+        static constexpr std::size_t size = static_cast<std::size_t>(Index::count);
+
+        std::array<Spec, size> specs;
+
+        constexpr const Spec& operator[](Index index) const { return specs[static_cast<std::size_t>(index)]; }
+
+        // Every row present, in enum order, with a unique ID
+        constexpr bool isValid() const
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (specs[i].index != static_cast<int>(i) || specs[i].id == nullptr || specs[i].name == nullptr)
+                    return false;
+
+                for (std::size_t j = 0; j < i; ++j)
+                    if (detail::idsMatch(specs[i].id, specs[j].id))
+                        return false;
+            }
+
+            return true;
+        }
+    };
+
+    //==============================================================================
+    inline std::unique_ptr<juce::RangedAudioParameter> createParameter(const Spec& spec)
+    {
+        switch (spec.type)
+        {
+            case Type::Bool:
+                return std::make_unique<juce::AudioParameterBool>(spec.id, spec.name, spec.defaultValue > 0.5f,
+                                                                  juce::AudioParameterBoolAttributes().withAutomatable(spec.automatable));
+
+            case Type::Int:
+                return std::make_unique<juce::AudioParameterInt>(spec.id, spec.name,
+                                                                 static_cast<int>(spec.minimum),
+                                                                 static_cast<int>(spec.maximum),
+                                                                 static_cast<int>(spec.defaultValue),
+                                                                 juce::AudioParameterIntAttributes().withAutomatable(spec.automatable));
+
+            case Type::Choice:
+                return std::make_unique<juce::AudioParameterChoice>(spec.id, spec.name,
+                                                                    juce::StringArray::fromTokens(spec.choices, "|", ""),
+                                                                    static_cast<int>(spec.defaultValue),
+                                                                    juce::AudioParameterChoiceAttributes().withAutomatable(spec.automatable));
+
+            case Type::Float:
+                break;
+        }
+
+        auto attributes = juce::AudioParameterFloatAttributes().withLabel(spec.label).withAutomatable(spec.automatable);
+        const auto decimals = spec.decimals;
+        const juce::String suffix(spec.suffix);
+
+        if (decimals == Spec::integerText)
+            attributes = attributes.withStringFromValueFunction([suffix](float value, int) { return juce::String(static_cast<int>(value)) + suffix; });
+        else if (decimals != Spec::defaultText)
+            attributes = attributes.withStringFromValueFunction([decimals, suffix](float value, int) { return juce::String(value, decimals) + suffix; });
+
+        return std::make_unique<juce::AudioParameterFloat>(spec.id, spec.name,
+                                                           juce::NormalisableRange<float>(spec.minimum, spec.maximum, spec.interval, spec.skew),
+                                                           spec.defaultValue, attributes);
+    }
+
+    template <typename Index>
+    juce::AudioProcessorValueTreeState::ParameterLayout createLayout(const Table<Index>& table)
+    {
+        juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+        for (const auto& spec : table.specs)
+            layout.add(createParameter(spec));
+
+        return layout;
+    }
+
+    //==============================================================================
+    // Every value read once at the top of a block; plain data, cheap to copy
+    template <typename Index>
+    struct Snapshot
+    {
+        std::array<float, Table<Index>::size> values;
+
+        float operator[](Index index) const noexcept    { return values[static_cast<std::size_t>(index)]; }
+        bool isOn(Index index) const noexcept            { return (*this)[index] > 0.5f; }
+        int getIndex(Index index) const noexcept         { return static_cast<int>((*this)[index]); }
+    };
+
+    // The raw value pointers, looked up by ID once when the processor is built
+    template <typename Index>
+    class Values
+    {
+    public:
+        Values(juce::AudioProcessorValueTreeState& state, const Table<Index>& table)
+        {
+            for (std::size_t i = 0; i < Table<Index>::size; ++i)
+            {
+                pointers[i] = state.getRawParameterValue(table.specs[i].id);
+                jassert(pointers[i] != nullptr);
+            }
+        }
+
+        float get(Index index) const noexcept
+        {
+            return pointers[static_cast<std::size_t>(index)]->load(std::memory_order_relaxed);
+        }
+
+        Snapshot<Index> snapshot() const noexcept
+        {
+            Snapshot<Index> snapshot;
+
+            for (std::size_t i = 0; i < Table<Index>::size; ++i)
+                snapshot.values[i] = pointers[i]->load(std::memory_order_relaxed);
+
+            return snapshot;
+        }
+
+    private:
+        std::array<std::atomic<float>*, Table<Index>::size> pointers {};
+
+        JUCE_DECLARE_NON_COPYABLE(Values)
+    };
+}
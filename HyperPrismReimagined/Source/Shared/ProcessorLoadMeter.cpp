@@ -0,0 +1,48 @@
+//==============================================================================
+// HyperPrism Reimagined - Processor Load Meter Implementation
+//==============================================================================
+
+#include "ProcessorLoadMeter.h"
+
+namespace HyperPrismLoad
+{
+    namespace
+    {
+        constexpr double smoothingSeconds = 0.3;
+        constexpr double peakDecaySeconds = 1.0;
+    }
+
+    void LoadMeter::prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+        secondsPerTick = 1.0 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+        reset();
+    }
+
+    void LoadMeter::reset()
+    {
+        smoothedLoad = 0.0f;
+        heldPeak = 0.0f;
+        load.store(0.0f, std::memory_order_relaxed);
+        peakLoad.store(0.0f, std::memory_order_relaxed);
+    }
+
+    void LoadMeter::addBlock(juce::int64 elapsedTicks, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return;
+
+        const double blockSeconds = numSamples / sampleRate;
+        const auto blockLoad = static_cast<float>(static_cast<double>(elapsedTicks) * secondsPerTick / blockSeconds);
+
+        // Time-based coefficients so the meter behaves the same at any block size
+        const auto smoothing = static_cast<float>(1.0 - std::exp(-blockSeconds / smoothingSeconds));
+        const auto decay = static_cast<float>(std::exp(-blockSeconds / peakDecaySeconds));
+
+        smoothedLoad += smoothing * (blockLoad - smoothedLoad);
+        heldPeak = juce::jmax(blockLoad, heldPeak * decay);
+
+        load.store(smoothedLoad, std::memory_order_relaxed);
+        peakLoad.store(heldPeak, std::memory_order_relaxed);
+    }
+}
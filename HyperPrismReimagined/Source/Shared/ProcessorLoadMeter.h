@@ -0,0 +1,69 @@
+//==============================================================================
+// HyperPrism Reimagined - Processor Load Meter
+// Times processBlock against the block's real-time budget and publishes the
+// result through atomics for the editor to poll
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismLoad
+{
+    class LoadMeter
+    {
+    public:
+        LoadMeter() = default;
+
+        // Call from prepareToPlay; clears the readings
+        void prepare(double sampleRate);
+        void reset();
+
+        // Proportion of the block duration spent in processBlock (1.0 = whole budget),
+        // smoothed over roughly 300 ms. Safe to call from any thread.
+        float getLoad() const noexcept       { return load.load(std::memory_order_relaxed); }
+
+        // Slowest recent block, held and decaying over about a second
+        float getPeakLoad() const noexcept   { return peakLoad.load(std::memory_order_relaxed); }
+
+        // Create one at the top of processBlock
+        class ScopedTimer
+        {
+        public:
+            ScopedTimer(LoadMeter& meterToUse, int numSamplesInBlock) noexcept
+                : meter(meterToUse), numSamples(numSamplesInBlock),
+                  startTicks(juce::Time::getHighResolutionTicks())
+            {
+            }
+
+            ~ScopedTimer() noexcept
+            {
+                meter.addBlock(juce::Time::getHighResolutionTicks() - startTicks, numSamples);
+            }
+
+        private:
+            LoadMeter& meter;
+            const int numSamples;
+            const juce::int64 startTicks;
+
+            JUCE_DECLARE_NON_COPYABLE(ScopedTimer)
+        };
+
+        // For a block timed in several pieces: the summed time, added once
+        void addBlock(juce::int64 elapsedTicks, int numSamples) noexcept;
+
+    private:
+
+        double sampleRate = 44100.0;
+        double secondsPerTick = 1.0 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+
+        // Audio thread only
+        float smoothedLoad = 0.0f;
+        float heldPeak = 0.0f;
+
+        std::atomic<float> load { 0.0f };
+        std::atomic<float> peakLoad { 0.0f };
+
+        JUCE_DECLARE_NON_COPYABLE(LoadMeter)
+    };
+}
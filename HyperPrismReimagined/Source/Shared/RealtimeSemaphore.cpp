@@ -0,0 +1,76 @@
+//==============================================================================
+// HyperPrism Reimagined - Realtime Semaphore Implementation
+//==============================================================================
+
+#include "RealtimeSemaphore.h"
+
+#if JUCE_WINDOWS
+ #include <windows.h>
+#elif JUCE_MAC || JUCE_IOS
+ #include <dispatch/dispatch.h>
+#else
+ #include <semaphore.h>
+ #include <cerrno>
+#endif
+
+namespace HyperPrismThreads
+{
+   #if JUCE_WINDOWS
+    struct Semaphore::Native
+    {
+        Native()  { handle = CreateSemaphoreW(nullptr, 0, std::numeric_limits<LONG>::max(), nullptr); }
+        ~Native() { CloseHandle(handle); }
+
+        void signal() noexcept  { ReleaseSemaphore(handle, 1, nullptr); }
+        void wait() noexcept    { WaitForSingleObject(handle, INFINITE); }
+
+        HANDLE handle;
+    };
+   #elif JUCE_MAC || JUCE_IOS
+    struct Semaphore::Native
+    {
+        Native()  { semaphore = dispatch_semaphore_create(0); }
+        ~Native() { dispatch_release(semaphore); }
+
+        void signal() noexcept  { dispatch_semaphore_signal(semaphore); }
+        void wait() noexcept    { dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER); }
+
+        dispatch_semaphore_t semaphore;
+    };
+   #else
+    struct Semaphore::Native
+    {
+        Native()  { sem_init(&semaphore, 0, 0); }
+        ~Native() { sem_destroy(&semaphore); }
+
+        void signal() noexcept  { sem_post(&semaphore); }
+
+        void wait() noexcept
+        {
+            while (sem_wait(&semaphore) != 0 && errno == EINTR)
+            {
+            }
+        }
+
+        sem_t semaphore;
+    };
+   #endif
+
+    //==============================================================================
+    Semaphore::Semaphore()
+        : native(std::make_unique<Native>())
+    {
+    }
+
+    Semaphore::~Semaphore() = default;
+
+    void Semaphore::signal() noexcept
+    {
+        native->signal();
+    }
+
+    void Semaphore::wait() noexcept
+    {
+        native->wait();
+    }
+}
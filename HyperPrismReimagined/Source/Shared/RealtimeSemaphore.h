@@ -0,0 +1,51 @@
+//==============================================================================
+// HyperPrism Reimagined - Realtime Semaphore
+// Wakes a sleeping helper thread from the audio thread without taking a lock:
+// juce::WaitableEvent::signal locks a mutex, which can stall the audio thread
+// behind whichever lower-priority thread holds it
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismThreads
+{
+    //==============================================================================
+    // Counting semaphore over the platform's own (POSIX sem_t, dispatch
+    // semaphore, Win32 semaphore), none of which takes a user-space lock to post
+    class Semaphore
+    {
+    public:
+        Semaphore();
+        ~Semaphore();
+
+        // Audio thread safe: one atomic increment, plus a kernel wake when a
+        // thread is waiting
+        void signal() noexcept;
+
+        // Helper threads only: sleeps until signalled
+        void wait() noexcept;
+
+    private:
+        struct Native;
+        std::unique_ptr<Native> native;
+
+        JUCE_DECLARE_NON_COPYABLE(Semaphore)
+    };
+
+    // Spin-wait hint for the CPU: yields the core's pipeline to its sibling
+    // hyperthread and saves power while a loop polls an atomic
+    inline void pause() noexcept
+    {
+       #if JUCE_INTEL && JUCE_MSVC
+        _mm_pause();
+       #elif JUCE_INTEL
+        __builtin_ia32_pause();
+       #elif JUCE_ARM && JUCE_MSVC
+        __yield();
+       #elif JUCE_ARM
+        __asm__ __volatile__ ("yield");
+       #endif
+    }
+}
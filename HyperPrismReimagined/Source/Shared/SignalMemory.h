@@ -0,0 +1,39 @@
+//==============================================================================
+// HyperPrism Reimagined - Signal Memory Declaration
+// Lets a processor state how much past input its output depends on, so an
+// offline renderer can split a long file into chunks that start cold and still
+// match a continuous render sample for sample
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace HyperPrismSignalMemory
+{
+    //==============================================================================
+    // Implemented by processors whose state is fully determined by a bounded
+    // stretch of recent input while the parameters hold still. Started that many
+    // samples early, a freshly prepared instance produces exactly the output of
+    // one that has been running since the start of the file. Anything with IIR
+    // filters, feedback, envelopes or a free-running oscillator never converges
+    // exactly and does not implement this.
+    //==============================================================================
+    class Bounded
+    {
+    public:
+        virtual ~Bounded() = default;
+
+        // Samples of history at the prepared sample rate and current parameters
+        virtual int getSignalMemorySamples() const = 0;
+    };
+
+    // The processor's declared memory, or -1 if it is unbounded
+    inline int getSignalMemorySamples(const juce::AudioProcessor& processor)
+    {
+        if (auto* bounded = dynamic_cast<const Bounded*>(&processor))
+            return bounded->getSignalMemorySamples();
+
+        return -1;
+    }
+}
@@ -165,4 +165,57 @@ namespace HyperPrismLayout
             g.drawHorizontalLine(y, static_cast<float>(bounds.getX()), static_cast<float>(bounds.getRight()));
         }
     }
-}
\ No newline at end of file
+
+    void StandardPaint::paintLoadReadout(juce::Graphics& g,
+                                       const juce::Rectangle<int>& area,
+                                       float load,
+                                       float peakLoad)
+    {
+        // Amber once a block takes more than half its budget, red when it overruns
+        auto peakColour = peakLoad >= 1.0f ? HyperPrismLookAndFeel::Colors::error
+                        : peakLoad >= 0.5f ? HyperPrismLookAndFeel::Colors::warning
+                                           : HyperPrismLookAndFeel::Colors::outline;
+
+        g.setFont(juce::Font(juce::FontOptions(9.0f)));
+
+        auto text = area;
+        auto loadText = "DSP " + juce::String(load * 100.0f, 1) + "%";
+        g.setColour(HyperPrismLookAndFeel::Colors::outline);
+        g.drawText(loadText, text.removeFromLeft(60), juce::Justification::centredLeft);
+
+        g.setColour(peakColour);
+        g.drawText("peak " + juce::String(peakLoad * 100.0f, 1) + "%", text, juce::Justification::centredLeft);
+    }
+
+    //==============================================================================
+    LoadReadout::LoadReadout(const HyperPrismLoad::LoadMeter& meterToShow)
+        : meter(meterToShow)
+    {
+        setInterceptsMouseClicks(false, false);
+        startTimerHz(30);
+    }
+
+    LoadReadout::~LoadReadout()
+    {
+        stopTimer();
+    }
+
+    void LoadReadout::paint(juce::Graphics& g)
+    {
+        StandardPaint::paintLoadReadout(g, getLocalBounds(), displayedLoad, displayedPeak);
+    }
+
+    void LoadReadout::timerCallback()
+    {
+        const auto load = meter.getLoad();
+        const auto peak = meter.getPeakLoad();
+
+        // Only repaint when the text would change
+        if (std::abs(load - displayedLoad) >= 0.0005f || std::abs(peak - displayedPeak) >= 0.0005f)
+        {
+            displayedLoad = load;
+            displayedPeak = peak;
+            repaint();
+        }
+    }
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "ProcessorLoadMeter.h"
 
 namespace HyperPrismLayout
 {
@@ -110,5 +111,31 @@ namespace HyperPrismLayout
         static void paintLayoutGuides(juce::Graphics& g, 
                                     const juce::Rectangle<int>& bounds,
                                     bool enabled = false);
+
+        // Footer DSP load readout, e.g. "DSP 3.1%  peak 7.8%"
+        static void paintLoadReadout(juce::Graphics& g,
+                                     const juce::Rectangle<int>& area,
+                                     float load,
+                                     float peakLoad);
+    };
+
+    // Footer component showing a processor's DSP load; polls the meter itself so
+    // editors without a timer of their own don't need one
+    class LoadReadout : public juce::Component, private juce::Timer
+    {
+    public:
+        explicit LoadReadout(const HyperPrismLoad::LoadMeter& meterToShow);
+        ~LoadReadout() override;
+
+        void paint(juce::Graphics& g) override;
+
+    private:
+        void timerCallback() override;
+
+        const HyperPrismLoad::LoadMeter& meter;
+        float displayedLoad = 0.0f;
+        float displayedPeak = 0.0f;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoadReadout)
     };
 }
\ No newline at end of file
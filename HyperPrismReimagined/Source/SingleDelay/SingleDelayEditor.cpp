@@ -5,6 +5,8 @@
 
 #include "SingleDelayEditor.h"
 
+namespace HyperPrismSingleDelayUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -187,6 +189,7 @@ void DelayMeter::paint(juce::Graphics& g)
 
 void DelayMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("DelayMeter::timerCallback");
     float newInputLevel = processor.getInputLevel();
     float newOutputLevel = processor.getOutputLevel();
     
@@ -210,9 +213,10 @@ void DelayMeter::timerCallback()
 // SingleDelayEditor Implementation
 //==============================================================================
 SingleDelayEditor::SingleDelayEditor(SingleDelayProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), delayMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), delayMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(SingleDelayProcessor::DELAY_TIME_ID);
@@ -353,6 +357,7 @@ SingleDelayEditor::~SingleDelayEditor()
 
 void SingleDelayEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("SingleDelayEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -397,7 +402,7 @@ void SingleDelayEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -680,4 +685,6 @@ void SingleDelayEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismSingleDelayUI
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "SingleDelayProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismSingleDelayUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -158,5 +161,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SingleDelayEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismSingleDelayUI
+
+using HyperPrismSingleDelayUI::SingleDelayEditor;
\ No newline at end of file
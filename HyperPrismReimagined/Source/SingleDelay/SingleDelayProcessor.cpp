@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "SingleDelayProcessor.h"
-#include "SingleDelayEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "SingleDelayEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String SingleDelayProcessor::BYPASS_ID = "bypass";
@@ -89,7 +91,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout SingleDelayProcessor::create
 //==============================================================================
 void SingleDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused(samplesPerBlock);
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare delay lines
@@ -101,6 +103,10 @@ void SingleDelayProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     
     // Initialize filters
     updateFilters();
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    wetDryMixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    wetDryMixRamp.setCurrentAndTarget(wetDryMixParam->load() / 100.0f);
     
     // Reset metering
     inputLevel.store(0.0f);
@@ -114,6 +120,10 @@ void SingleDelayProcessor::releaseResources()
     highCutFilterRight.reset();
     lowCutFilterLeft.reset();
     lowCutFilterRight.reset();
+
+    // Unprepared again: the lines hold no samples until the next prepareToPlay
+    delayLineLeft = juce::dsp::DelayLine<float>(maxDelaySamples);
+    delayLineRight = juce::dsp::DelayLine<float>(maxDelaySamples);
 }
 
 bool SingleDelayProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -128,8 +138,13 @@ bool SingleDelayProcessor::isBusesLayoutSupported(const BusesLayout& layouts) co
     return true;
 }
 
-void SingleDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void SingleDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("SingleDelay::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -147,12 +162,14 @@ void SingleDelayProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
 
 void SingleDelayProcessor::processDelay(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("SingleDelay::processDelay");
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
     
     const float delayTimeMs = delayTimeParam->load();
     const float feedback = feedbackParam->load() / 100.0f;
-    const float wetDryMix = wetDryMixParam->load() / 100.0f;
+    wetDryMixRamp.setTarget(wetDryMixParam->load() / 100.0f);
+    const auto* wetDryMixes = wetDryMixRamp.process(numSamples);
     const float stereoSpread = stereoSpreadParam->load() / 100.0f;
     
     // Calculate delay time in samples
@@ -195,8 +212,8 @@ void SingleDelayProcessor::processDelay(juce::AudioBuffer<float>& buffer)
             delayLine.pushSample(0, feedbackInput);
             
             // Mix wet and dry signals
-            float dryLevel = 1.0f - wetDryMix;
-            float wetLevel = wetDryMix;
+            float dryLevel = 1.0f - wetDryMixes[sample];
+            float wetLevel = wetDryMixes[sample];
             
             channelData[sample] = (input * dryLevel) + (delayedSample * wetLevel);
         }
@@ -211,6 +228,7 @@ void SingleDelayProcessor::processDelay(juce::AudioBuffer<float>& buffer)
 
 void SingleDelayProcessor::updateFilters()
 {
+    HYPERPRISM_TRACE_SCOPE("SingleDelay::updateFilters");
     const float highCut = highCutParam->load();
     const float lowCut = lowCutParam->load();
     
@@ -235,7 +253,11 @@ void SingleDelayProcessor::updateFilters()
 //==============================================================================
 juce::AudioProcessorEditor* SingleDelayProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new SingleDelayEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -252,3 +274,10 @@ void SingleDelayProcessor::setStateInformation(const void* data, int sizeInBytes
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
 }
 
+void SingleDelayProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay lines", HyperPrismMemory::bytesOf(delayLineLeft, 1) + HyperPrismMemory::bytesOf(delayLineRight, 1));
+    footprint.add("parameter ramps", wetDryMixRamp.getAllocatedBytes());
+}
+
@@ -5,8 +5,13 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/ParameterRamp.h"
 
-class SingleDelayProcessor : public juce::AudioProcessor
+class SingleDelayProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +28,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Single Delay"; }
@@ -60,6 +69,12 @@ public:
     float getInputLevel() const { return inputLevel.load(); }
     float getOutputLevel() const { return outputLevel.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -78,10 +93,15 @@ private:
     std::atomic<float>* stereoSpreadParam = nullptr;
     
     // DSP components
-    juce::dsp::DelayLine<float> delayLineLeft { 192000 }; // Max 4 seconds at 48kHz
-    juce::dsp::DelayLine<float> delayLineRight { 192000 };
+    static constexpr int maxDelaySamples = 192000;        // Max 4 seconds at 48kHz
+    juce::dsp::DelayLine<float> delayLineLeft { maxDelaySamples };
+    juce::dsp::DelayLine<float> delayLineRight { maxDelaySamples };
     juce::IIRFilter highCutFilterLeft, highCutFilterRight;
     juce::IIRFilter lowCutFilterLeft, lowCutFilterRight;
+
+    // Wet/dry mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp wetDryMixRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // State variables
     double currentSampleRate = 44100.0;
@@ -92,5 +112,8 @@ private:
     std::atomic<float> inputLevel { 0.0f };
     std::atomic<float> outputLevel { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SingleDelayProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "SonicDecimatorEditor.h"
 
+namespace HyperPrismSonicDecimatorUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -212,6 +214,7 @@ void DecimationMeter::paint(juce::Graphics& g)
 
 void DecimationMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("DecimationMeter::timerCallback");
     float newInputLevel = processor.getInputLevel();
     float newOutputLevel = processor.getOutputLevel();
     float newBitReduction = processor.getBitReduction();
@@ -233,9 +236,10 @@ void DecimationMeter::timerCallback()
 // SonicDecimatorEditor Implementation
 //==============================================================================
 SonicDecimatorEditor::SonicDecimatorEditor(SonicDecimatorProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), decimationMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), decimationMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(SonicDecimatorProcessor::BIT_DEPTH_ID);
@@ -367,6 +371,7 @@ SonicDecimatorEditor::~SonicDecimatorEditor()
 
 void SonicDecimatorEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("SonicDecimatorEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -402,7 +407,7 @@ void SonicDecimatorEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -693,4 +698,6 @@ void SonicDecimatorEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismSonicDecimatorUI
\ No newline at end of file
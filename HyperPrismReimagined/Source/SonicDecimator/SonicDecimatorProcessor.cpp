@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "SonicDecimatorProcessor.h"
-#include "SonicDecimatorEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "SonicDecimatorEditor.h"
+#endif
 
 //==============================================================================
 // BitCrusher Implementation
@@ -62,32 +64,20 @@ void SonicDecimatorProcessor::BitCrusher::updateQuantizationStep()
 //==============================================================================
 // SampleRateReducer Implementation
 //==============================================================================
-void SonicDecimatorProcessor::SampleRateReducer::prepare(double sampleRate, int samplesPerBlock)
+void SonicDecimatorProcessor::SampleRateReducer::prepare(double sampleRate)
 {
     originalSampleRate = sampleRate;
-
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = 1;
-
-    antiAliasFilter.prepare(spec);
-
     reset();
 }
 
 void SonicDecimatorProcessor::SampleRateReducer::setSampleRate(float newTargetSampleRate)
 {
     targetSampleRate = newTargetSampleRate;
-    
-    // Update anti-aliasing filter cutoff
-    if (antiAliasingEnabled && targetSampleRate < originalSampleRate)
-    {
-        float cutoffFreq = targetSampleRate * 0.45f; // Slightly below Nyquist
-        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            originalSampleRate, cutoffFreq);
-        antiAliasFilter.coefficients = coefficients;
-    }
+}
+
+void SonicDecimatorProcessor::SampleRateReducer::setFilterCoefficients(const HyperPrismDSP::BiquadCoefficients& coefficients, int rampSamples)
+{
+    antiAliasFilter.rampTo(coefficients, rampSamples);
 }
 
 void SonicDecimatorProcessor::SampleRateReducer::setAntiAliasing(bool enableAntiAlias)
@@ -160,7 +150,17 @@ SonicDecimatorProcessor::SonicDecimatorProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input",  juce::AudioChannelSet::stereo(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      antiAliasCoefficients(valueTreeState, { SAMPLE_RATE_ID }, [this](double hostSampleRate)
+      {
+          // Without decimation the reducer bypasses the filter, so it passes through
+          const float targetSampleRate = sampleRateParam->load();
+          if (targetSampleRate >= hostSampleRate)
+              return HyperPrismDSP::BiquadCoefficients {};
+
+          float cutoffFreq = targetSampleRate * 0.45f; // Slightly below Nyquist
+          return HyperPrismCoefficients::fromJuce(*juce::dsp::IIR::Coefficients<float>::makeLowPass(hostSampleRate, cutoffFreq));
+      })
 {
     // Cache parameter pointers for performance
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -222,13 +222,24 @@ juce::AudioProcessorValueTreeState::ParameterLayout SonicDecimatorProcessor::cre
 //==============================================================================
 void SonicDecimatorProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Prepare DSP components with actual buffer size (fixes 512-sample artifact bug)
-    sampleRateReducer.prepare(sampleRate, samplesPerBlock);
+    loadMeter.prepare(sampleRate);
+
+    // Prepare DSP components
+    sampleRateReducer.prepare(sampleRate);
+    antiAliasCoefficients.prepare(sampleRate);
+    sampleRateReducer.setFilterCoefficients(antiAliasCoefficients.get(), 0);
     bitCrusher.reset();
     noiseShaper.reset();
     
     // Prepare dry buffer for mixing
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
+
+    const double rampTime = 0.005; // 5ms
+    mixRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    outputGainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    mixRamp.setCurrentAndTarget(mixParam->load() * 0.01f);
+    outputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     inputLevel.store(0.0f);
@@ -255,8 +266,13 @@ bool SonicDecimatorProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
     return true;
 }
 
-void SonicDecimatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void SonicDecimatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("SonicDecimator::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -276,6 +292,7 @@ void SonicDecimatorProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
 
 void SonicDecimatorProcessor::processDecimation(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("SonicDecimator::processDecimation");
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
     
@@ -283,17 +300,23 @@ void SonicDecimatorProcessor::processDecimation(juce::AudioBuffer<float>& buffer
     const float sampleRate = sampleRateParam->load();
     const bool antiAlias = antiAliasParam->load() > 0.5f;
     const bool dither = ditherParam->load() > 0.5f;
-    const float mix = mixParam->load() * 0.01f; // Convert percentage to 0-1
-    const float outputGain = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    mixRamp.setTarget(mixParam->load() * 0.01f); // Convert percentage to 0-1
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* mixes = mixRamp.process(numSamples);
+    const auto* outputGains = outputGainRamp.process(numSamples);
     
     // Update DSP parameters
     bitCrusher.setBitDepth(bitDepth);
     bitCrusher.setDithering(dither);
     sampleRateReducer.setSampleRate(sampleRate);
     sampleRateReducer.setAntiAliasing(antiAlias);
+
+    // Glide to anti-aliasing coefficients published since the last block
+    if (antiAliasCoefficients.update(isNonRealtime()))
+        sampleRateReducer.setFilterCoefficients(antiAliasCoefficients.get(), HyperPrismCoefficients::rampSamples);
     
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     float inputLevelSum = 0.0f;
     float outputLevelSum = 0.0f;
@@ -320,7 +343,7 @@ void SonicDecimatorProcessor::processDecimation(juce::AudioBuffer<float>& buffer
             float bitCrushed = bitCrusher.processSample(sampleReduced);
             
             // Mix dry and wet signals
-            float output = (dryData[sample] * (1.0f - mix) + bitCrushed * mix) * outputGain;
+            float output = (dryData[sample] * (1.0f - mixes[sample]) + bitCrushed * mixes[sample]) * outputGains[sample];
             channelData[sample] = output;
             
             outputLevelSum += std::abs(output);
@@ -337,7 +360,11 @@ void SonicDecimatorProcessor::processDecimation(juce::AudioBuffer<float>& buffer
 //==============================================================================
 juce::AudioProcessorEditor* SonicDecimatorProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new SonicDecimatorEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -352,4 +379,11 @@ void SonicDecimatorProcessor::setStateInformation(const void* data, int sizeInBy
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void SonicDecimatorProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes() + outputGainRamp.getAllocatedBytes());
 }
\ No newline at end of file
@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/ParameterRamp.h"
 
-class SonicDecimatorProcessor : public juce::AudioProcessor
+class SonicDecimatorProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +29,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Sonic Decimator"; }
@@ -62,6 +72,12 @@ public:
     float getBitReduction() const { return bitReduction.load(); }
     float getSampleReduction() const { return sampleReduction.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     class BitCrusher
@@ -90,9 +106,12 @@ private:
     public:
         SampleRateReducer() = default;
         
-        void prepare(double sampleRate, int samplesPerBlock);
+        void prepare(double sampleRate);
         void setSampleRate(float targetSampleRate);
         void setAntiAliasing(bool enableAntiAlias);
+
+        // Glides the anti-aliasing filter to new coefficients; 0 jumps
+        void setFilterCoefficients(const HyperPrismDSP::BiquadCoefficients& coefficients, int rampSamples);
         void reset();
         
         float processSample(float input);
@@ -106,7 +125,7 @@ private:
         float lastOutputSample = 0.0f;
         
         // Anti-aliasing filter
-        juce::dsp::IIR::Filter<float> antiAliasFilter;
+        HyperPrismDSP::Biquad antiAliasFilter;
     };
     
     class NoiseShaper
@@ -139,9 +158,17 @@ private:
     BitCrusher bitCrusher;
     SampleRateReducer sampleRateReducer;
     NoiseShaper noiseShaper;
+
+    // Anti-aliasing lowpass for the target rate, designed off the audio thread
+    HyperPrismCoefficients::Cache<HyperPrismDSP::BiquadCoefficients> antiAliasCoefficients;
     
     // State variables
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
+
+    // Mix and output level ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    HyperPrismDSP::ParameterRamp outputGainRamp;
     
     // Metering
     std::atomic<float> inputLevel { 0.0f };
@@ -149,5 +176,8 @@ private:
     std::atomic<float> bitReduction { 0.0f };
     std::atomic<float> sampleReduction { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SonicDecimatorProcessor)
 };
\ No newline at end of file
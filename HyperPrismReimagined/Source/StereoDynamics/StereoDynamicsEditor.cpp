@@ -5,6 +5,8 @@
 
 #include "StereoDynamicsEditor.h"
 
+namespace HyperPrismStereoDynamicsUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -237,6 +239,7 @@ void StereoDynamicsMeter::paint(juce::Graphics& g)
 
 void StereoDynamicsMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("StereoDynamicsMeter::timerCallback");
     float newLeftLevel = processor.getLeftLevel();
     float newRightLevel = processor.getRightLevel();
     float newMidLevel = processor.getMidLevel();
@@ -262,9 +265,10 @@ void StereoDynamicsMeter::timerCallback()
 // StereoDynamicsEditor Implementation
 //==============================================================================
 StereoDynamicsEditor::StereoDynamicsEditor(StereoDynamicsProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), stereoDynamicsMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), stereoDynamicsMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(StereoDynamicsProcessor::MID_THRESHOLD_ID);
@@ -416,6 +420,7 @@ StereoDynamicsEditor::~StereoDynamicsEditor()
 
 void StereoDynamicsEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("StereoDynamicsEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -461,7 +466,7 @@ void StereoDynamicsEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -753,4 +758,6 @@ void StereoDynamicsEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismStereoDynamicsUI
\ No newline at end of file
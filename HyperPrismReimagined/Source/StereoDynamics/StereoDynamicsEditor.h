@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "StereoDynamicsProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismStereoDynamicsUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -163,5 +166,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StereoDynamicsEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismStereoDynamicsUI
+
+using HyperPrismStereoDynamicsUI::StereoDynamicsEditor;
\ No newline at end of file
@@ -3,57 +3,9 @@
 //==============================================================================
 
 #include "StereoDynamicsProcessor.h"
-#include "StereoDynamicsEditor.h"
-
-//==============================================================================
-// EnvelopeFollower Implementation
-//==============================================================================
-void StereoDynamicsProcessor::EnvelopeFollower::prepare(double sampleRate)
-{
-    currentSampleRate = sampleRate;
-    updateCoefficients();
-    reset();
-}
-
-void StereoDynamicsProcessor::EnvelopeFollower::setAttackTime(float attackMs)
-{
-    attackCoeff = std::exp(-1.0f / (attackMs * 0.001f * static_cast<float>(currentSampleRate)));
-}
-
-void StereoDynamicsProcessor::EnvelopeFollower::setReleaseTime(float releaseMs)
-{
-    releaseCoeff = std::exp(-1.0f / (releaseMs * 0.001f * static_cast<float>(currentSampleRate)));
-}
-
-void StereoDynamicsProcessor::EnvelopeFollower::reset()
-{
-    envelope = 0.0f;
-}
-
-float StereoDynamicsProcessor::EnvelopeFollower::processSample(float input)
-{
-    float inputLevel = std::abs(input);
-    
-    if (inputLevel > envelope)
-    {
-        // Attack
-        envelope = inputLevel + (envelope - inputLevel) * attackCoeff;
-    }
-    else
-    {
-        // Release
-        envelope = inputLevel + (envelope - inputLevel) * releaseCoeff;
-    }
-    
-    return envelope;
-}
-
-void StereoDynamicsProcessor::EnvelopeFollower::updateCoefficients()
-{
-    // Default values will be overridden by setAttackTime/setReleaseTime
-    setAttackTime(10.0f);  // 10ms
-    setReleaseTime(100.0f); // 100ms
-}
+#if ! HYPERPRISM_HEADLESS
+ #include "StereoDynamicsEditor.h"
+#endif
 
 //==============================================================================
 // StereoDynamicsProcessor Implementation
@@ -150,17 +102,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout StereoDynamicsProcessor::cre
 //==============================================================================
 void StereoDynamicsProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused(samplesPerBlock);
+    loadMeter.prepare(sampleRate);
+    currentSampleRate = sampleRate;
     
     // Prepare envelope followers
-    midEnvelopeFollower.prepare(sampleRate);
-    sideEnvelopeFollower.prepare(sampleRate);
+    midEnvelopeFollower.reset();
+    sideEnvelopeFollower.reset();
     
     // Initialize smoothed values
     smoothedMidGain.reset(sampleRate, 0.01); // 10ms smoothing
     smoothedSideGain.reset(sampleRate, 0.01);
     smoothedMidGain.setCurrentAndTargetValue(1.0f);
     smoothedSideGain.setCurrentAndTargetValue(1.0f);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    outputLevelRamp.prepare(sampleRate, 0.01, scratchCapacity); // 10ms
+    outputLevelRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     leftLevel.store(0.0f);
@@ -189,8 +146,13 @@ bool StereoDynamicsProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
     return true;
 }
 
-void StereoDynamicsProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void StereoDynamicsProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("StereoDynamics::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -210,6 +172,7 @@ void StereoDynamicsProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
 
 void StereoDynamicsProcessor::processStereoDynamics(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("StereoDynamics::processStereoDynamics");
     const int numSamples = buffer.getNumSamples();
     
     const float midThreshold = juce::Decibels::decibelsToGain(midThresholdParam->load());
@@ -218,13 +181,14 @@ void StereoDynamicsProcessor::processStereoDynamics(juce::AudioBuffer<float>& bu
     const float sideRatio = sideRatioParam->load();
     const float attackTime = attackTimeParam->load();
     const float releaseTime = releaseTimeParam->load();
-    const float outputLevel = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    outputLevelRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputLevels = outputLevelRamp.process(numSamples);
     
     // Update envelope follower parameters
-    midEnvelopeFollower.setAttackTime(attackTime);
-    midEnvelopeFollower.setReleaseTime(releaseTime);
-    sideEnvelopeFollower.setAttackTime(attackTime);
-    sideEnvelopeFollower.setReleaseTime(releaseTime);
+    const float attackPole = HyperPrismDSP::poleForTime(attackTime, currentSampleRate);
+    const float releasePole = HyperPrismDSP::poleForTime(releaseTime, currentSampleRate);
+    midEnvelopeFollower.setPoles(attackPole, releasePole);
+    sideEnvelopeFollower.setPoles(attackPole, releasePole);
     
     auto* leftData = buffer.getWritePointer(0);
     auto* rightData = buffer.getWritePointer(1);
@@ -252,7 +216,7 @@ void StereoDynamicsProcessor::processStereoDynamics(juce::AudioBuffer<float>& bu
         // Process dynamics on M/S channels separately
         
         // Mid channel dynamics
-        float midEnvelope = midEnvelopeFollower.processSample(mid);
+        float midEnvelope = midEnvelopeFollower.process(std::abs(mid));
         float midGain = 1.0f;
         if (midEnvelope > midThreshold)
         {
@@ -263,7 +227,7 @@ void StereoDynamicsProcessor::processStereoDynamics(juce::AudioBuffer<float>& bu
         mid *= currentMidGain;
         
         // Side channel dynamics
-        float sideEnvelope = sideEnvelopeFollower.processSample(side);
+        float sideEnvelope = sideEnvelopeFollower.process(std::abs(side));
         float sideGain = 1.0f;
         if (sideEnvelope > sideThreshold)
         {
@@ -282,8 +246,8 @@ void StereoDynamicsProcessor::processStereoDynamics(juce::AudioBuffer<float>& bu
         decodeMSToLR(mid, side, processedLeft, processedRight);
         
         // Apply output level
-        processedLeft *= outputLevel;
-        processedRight *= outputLevel;
+        processedLeft *= outputLevels[sample];
+        processedRight *= outputLevels[sample];
         
         // Store processed audio
         leftData[sample] = processedLeft;
@@ -342,7 +306,11 @@ void StereoDynamicsProcessor::decodeMSToLR(float mid, float side, float& left, f
 //==============================================================================
 juce::AudioProcessorEditor* StereoDynamicsProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new StereoDynamicsEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -357,4 +325,10 @@ void StereoDynamicsProcessor::setStateInformation(const void* data, int sizeInBy
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void StereoDynamicsProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("parameter ramps", outputLevelRamp.getAllocatedBytes());
 }
\ No newline at end of file
@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/EnvelopeFollower.h"
+#include "../DSP/ParameterRamp.h"
 
-class StereoDynamicsProcessor : public juce::AudioProcessor
+class StereoDynamicsProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +29,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Stereo Dynamics"; }
@@ -65,29 +75,13 @@ public:
     float getMidGainReduction() const { return midGainReduction.load(); }
     float getSideGainReduction() const { return sideGainReduction.load(); }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
-    //==============================================================================
-    class EnvelopeFollower
-    {
-    public:
-        EnvelopeFollower() = default;
-        
-        void prepare(double sampleRate);
-        void setAttackTime(float attackMs);
-        void setReleaseTime(float releaseMs);
-        void reset();
-        
-        float processSample(float input);
-        
-    private:
-        double currentSampleRate = 44100.0;
-        float attackCoeff = 0.0f;
-        float releaseCoeff = 0.0f;
-        float envelope = 0.0f;
-        
-        void updateCoefficients();
-    };
-    
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     void processStereoDynamics(juce::AudioBuffer<float>& buffer);
     float calculateGainReduction(float level, float threshold, float ratio);
@@ -107,12 +101,17 @@ private:
     std::atomic<float>* outputLevelParam = nullptr;
     
     // DSP components
-    EnvelopeFollower midEnvelopeFollower;
-    EnvelopeFollower sideEnvelopeFollower;
+    HyperPrismDSP::EnvelopeFollower midEnvelopeFollower;
+    HyperPrismDSP::EnvelopeFollower sideEnvelopeFollower;
     
     // State variables
+    double currentSampleRate = 44100.0;
     juce::SmoothedValue<float> smoothedMidGain;
     juce::SmoothedValue<float> smoothedSideGain;
+
+    // Output level ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp outputLevelRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Metering
     std::atomic<float> leftLevel { 0.0f };
@@ -122,5 +121,8 @@ private:
     std::atomic<float> midGainReduction { 0.0f };
     std::atomic<float> sideGainReduction { 0.0f };
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StereoDynamicsProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,93 @@
+//==============================================================================
+// HyperPrism Reimagined - Suite Editor Implementation
+//==============================================================================
+
+#include "SuiteEditor.h"
+
+//==============================================================================
+SuiteEditor::SuiteEditor(SuiteProcessor& p)
+    : AudioProcessorEditor(&p), audioProcessor(p)
+{
+    setLookAndFeel(&customLookAndFeel);
+
+    titleLabel.setText("HYPERPRISM SUITE", juce::dontSendNotification);
+    titleLabel.setFont(juce::Font(juce::FontOptions(13.0f).withStyle("Bold")));
+    titleLabel.setColour(juce::Label::textColourId, HyperPrismLookAndFeel::Colors::onSurface);
+    titleLabel.setJustificationType(juce::Justification::centredLeft);
+    addAndMakeVisible(titleLabel);
+
+    for (int i = 0; i < audioProcessor.getNumEffects(); ++i)
+        effectBox.addItem(audioProcessor.getEffectName(i), i + 1);
+
+    effectBox.setColour(juce::ComboBox::backgroundColourId, HyperPrismLookAndFeel::Colors::surfaceVariant);
+    effectBox.setColour(juce::ComboBox::textColourId, HyperPrismLookAndFeel::Colors::onSurface);
+    effectBox.setColour(juce::ComboBox::arrowColourId, HyperPrismLookAndFeel::Colors::onSurfaceVariant);
+    effectBox.setColour(juce::ComboBox::outlineColourId, HyperPrismLookAndFeel::Colors::outline);
+    effectBox.setTooltip("Effect run by this instance");
+    effectBox.onChange = [this] { audioProcessor.setActiveEffect(effectBox.getSelectedId() - 1); };
+    addAndMakeVisible(effectBox);
+
+    audioProcessor.addChangeListener(this);
+    showActiveEffect();
+}
+
+SuiteEditor::~SuiteEditor()
+{
+    audioProcessor.removeChangeListener(this);
+    effectEditor.reset();
+    setLookAndFeel(nullptr);
+}
+
+void SuiteEditor::paint(juce::Graphics& g)
+{
+    HYPERPRISM_TRACE_SCOPE("SuiteEditor::paint");
+    g.fillAll(HyperPrismLookAndFeel::Colors::background);
+
+    g.setColour(HyperPrismLookAndFeel::Colors::outline.withAlpha(0.3f));
+    g.drawLine(0.0f, static_cast<float>(headerHeight) - 0.5f,
+               static_cast<float>(getWidth()), static_cast<float>(headerHeight) - 0.5f, 1.0f);
+}
+
+void SuiteEditor::resized()
+{
+    auto bounds = getLocalBounds();
+
+    auto header = bounds.removeFromTop(headerHeight).reduced(12, 6);
+    effectBox.setBounds(header.removeFromRight(200));
+    titleLabel.setBounds(header);
+
+    if (effectEditor != nullptr)
+        effectEditor->setBounds(bounds);
+}
+
+void SuiteEditor::childBoundsChanged(juce::Component* child)
+{
+    if (child == effectEditor.get())
+        setSize(child->getWidth(), child->getHeight() + headerHeight);
+}
+
+//==============================================================================
+void SuiteEditor::changeListenerCallback(juce::ChangeBroadcaster*)
+{
+    showActiveEffect();
+}
+
+void SuiteEditor::showActiveEffect()
+{
+    const int index = audioProcessor.getActiveEffectIndex();
+    effectBox.setSelectedId(index + 1, juce::dontSendNotification);
+
+    if (index == shownEffect)
+        return;
+
+    shownEffect = index;
+    effectEditor.reset();
+
+    if (auto* editor = audioProcessor.getActiveEffect().createEditorIfNeeded())
+    {
+        effectEditor.reset(editor);
+        effectEditor->setTopLeftPosition(0, headerHeight);
+        addAndMakeVisible(*effectEditor);
+        setSize(effectEditor->getWidth(), effectEditor->getHeight() + headerHeight);
+    }
+}
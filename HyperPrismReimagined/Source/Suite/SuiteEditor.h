@@ -0,0 +1,43 @@
+//==============================================================================
+// HyperPrism Reimagined - Suite Editor
+// An effect selector above the active effect's own editor
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SuiteProcessor.h"
+#include "../Shared/HyperPrismLookAndFeel.h"
+
+class SuiteEditor : public juce::AudioProcessorEditor,
+                    private juce::ChangeListener
+{
+public:
+    SuiteEditor(SuiteProcessor&);
+    ~SuiteEditor() override;
+
+    void paint(juce::Graphics&) override;
+    void resized() override;
+
+    // The effect editor sizes itself; the suite follows it
+    void childBoundsChanged(juce::Component* child) override;
+
+private:
+    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
+
+    // Swaps in the active effect's editor after a switch
+    void showActiveEffect();
+
+    static constexpr int headerHeight = 36;
+
+    SuiteProcessor& audioProcessor;
+    HyperPrismLookAndFeel customLookAndFeel;
+
+    juce::Label titleLabel;
+    juce::ComboBox effectBox;
+
+    std::unique_ptr<juce::AudioProcessorEditor> effectEditor;
+    int shownEffect = -1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SuiteEditor)
+};
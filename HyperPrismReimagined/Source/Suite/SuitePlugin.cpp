@@ -0,0 +1,12 @@
+//==============================================================================
+// HyperPrism Reimagined - Suite Plugin Entry Point
+//==============================================================================
+
+#include "SuiteProcessor.h"
+
+//==============================================================================
+// This creates new instances of the plugin..
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new SuiteProcessor();
+}
\ No newline at end of file
@@ -0,0 +1,301 @@
+//==============================================================================
+// HyperPrism Reimagined - Suite Processor
+//==============================================================================
+
+#include "SuiteProcessor.h"
+#include "../Shared/EffectRegistry.h"
+
+#if ! HYPERPRISM_SUITE_HEADLESS
+ #include "SuiteEditor.h"
+#endif
+
+namespace
+{
+    // Set while a host change is being passed to an effect, so the effect's
+    // notification is not sent straight back to the host
+    thread_local bool isForwardingHostChange = false;
+
+    juce::String getForwardedID(juce::AudioProcessorParameter& parameter)
+    {
+        if (auto* hosted = dynamic_cast<juce::HostedAudioProcessorParameter*>(&parameter))
+            return hosted->getParameterID();
+
+        return juce::String(parameter.getParameterIndex());
+    }
+}
+
+//==============================================================================
+SuiteProcessor::ForwardingParameter::ForwardingParameter(const juce::String& name,
+                                                         juce::AudioProcessorParameter& parameterToForward)
+    : HostedAudioProcessorParameter(parameterToForward.getVersionHint()),
+      forwarded(parameterToForward),
+      effectName(name),
+      parameterID(name + "_" + getForwardedID(parameterToForward))
+{
+    forwarded.addListener(this);
+}
+
+void SuiteProcessor::ForwardingParameter::detach()
+{
+    forwarded.removeListener(this);
+}
+
+void SuiteProcessor::ForwardingParameter::setValue(float newValue)
+{
+    // The effect's parameter state and editor only hear about a change through
+    // its listeners, which plain setValue() does not call
+    const juce::ScopedValueSetter<bool> forwarding(isForwardingHostChange, true);
+    forwarded.setValue(newValue);
+    forwarded.sendValueChangedMessageToListeners(newValue);
+}
+
+juce::String SuiteProcessor::ForwardingParameter::getName(int maximumStringLength) const
+{
+    return (effectName + ": " + forwarded.getName(maximumStringLength)).substring(0, maximumStringLength);
+}
+
+juce::String SuiteProcessor::ForwardingParameter::getText(float value, int maximumStringLength) const
+{
+    return forwarded.getText(value, maximumStringLength);
+}
+
+float SuiteProcessor::ForwardingParameter::getValueForText(const juce::String& text) const
+{
+    return forwarded.getValueForText(text);
+}
+
+void SuiteProcessor::ForwardingParameter::parameterValueChanged(int, float newValue)
+{
+    if (! isForwardingHostChange)
+        sendValueChangedMessageToListeners(newValue);
+}
+
+void SuiteProcessor::ForwardingParameter::parameterGestureChanged(int, bool gestureIsStarting)
+{
+    if (gestureIsStarting)
+        beginChangeGesture();
+    else
+        endChangeGesture();
+}
+
+//==============================================================================
+SuiteProcessor::SuiteProcessor()
+    : AudioProcessor(BusesProperties()
+                     .withInput("Input",  juce::AudioChannelSet::stereo(), true)
+                     .withOutput("Output", juce::AudioChannelSet::stereo(), true))
+{
+    for (const auto& info : HyperPrismRegistry::getAllEffects())
+    {
+        auto effect = info.create();
+
+        for (auto* parameter : effect->getParameters())
+            addParameter(new ForwardingParameter(info.name, *parameter));
+
+        effects.push_back(std::move(effect));
+        effectNames.add(info.name);
+    }
+}
+
+SuiteProcessor::~SuiteProcessor()
+{
+    for (auto* parameter : getParameters())
+        static_cast<ForwardingParameter*>(parameter)->detach();
+}
+
+//==============================================================================
+void SuiteProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
+{
+    loadMeter.prepare(sampleRate);
+
+    {
+        const juce::ScopedLock sl(effectLock);
+
+        preparedSampleRate = sampleRate;
+        preparedBlockSize = samplesPerBlock;
+
+        prepareEffect(getActiveEffect());
+    }
+
+    // Effect latencies can depend on the sample rate
+    updateLatency();
+}
+
+void SuiteProcessor::releaseResources()
+{
+    const juce::ScopedLock sl(effectLock);
+    getActiveEffect().releaseResources();
+}
+
+bool SuiteProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    // Several hosted effects are stereo-only
+    return layouts.getMainInputChannelSet() == juce::AudioChannelSet::stereo()
+        && layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
+}
+
+void SuiteProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Suite::processBlock");
+
+    // Claim the active effect, then check it is still active: a switch that
+    // lands in between either sees the claim and waits, or is picked up here
+    auto index = activeEffect.load();
+
+    for (;;)
+    {
+        processingEffect.store(index);
+
+        const auto latest = activeEffect.load();
+        if (latest == index)
+            break;
+
+        index = latest;
+    }
+
+    effects[static_cast<size_t>(index)]->processBlock(buffer, midiMessages);
+
+    processingEffect.store(-1);
+}
+
+double SuiteProcessor::getTailLengthSeconds() const
+{
+    return getActiveEffect().getTailLengthSeconds();
+}
+
+//==============================================================================
+juce::String SuiteProcessor::getEffectName(int index) const
+{
+    return effectNames[index];
+}
+
+const juce::String SuiteProcessor::getProgramName(int index)
+{
+    return getEffectName(index);
+}
+
+juce::AudioProcessor& SuiteProcessor::getActiveEffect() const
+{
+    return *effects[static_cast<size_t>(activeEffect.load())];
+}
+
+void SuiteProcessor::setActiveEffect(int index)
+{
+    if (! juce::isPositiveAndBelow(index, getNumEffects()))
+        return;
+
+    {
+        const juce::ScopedLock sl(effectLock);
+
+        const auto previous = activeEffect.load();
+        if (index == previous)
+            return;
+
+        prepareEffect(*effects[static_cast<size_t>(index)]);
+        activeEffect.store(index);
+
+        // A block that claimed the old effect before the switch finishes with it first
+        while (processingEffect.load() == previous)
+            juce::Thread::yield();
+
+        if (preparedSampleRate > 0.0)
+            effects[static_cast<size_t>(previous)]->releaseResources();
+    }
+
+    updateLatency();
+    updateHostDisplay(ChangeDetails().withProgramChanged(true));
+    sendChangeMessage();
+}
+
+void SuiteProcessor::prepareEffect(juce::AudioProcessor& effect)
+{
+    if (preparedSampleRate <= 0.0)
+        return;
+
+    effect.setPlayConfigDetails(2, 2, preparedSampleRate, preparedBlockSize);
+    effect.setNonRealtime(isNonRealtime());
+    effect.prepareToPlay(preparedSampleRate, preparedBlockSize);
+}
+
+void SuiteProcessor::updateLatency()
+{
+    setLatencySamples(getActiveEffect().getLatencySamples());
+}
+
+//==============================================================================
+juce::AudioProcessorEditor* SuiteProcessor::createEditor()
+{
+   #if HYPERPRISM_SUITE_HEADLESS
+    return nullptr;
+   #else
+    return new SuiteEditor(*this);
+   #endif
+}
+
+//==============================================================================
+void SuiteProcessor::getStateInformation(juce::MemoryBlock& destData)
+{
+    juce::XmlElement xml("HyperPrismSuite");
+    xml.setAttribute("version", 1);
+    xml.setAttribute("effect", getEffectName(getActiveEffectIndex()));
+
+    // Every effect keeps its settings, so switching back finds them unchanged
+    for (size_t i = 0; i < effects.size(); ++i)
+    {
+        juce::MemoryBlock effectState;
+        effects[i]->getStateInformation(effectState);
+
+        auto* effect = xml.createNewChildElement("Effect");
+        effect->setAttribute("name", effectNames[static_cast<int>(i)]);
+        effect->setAttribute("state", effectState.toBase64Encoding());
+    }
+
+    copyXmlToBinary(xml, destData);
+}
+
+void SuiteProcessor::setStateInformation(const void* data, int sizeInBytes)
+{
+    auto xml = getXmlFromBinary(data, sizeInBytes);
+    if (xml == nullptr || ! xml->hasTagName("HyperPrismSuite"))
+        return;
+
+    for (auto* effect : xml->getChildWithTagNameIterator("Effect"))
+    {
+        const auto index = effectNames.indexOf(effect->getStringAttribute("name"), true);
+        if (index < 0)
+            continue;
+
+        juce::MemoryBlock effectState;
+        if (effectState.fromBase64Encoding(effect->getStringAttribute("state")) && effectState.getSize() > 0)
+            effects[static_cast<size_t>(index)]->setStateInformation(effectState.getData(),
+                                                                     static_cast<int>(effectState.getSize()));
+    }
+
+    setActiveEffect(effectNames.indexOf(xml->getStringAttribute("effect"), true));
+}
+
+void SuiteProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+
+    // The baseline: what a standalone plugin of the active effect holds
+    const auto active = getActiveEffectIndex();
+    const auto activeName = effectNames[active];
+
+    if (auto* reporter = dynamic_cast<const HyperPrismMemory::Reporter*>(effects[static_cast<size_t>(active)].get()))
+    {
+        HyperPrismMemory::Footprint effectFootprint;
+        reporter->describeMemory(effectFootprint);
+        footprint.add(activeName, effectFootprint.getTotalBytes());
+
+        for (const auto& untracked : effectFootprint.getUntrackedNames())
+            footprint.addUntracked(activeName + " " + untracked);
+    }
+
+    // What the Suite adds to it. Idle effects are released, so their own
+    // reports (sized for a prepared instance) do not apply; what they still
+    // hold, their objects and parameter trees first, only a heap measurement
+    // sees.
+    footprint.add("suite: forwarding parameters", getParameters().size() * sizeof(ForwardingParameter));
+    footprint.addUntracked("suite: " + juce::String(getNumEffects() - 1) + " idle effects");
+}
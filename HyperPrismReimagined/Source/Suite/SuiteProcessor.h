@@ -0,0 +1,157 @@
+//==============================================================================
+// HyperPrism Reimagined - Suite Processor
+// All 32 effects in one plugin: the host scans a single bundle, the code and
+// shared resources are loaded once, and any effect can be picked per instance
+// from the program list or the editor
+//==============================================================================
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/HyperPrismTrace.h"
+
+class SuiteProcessor : public juce::AudioProcessor,
+                       public HyperPrismMemory::Reporter,
+                       public juce::ChangeBroadcaster
+{
+public:
+    //==============================================================================
+    SuiteProcessor();
+    ~SuiteProcessor() override;
+
+    //==============================================================================
+    void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
+
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    //==============================================================================
+    juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_SUITE_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
+    bool hasEditor() const override { return true; }
+   #endif
+
+    //==============================================================================
+    const juce::String getName() const override { return "HyperPrism Reimagined Suite"; }
+
+    bool acceptsMidi() const override { return false; }
+    bool producesMidi() const override { return false; }
+    bool isMidiEffect() const override { return false; }
+    double getTailLengthSeconds() const override;
+
+    //==============================================================================
+    // One program per effect, in registry order
+    int getNumPrograms() override { return getNumEffects(); }
+    int getCurrentProgram() override { return getActiveEffectIndex(); }
+    void setCurrentProgram(int index) override { setActiveEffect(index); }
+    const juce::String getProgramName(int index) override;
+    void changeProgramName(int, const juce::String&) override {}
+
+    //==============================================================================
+    void getStateInformation(juce::MemoryBlock& destData) override;
+    void setStateInformation(const void* data, int sizeInBytes) override;
+
+    //==============================================================================
+    // Every effect exists from construction so its parameters can be exposed to
+    // the host, but only the active one is prepared and processed. Switching
+    // prepares the new effect before the audio thread sees it and releases the
+    // old one once the audio thread has left it. Call from any thread but the
+    // audio thread; listeners get a change message after every switch.
+    //
+    // Per instance that costs, beyond a standalone plugin of the active effect,
+    // the 31 idle effect objects with their parameter trees, and one forwarding
+    // parameter per effect parameter (about 300). An effect that has never been
+    // active holds no sample buffers and its coefficient caches have not joined
+    // the shared thread; one switched away from keeps whatever its
+    // releaseResources does not free (Echo, Single Delay and Multi Delay free
+    // their delay lines). describeMemory lists the overhead apart from the
+    // active effect, and HyperPrismBench --memory --suite measures it.
+    int getNumEffects() const noexcept { return static_cast<int>(effects.size()); }
+    int getActiveEffectIndex() const noexcept { return activeEffect.load(); }
+    juce::String getEffectName(int index) const;
+
+    void setActiveEffect(int index);
+    juce::AudioProcessor& getActiveEffect() const;
+
+    // DSP load measured in processBlock
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
+private:
+    //==============================================================================
+    // A host parameter that stands in for one parameter of one effect, so the
+    // suite exposes every effect's parameters under "<Effect>_<id>" IDs. Host
+    // changes go to the effect; edits made in the effect's own editor come
+    // back to the host, gestures included.
+    class ForwardingParameter : public juce::HostedAudioProcessorParameter,
+                                private juce::AudioProcessorParameter::Listener
+    {
+    public:
+        ForwardingParameter(const juce::String& effectName, juce::AudioProcessorParameter& parameterToForward);
+
+        // Stops listening to the effect's parameter. The effects are members, so
+        // they go before the base class deletes these; the owner calls this first.
+        void detach();
+
+        juce::String getParameterID() const override { return parameterID; }
+
+        float getValue() const override { return forwarded.getValue(); }
+        void setValue(float newValue) override;
+        float getDefaultValue() const override { return forwarded.getDefaultValue(); }
+
+        juce::String getName(int maximumStringLength) const override;
+        juce::String getLabel() const override { return forwarded.getLabel(); }
+        juce::String getText(float value, int maximumStringLength) const override;
+        float getValueForText(const juce::String& text) const override;
+
+        int getNumSteps() const override { return forwarded.getNumSteps(); }
+        bool isDiscrete() const override { return forwarded.isDiscrete(); }
+        bool isBoolean() const override { return forwarded.isBoolean(); }
+        bool isAutomatable() const override { return forwarded.isAutomatable(); }
+        bool isOrientationInverted() const override { return forwarded.isOrientationInverted(); }
+        bool isMetaParameter() const override { return forwarded.isMetaParameter(); }
+        Category getCategory() const override { return forwarded.getCategory(); }
+        juce::StringArray getAllValueStrings() const override { return forwarded.getAllValueStrings(); }
+
+    private:
+        void parameterValueChanged(int parameterIndex, float newValue) override;
+        void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override;
+
+        juce::AudioProcessorParameter& forwarded;
+        const juce::String effectName;
+        const juce::String parameterID;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ForwardingParameter)
+    };
+
+    // Prepares an effect the audio thread is not using. Called with effectLock held.
+    void prepareEffect(juce::AudioProcessor& effect);
+    void updateLatency();
+
+    std::vector<std::unique_ptr<juce::AudioProcessor>> effects;
+    juce::StringArray effectNames;
+
+    // activeEffect is what the next block processes; processingEffect is what
+    // the audio thread is inside right now, or -1 between blocks
+    std::atomic<int> activeEffect { 0 };
+    std::atomic<int> processingEffect { -1 };
+
+    // Guards the prepared settings against prepareToPlay and releaseResources
+    // arriving on another thread during a switch
+    juce::CriticalSection effectLock;
+    double preparedSampleRate = 0.0;
+    int preparedBlockSize = 0;
+
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SuiteProcessor)
+};
@@ -5,6 +5,8 @@
 
 #include "TremoloEditor.h"
 
+namespace HyperPrismTremoloUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -185,6 +187,7 @@ void TremoloMeter::paint(juce::Graphics& g)
 
 void TremoloMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("TremoloMeter::timerCallback");
     // Get current parameter values from processor
     auto& apvts = processor.getValueTreeState();
     
@@ -236,9 +239,10 @@ void TremoloMeter::timerCallback()
 // TremoloEditor Implementation
 //==============================================================================
 TremoloEditor::TremoloEditor(TremoloProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), tremoloMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), tremoloMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(TremoloProcessor::RATE_ID);
@@ -371,6 +375,7 @@ TremoloEditor::~TremoloEditor()
 
 void TremoloEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("TremoloEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
     g.setColour(HyperPrismLookAndFeel::Colors::primary.withAlpha(0.4f));
     g.fillRect(12, 4, getWidth() - 24, 2);
@@ -406,7 +411,7 @@ void TremoloEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -699,4 +704,6 @@ void TremoloEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismTremoloUI
\ No newline at end of file
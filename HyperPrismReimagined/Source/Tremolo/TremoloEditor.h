@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "TremoloProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismTremoloUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -156,5 +159,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TremoloEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismTremoloUI
+
+using HyperPrismTremoloUI::TremoloEditor;
\ No newline at end of file
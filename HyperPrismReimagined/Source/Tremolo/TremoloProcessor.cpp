@@ -3,15 +3,34 @@
 //==============================================================================
 
 #include "TremoloProcessor.h"
-#include "TremoloEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "TremoloEditor.h"
+#endif
+
+namespace
+{
+    using Param = TremoloProcessor::Param;
+    using namespace HyperPrismParameters;
+
+    constexpr Table<Param> parameterTable {{{
+        boolParameter(Param::bypass, "bypass", "Bypass", false),
+        floatParameter(Param::rate, "rate", "Rate", 0.1f, 20.0f, 0.01f, 0.5f, 2.0f, 2, " Hz"),
+        floatParameter(Param::depth, "depth", "Depth", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, 1, " %"),
+        choiceParameter(Param::waveform, "waveform", "Waveform", "Sine|Triangle|Square", 0),
+        floatParameter(Param::stereoPhase, "stereoPhase", "Stereo Phase", 0.0f, 180.0f, 1.0f, 1.0f, 90.0f, Spec::integerText, " deg"),
+        floatParameter(Param::mix, "mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 100.0f, 1, " %")
+    }}};
+
+    static_assert(parameterTable.isValid(), "Tremolo parameter table out of step with TremoloProcessor::Param");
+}
 
 // Parameter IDs
-const juce::String TremoloProcessor::BYPASS_ID = "bypass";
-const juce::String TremoloProcessor::RATE_ID = "rate";
-const juce::String TremoloProcessor::DEPTH_ID = "depth";
-const juce::String TremoloProcessor::WAVEFORM_ID = "waveform";
-const juce::String TremoloProcessor::STEREO_PHASE_ID = "stereoPhase";
-const juce::String TremoloProcessor::MIX_ID = "mix";
+const juce::String TremoloProcessor::BYPASS_ID = parameterTable[Param::bypass].id;
+const juce::String TremoloProcessor::RATE_ID = parameterTable[Param::rate].id;
+const juce::String TremoloProcessor::DEPTH_ID = parameterTable[Param::depth].id;
+const juce::String TremoloProcessor::WAVEFORM_ID = parameterTable[Param::waveform].id;
+const juce::String TremoloProcessor::STEREO_PHASE_ID = parameterTable[Param::stereoPhase].id;
+const juce::String TremoloProcessor::MIX_ID = parameterTable[Param::mix].id;
 
 //==============================================================================
 TremoloProcessor::TremoloProcessor()
@@ -25,7 +44,8 @@ TremoloProcessor::TremoloProcessor()
                      #endif
                        ),
 #endif
-    valueTreeState(*this, nullptr, "PARAMETERS", createParameterLayout())
+    valueTreeState(*this, nullptr, "PARAMETERS", HyperPrismParameters::createLayout(parameterTable)),
+    parameterValues(valueTreeState, parameterTable)
 {
 }
 
@@ -36,7 +56,7 @@ TremoloProcessor::~TremoloProcessor()
 //==============================================================================
 const juce::String TremoloProcessor::getName() const
 {
-    return JucePlugin_Name;
+    return "HyperPrism Reimagined Tremolo";
 }
 
 bool TremoloProcessor::acceptsMidi() const
@@ -97,32 +117,35 @@ void TremoloProcessor::changeProgramName(int, const juce::String&)
 //==============================================================================
 void TremoloProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare LFOs
     lfoLeft.prepare(sampleRate);
     lfoRight.prepare(sampleRate);
     
-    // Initialize smoothed values
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+
+    // Initialize parameter ramps
     const float smoothTime = 0.02f; // 20ms smoothing
-    rateSmoothed.reset(sampleRate, smoothTime);
-    depthSmoothed.reset(sampleRate, smoothTime);
-    mixSmoothed.reset(sampleRate, smoothTime);
+    rateRamp.prepare(sampleRate, smoothTime, scratchCapacity);
+    depthRamp.prepare(sampleRate, smoothTime, scratchCapacity);
+    mixRamp.prepare(sampleRate, smoothTime, scratchCapacity);
     
     // Set initial values
-    rateSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(RATE_ID));
-    depthSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(DEPTH_ID));
-    mixSmoothed.setCurrentAndTargetValue(*valueTreeState.getRawParameterValue(MIX_ID));
+    rateRamp.setCurrentAndTarget(parameterValues.get(Param::rate));
+    depthRamp.setCurrentAndTarget(parameterValues.get(Param::depth));
+    mixRamp.setCurrentAndTarget(parameterValues.get(Param::mix) * 0.01f);
     
     // Reset LFO phases
     lfoLeft.reset();
     lfoRight.reset();
     
     // Set stereo phase offset for right channel
-    float stereoPhase = *valueTreeState.getRawParameterValue(STEREO_PHASE_ID) / 360.0f;
+    float stereoPhase = parameterValues.get(Param::stereoPhase) / 360.0f;
     lfoRight.setPhase(stereoPhase);
 
-    dryBuffer.setSize(getTotalNumInputChannels(), samplesPerBlock);
+    dryBuffer.setSize(getTotalNumInputChannels(), scratchCapacity);
 }
 
 void TremoloProcessor::releaseResources()
@@ -152,8 +175,13 @@ bool TremoloProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 }
 #endif
 
-void TremoloProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void TremoloProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Tremolo::processBlock");
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumInputChannels  = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -161,27 +189,33 @@ void TremoloProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    const auto values = parameterValues.snapshot();
+
     // Check bypass
-    if (*valueTreeState.getRawParameterValue(BYPASS_ID) > 0.5f)
+    if (values.isOn(Param::bypass))
         return;
 
-    // Update smoothed parameters
-    rateSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(RATE_ID));
-    depthSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(DEPTH_ID));
-    mixSmoothed.setTargetValue(*valueTreeState.getRawParameterValue(MIX_ID));
+    // Render this block's parameter ramps, shared by both channels
+    const int numSamples = buffer.getNumSamples();
+    rateRamp.setTarget(values[Param::rate]);
+    depthRamp.setTarget(values[Param::depth]);
+    mixRamp.setTarget(values[Param::mix] * 0.01f); // Convert to 0-1
+
+    const auto* rates = rateRamp.process(numSamples);
+    const auto* depths = depthRamp.process(numSamples);
+    const auto* mixes = mixRamp.process(numSamples);
     
     // Get waveform and stereo phase
-    const auto waveform = static_cast<Waveform>(static_cast<int>(*valueTreeState.getRawParameterValue(WAVEFORM_ID)));
-    const float stereoPhase = *valueTreeState.getRawParameterValue(STEREO_PHASE_ID) / 360.0f;
+    const auto waveform = static_cast<Waveform>(static_cast<int>(values[Param::waveform]));
+    const float stereoPhase = values[Param::stereoPhase] / 360.0f;
     
     // Store dry signal for mixing
-    dryBuffer.makeCopyOf(buffer);
+    dryBuffer.makeCopyOf(buffer, true);
     
     // Process each channel
     for (int channel = 0; channel < totalNumOutputChannels; ++channel)
     {
         auto* channelData = buffer.getWritePointer(channel);
-        auto* dryData = dryBuffer.getReadPointer(channel);
         
         // Choose LFO based on channel
         LFO& lfo = (channel == 0) ? lfoLeft : lfoRight;
@@ -193,15 +227,12 @@ void TremoloProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
             lfo.setPhase(std::fmod(currentPhase + stereoPhase, 1.0f));
         }
         
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+        for (int sample = 0; sample < numSamples; ++sample)
         {
-            // Get smoothed parameters
-            const float rate = rateSmoothed.getNextValue();
-            const float depth = depthSmoothed.getNextValue() * 0.01f; // Convert to 0-1
-            const float mix = mixSmoothed.getNextValue() * 0.01f; // Convert to 0-1
+            const float depth = depths[sample] * 0.01f; // Convert to 0-1
             
             // Generate LFO value
-            float lfoValue = lfo.process(rate, waveform);
+            float lfoValue = lfo.process(rates[sample], waveform);
             
             // Convert bipolar LFO (-1 to 1) to unipolar amplitude modulation (0 to 1)
             // At depth = 0%, amplitude stays at 1.0
@@ -209,10 +240,7 @@ void TremoloProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
             float amplitude = 1.0f - (depth * 0.5f * (1.0f - lfoValue));
             
             // Apply tremolo effect
-            float wetSignal = channelData[sample] * amplitude;
-            
-            // Mix dry and wet signals
-            channelData[sample] = dryData[sample] * (1.0f - mix) + wetSignal * mix;
+            channelData[sample] *= amplitude;
         }
         
         // Keep LFOs in sync after processing
@@ -221,17 +249,28 @@ void TremoloProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
             lfoRight.setPhase(std::fmod(lfo.getPhase() + stereoPhase, 1.0f));
         }
     }
+
+    // Mix dry and wet signals
+    HyperPrismLargeBlocks::mixDryWet(buffer, dryBuffer, totalNumOutputChannels, numSamples, mixes, mixRamp.isConstant());
 }
 
 //==============================================================================
 bool TremoloProcessor::hasEditor() const
 {
+   #if HYPERPRISM_HEADLESS
+    return false;
+   #else
     return true;
+   #endif
 }
 
 juce::AudioProcessorEditor* TremoloProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new TremoloEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -250,41 +289,9 @@ void TremoloProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-//==============================================================================
-juce::AudioProcessorValueTreeState::ParameterLayout TremoloProcessor::createParameterLayout()
+void TremoloProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
 {
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
-        BYPASS_ID, "Bypass", false));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        RATE_ID, "Rate", 
-        juce::NormalisableRange<float>(0.1f, 20.0f, 0.01f, 0.5f), 2.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 2) + " Hz"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        DEPTH_ID, "Depth", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 50.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterChoice>(
-        WAVEFORM_ID, "Waveform", 
-        juce::StringArray{ "Sine", "Triangle", "Square" }, 0));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        STEREO_PHASE_ID, "Stereo Phase", 
-        juce::NormalisableRange<float>(0.0f, 180.0f, 1.0f), 90.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(static_cast<int>(value)) + " deg"; }));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(
-        MIX_ID, "Mix", 
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 100.0f,
-        juce::String(), juce::AudioProcessorParameter::genericParameter,
-        [](float value, int) { return juce::String(value, 1) + " %"; }));
-
-    return { parameters.begin(), parameters.end() };
-}
\ No newline at end of file
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("dry buffer", dryBuffer);
+    footprint.add("parameter ramps", rateRamp.getAllocatedBytes() + depthRamp.getAllocatedBytes() + mixRamp.getAllocatedBytes());
+}
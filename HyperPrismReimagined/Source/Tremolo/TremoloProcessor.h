@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
-
-class TremoloProcessor : public juce::AudioProcessor
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/ParameterTable.h"
+#include "../DSP/ParameterRamp.h"
+
+class TremoloProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -57,6 +63,9 @@ public:
     static const juce::String STEREO_PHASE_ID;
     static const juce::String MIX_ID;
 
+    // Parameters in layout order, indexing the table in TremoloProcessor.cpp
+    enum class Param { bypass, rate, depth, waveform, stereoPhase, mix, count };
+
     // Waveform types
     enum class Waveform
     {
@@ -65,9 +74,16 @@ public:
         Square
     };
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState valueTreeState;
+    HyperPrismParameters::Values<Param> parameterValues;
     
     // LFO implementation
     class LFO
@@ -123,16 +139,18 @@ private:
     LFO lfoLeft;
     LFO lfoRight;
     
-    // Parameter smoothing
-    juce::SmoothedValue<float> rateSmoothed;
-    juce::SmoothedValue<float> depthSmoothed;
-    juce::SmoothedValue<float> mixSmoothed;
+    // Parameter ramps, rendered once per block
+    HyperPrismDSP::ParameterRamp rateRamp;
+    HyperPrismDSP::ParameterRamp depthRamp;
+    HyperPrismDSP::ParameterRamp mixRamp;
     
     double currentSampleRate = 44100.0;
 
     juce::AudioBuffer<float> dryBuffer;
+    int scratchCapacity = 0;            // Samples of scratch prepared; longer blocks are sliced
 
-    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TremoloProcessor)
 };
\ No newline at end of file
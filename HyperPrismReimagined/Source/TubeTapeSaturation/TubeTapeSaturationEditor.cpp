@@ -5,6 +5,8 @@
 
 #include "TubeTapeSaturationEditor.h"
 
+namespace HyperPrismTubeTapeSaturationUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -240,6 +242,7 @@ void SaturationMeter::paint(juce::Graphics& g)
 
 void SaturationMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("SaturationMeter::timerCallback");
     // Get current harmonic content from processor
     harmonicContent = processor.getHarmonicContent();
     
@@ -296,9 +299,10 @@ void SaturationMeter::timerCallback()
 // TubeTapeSaturationEditor Implementation
 //==============================================================================
 TubeTapeSaturationEditor::TubeTapeSaturationEditor(TubeTapeSaturationProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), saturationMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), saturationMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(TubeTapeSaturationProcessor::DRIVE_ID);
@@ -431,6 +435,7 @@ TubeTapeSaturationEditor::~TubeTapeSaturationEditor()
 
 void TubeTapeSaturationEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("TubeTapeSaturationEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -474,7 +479,7 @@ void TubeTapeSaturationEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -772,4 +777,6 @@ void TubeTapeSaturationEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismTubeTapeSaturationUI
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "TubeTapeSaturationProcessor.h"
-#include "TubeTapeSaturationEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "TubeTapeSaturationEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String TubeTapeSaturationProcessor::BYPASS_ID = "bypass";
@@ -18,7 +20,9 @@ TubeTapeSaturationProcessor::TubeTapeSaturationProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input",  juce::AudioChannelSet::stereo(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      shapingFilters(valueTreeState, { WARMTH_ID, BRIGHTNESS_ID },
+                     [this](double sampleRate) { return makeShapingFilters(sampleRate); })
 {
     // Cache parameter pointers for performance
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -76,7 +80,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout TubeTapeSaturationProcessor:
 //==============================================================================
 void TubeTapeSaturationProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused(samplesPerBlock);
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Initialize filters
@@ -85,7 +89,15 @@ void TubeTapeSaturationProcessor::prepareToPlay(double sampleRate, int samplesPe
     dcBlockRight.setCoefficients(dcBlockCoeffs);
     
     // Initialize shelf filters for warmth and brightness
-    updateFilters();
+    shapingFilters.prepare(sampleRate);
+    lowShelfLeft.setCoefficients(shapingFilters.get().lowShelf);
+    lowShelfRight.setCoefficients(shapingFilters.get().lowShelf);
+    highShelfLeft.setCoefficients(shapingFilters.get().highShelf);
+    highShelfRight.setCoefficients(shapingFilters.get().highShelf);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    outputGainRamp.prepare(sampleRate, 0.005, scratchCapacity); // 5ms
+    outputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset processing state
     previousInputRMS = 0.0f;
@@ -116,8 +128,13 @@ bool TubeTapeSaturationProcessor::isBusesLayoutSupported(const BusesLayout& layo
     return true;
 }
 
-void TubeTapeSaturationProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void TubeTapeSaturationProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("TubeTapeSaturation::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -129,13 +146,23 @@ void TubeTapeSaturationProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    updateFilters();
+    // Glide to shelf coefficients published since the last block
+    if (shapingFilters.update(isNonRealtime()))
+    {
+        const auto& coefficients = shapingFilters.get();
+        lowShelfLeft.rampTo(coefficients.lowShelf, HyperPrismCoefficients::rampSamples);
+        lowShelfRight.rampTo(coefficients.lowShelf, HyperPrismCoefficients::rampSamples);
+        highShelfLeft.rampTo(coefficients.highShelf, HyperPrismCoefficients::rampSamples);
+        highShelfRight.rampTo(coefficients.highShelf, HyperPrismCoefficients::rampSamples);
+    }
+
     processSaturation(buffer);
     calculateHarmonicContent(buffer);
 }
 
 void TubeTapeSaturationProcessor::processSaturation(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("TubeTapeSaturation::processSaturation");
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
     
@@ -155,7 +182,8 @@ void TubeTapeSaturationProcessor::processSaturation(juce::AudioBuffer<float>& bu
     const int type = static_cast<int>(typeParam->load());
     const float warmth = warmthParam->load() / 100.0f;
     const float brightness = brightnessParam->load() / 100.0f;
-    const float outputGain = juce::Decibels::decibelsToGain(outputLevelParam->load());
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* outputGains = outputGainRamp.process(numSamples);
     
     for (int channel = 0; channel < numChannels; ++channel)
     {
@@ -169,8 +197,8 @@ void TubeTapeSaturationProcessor::processSaturation(juce::AudioBuffer<float>& bu
             float input = channelData[sample];
             
             // Pre-filtering for warmth and brightness shaping
-            float processed = lowShelf.processSingleSampleRaw(input);
-            processed = highShelf.processSingleSampleRaw(processed);
+            float processed = lowShelf.processSample(input);
+            processed = highShelf.processSample(processed);
             
             // Apply saturation based on type
             switch (type)
@@ -190,34 +218,25 @@ void TubeTapeSaturationProcessor::processSaturation(juce::AudioBuffer<float>& bu
             processed = dcBlock.processSingleSampleRaw(processed);
             
             // Output level adjustment
-            channelData[sample] = processed * outputGain;
+            channelData[sample] = processed * outputGains[sample];
         }
     }
 }
 
-void TubeTapeSaturationProcessor::updateFilters()
+TubeTapeSaturationProcessor::ShapingFilters TubeTapeSaturationProcessor::makeShapingFilters(double sampleRate) const
 {
     const float warmth = warmthParam->load() / 100.0f;
     const float brightness = brightnessParam->load() / 100.0f;
-    
-    if (std::abs(warmth - previousWarmth) > 0.001f ||
-        std::abs(brightness - previousBrightness) > 0.001f)
-    {
-        // Warmth control - low shelf filter (80Hz)
-        float warmthGain = juce::jmap(warmth, 0.0f, 1.0f, -6.0f, 6.0f);
-        auto lowShelfCoeffs = juce::IIRCoefficients::makeLowShelf(currentSampleRate, 80.0, 0.7, juce::Decibels::decibelsToGain(warmthGain));
-        lowShelfLeft.setCoefficients(lowShelfCoeffs);
-        lowShelfRight.setCoefficients(lowShelfCoeffs);
-        
-        // Brightness control - high shelf filter (8kHz)
-        float brightnessGain = juce::jmap(brightness, 0.0f, 1.0f, -6.0f, 6.0f);
-        auto highShelfCoeffs = juce::IIRCoefficients::makeHighShelf(currentSampleRate, 8000.0, 0.7, juce::Decibels::decibelsToGain(brightnessGain));
-        highShelfLeft.setCoefficients(highShelfCoeffs);
-        highShelfRight.setCoefficients(highShelfCoeffs);
-        
-        previousWarmth = warmth;
-        previousBrightness = brightness;
-    }
+
+    // Warmth control - low shelf filter (80Hz)
+    float warmthGain = juce::jmap(warmth, 0.0f, 1.0f, -6.0f, 6.0f);
+    auto lowShelfCoeffs = juce::IIRCoefficients::makeLowShelf(sampleRate, 80.0, 0.7, juce::Decibels::decibelsToGain(warmthGain));
+
+    // Brightness control - high shelf filter (8kHz)
+    float brightnessGain = juce::jmap(brightness, 0.0f, 1.0f, -6.0f, 6.0f);
+    auto highShelfCoeffs = juce::IIRCoefficients::makeHighShelf(sampleRate, 8000.0, 0.7, juce::Decibels::decibelsToGain(brightnessGain));
+
+    return { HyperPrismCoefficients::fromJuce(lowShelfCoeffs), HyperPrismCoefficients::fromJuce(highShelfCoeffs) };
 }
 
 void TubeTapeSaturationProcessor::calculateHarmonicContent(const juce::AudioBuffer<float>& buffer)
@@ -391,7 +410,11 @@ float TubeTapeSaturationProcessor::tanhSaturation(float input, float amount)
 //==============================================================================
 juce::AudioProcessorEditor* TubeTapeSaturationProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new TubeTapeSaturationEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -406,4 +429,10 @@ void TubeTapeSaturationProcessor::setStateInformation(const void* data, int size
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void TubeTapeSaturationProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("parameter ramps", outputGainRamp.getAllocatedBytes());
 }
\ No newline at end of file
@@ -5,8 +5,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/ParameterRamp.h"
 
-class TubeTapeSaturationProcessor : public juce::AudioProcessor
+class TubeTapeSaturationProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     TubeTapeSaturationProcessor();
@@ -20,7 +26,11 @@ public:
     
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
     
     // Program/State
     const juce::String getName() const override { return "HyperPrism Reimagined Tube/Tape Saturation"; }
@@ -64,13 +74,27 @@ public:
         Transformer
     };
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
+    // Warmth and brightness shelves, designed off the audio thread
+    struct ShapingFilters
+    {
+        HyperPrismDSP::BiquadCoefficients lowShelf;
+        HyperPrismDSP::BiquadCoefficients highShelf;
+    };
+
+    ShapingFilters makeShapingFilters(double sampleRate) const;
+
     // Audio processing
     void processSaturation(juce::AudioBuffer<float>& buffer);
-    void updateFilters();
     void calculateHarmonicContent(const juce::AudioBuffer<float>& buffer);
     
     // Saturation algorithms
@@ -87,8 +111,13 @@ private:
     juce::AudioProcessorValueTreeState valueTreeState;
     
     // DSP components for warmth and brightness shaping
-    juce::IIRFilter lowShelfLeft, lowShelfRight;   // For warmth control
-    juce::IIRFilter highShelfLeft, highShelfRight; // For brightness control
+    HyperPrismDSP::Biquad lowShelfLeft, lowShelfRight;   // For warmth control
+    HyperPrismDSP::Biquad highShelfLeft, highShelfRight; // For brightness control
+    HyperPrismCoefficients::Cache<ShapingFilters> shapingFilters;
+
+    // Output level ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp outputGainRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Cached parameters
     std::atomic<float>* bypassParam = nullptr;
@@ -100,8 +129,6 @@ private:
     
     // Processing state
     double currentSampleRate = 44100.0;
-    float previousWarmth = -1.0f;
-    float previousBrightness = -1.0f;
     
     // Harmonic content analysis
     std::atomic<float> harmonicContent { 0.0f };
@@ -113,5 +140,11 @@ private:
     // DC blocking filters
     juce::IIRFilter dcBlockLeft, dcBlockRight;
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    // Kernel micro-benchmarks (Source/Bench/KernelBenchmark.cpp)
+    friend struct HyperPrismKernelAccess;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TubeTapeSaturationProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "VibratoEditor.h"
 
+namespace HyperPrismVibratoUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -217,6 +219,7 @@ void VibratoMeter::paint(juce::Graphics& g)
 
 void VibratoMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("VibratoMeter::timerCallback");
     // Read actual parameter values from the processor
     auto& apvts = processor.getValueTreeState();
     
@@ -258,9 +261,10 @@ void VibratoMeter::timerCallback()
 // VibratoEditor Implementation
 //==============================================================================
 VibratoEditor::VibratoEditor(VibratoProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), vibratoMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), vibratoMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(VibratoProcessor::RATE_ID);
@@ -406,6 +410,7 @@ VibratoEditor::~VibratoEditor()
 
 void VibratoEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("VibratoEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -452,7 +457,7 @@ void VibratoEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -732,4 +737,6 @@ void VibratoEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismVibratoUI
\ No newline at end of file
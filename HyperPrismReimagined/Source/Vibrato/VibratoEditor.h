@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "VibratoProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismVibratoUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -157,5 +160,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VibratoEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismVibratoUI
+
+using HyperPrismVibratoUI::VibratoEditor;
\ No newline at end of file
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include "VibratoProcessor.h"
-#include "VibratoEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "VibratoEditor.h"
+#endif
 
 // Parameter IDs
 const juce::String VibratoProcessor::BYPASS_ID = "bypass";
@@ -58,16 +60,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout VibratoProcessor::createPara
     return { parameters.begin(), parameters.end() };
 }
 
-void VibratoProcessor::prepareToPlay(double sampleRate, int /*samplesPerBlock*/)
+void VibratoProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    loadMeter.prepare(sampleRate);
     currentSampleRate = sampleRate;
     
     // Prepare delay lines (max 100ms for vibrato)
-    leftDelayLine.prepare(sampleRate, 100.0f);
-    rightDelayLine.prepare(sampleRate, 100.0f);
+    const auto maxDelaySamples = static_cast<int>(0.1 * sampleRate);
+    leftDelayLine.prepare(maxDelaySamples);
+    rightDelayLine.prepare(maxDelaySamples);
     
     // Initialize LFO phase
-    lfoPhase = 0.0f;
+    lfo.setPhase(0.0f);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    mixRamp.prepare(sampleRate, 0.02, scratchCapacity); // 20ms
+    mixRamp.setCurrentAndTarget(mixParam->load());
 }
 
 void VibratoProcessor::releaseResources()
@@ -85,8 +93,13 @@ bool VibratoProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
            layouts.getMainOutputChannelSet() == juce::AudioChannelSet::mono();
 }
 
-void VibratoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+void VibratoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Vibrato::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -106,6 +119,7 @@ void VibratoProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
 
 void VibratoProcessor::processVibrato(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Vibrato::processVibrato");
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
     
@@ -113,34 +127,38 @@ void VibratoProcessor::processVibrato(juce::AudioBuffer<float>& buffer)
         return;
     
     // Get parameter values
-    float mix = mixParam->load();
+    mixRamp.setTarget(mixParam->load());
+    const auto* mixes = mixRamp.process(numSamples);
     float rate = rateParam->load();
     float depth = depthParam->load() / 100.0f;  // Convert percentage to 0-1
     float baseDelayMs = delayParam->load();
     float feedback = feedbackParam->load() / 100.0f;  // Convert percentage to -0.95 to 0.95
     
-    // Calculate LFO increment
-    float lfoIncrement = (rate * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+    // Set LFO rate
+    lfo.setFrequency(rate, currentSampleRate);
+    const float samplesPerMs = static_cast<float>(currentSampleRate) / 1000.0f;
     
     // Calculate depth in milliseconds (50 cents = ~3% pitch change = ~30ms at 1kHz)
     float depthMs = depth * 3.0f;  // Scale depth to reasonable delay modulation range
     
+    auto channelLfo = lfo;
+
     // Process each channel
     for (int channel = 0; channel < numChannels; ++channel)
     {
         auto* channelData = buffer.getWritePointer(channel);
         
         // Get the appropriate delay line
-        VibratoDelayLine* delayLine = (channel == 0) ? &leftDelayLine : &rightDelayLine;
+        auto& delayLine = (channel == 0) ? leftDelayLine : rightDelayLine;
         
         // Reset LFO phase for each channel to maintain sync
-        float channelLfoPhase = lfoPhase;
+        channelLfo = lfo;
         
         // Process each sample
         for (int sample = 0; sample < numSamples; ++sample)
         {
             // Calculate LFO value
-            float lfoValue = std::sin(channelLfoPhase);
+            float lfoValue = channelLfo.getNextSample();
             
             // Calculate modulated delay time
             float modulatedDelay = baseDelayMs + (lfoValue * depthMs);
@@ -150,27 +168,25 @@ void VibratoProcessor::processVibrato(juce::AudioBuffer<float>& buffer)
             
             // Process through delay line
             float input = channelData[sample];
-            float vibratoOutput = delayLine->processSample(input, modulatedDelay, feedback);
+            float vibratoOutput = delayLine.readCubic(modulatedDelay * samplesPerMs);
+            delayLine.push(input + (vibratoOutput * feedback));
             
             // Mix wet and dry signals
-            channelData[sample] = input * (1.0f - mix) + vibratoOutput * mix;
-            
-            // Advance LFO phase
-            channelLfoPhase += lfoIncrement;
-            if (channelLfoPhase >= juce::MathConstants<float>::twoPi)
-                channelLfoPhase -= juce::MathConstants<float>::twoPi;
+            channelData[sample] = input * (1.0f - mixes[sample]) + vibratoOutput * mixes[sample];
         }
     }
     
     // Update the main LFO phase
-    lfoPhase += lfoIncrement * numSamples;
-    while (lfoPhase >= juce::MathConstants<float>::twoPi)
-        lfoPhase -= juce::MathConstants<float>::twoPi;
+    lfo = channelLfo;
 }
 
 juce::AudioProcessorEditor* VibratoProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new VibratoEditor(*this);
+   #endif
 }
 
 void VibratoProcessor::getStateInformation(juce::MemoryBlock& destData)
@@ -188,69 +204,9 @@ void VibratoProcessor::setStateInformation(const void* data, int sizeInBytes)
             valueTreeState.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-// VibratoDelayLine implementation
-void VibratoProcessor::VibratoDelayLine::prepare(double sampleRate, float maxDelayMs)
+void VibratoProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
 {
-    this->sampleRate = sampleRate;
-    maxDelaySamples = static_cast<int>((maxDelayMs / 1000.0f) * sampleRate) + 1;
-    buffer.setSize(1, maxDelaySamples);
-    reset();
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("delay lines", leftDelayLine.getAllocatedBytes() + rightDelayLine.getAllocatedBytes());
+    footprint.add("parameter ramps", mixRamp.getAllocatedBytes());
 }
-
-void VibratoProcessor::VibratoDelayLine::reset()
-{
-    buffer.clear();
-    writeIndex = 0;
-}
-
-float VibratoProcessor::VibratoDelayLine::processSample(float input, float delayMs, float feedback)
-{
-    if (maxDelaySamples == 0)
-        return input;
-    
-    // Convert delay time to samples
-    float delaySamples = (delayMs / 1000.0f) * static_cast<float>(sampleRate);
-    delaySamples = juce::jlimit(0.0f, static_cast<float>(maxDelaySamples - 1), delaySamples);
-    
-    // Calculate read position with fractional delay
-    float readPosition = writeIndex - delaySamples;
-    if (readPosition < 0.0f)
-        readPosition += maxDelaySamples;
-    
-    // Cubic interpolation for better quality pitch shifting
-    int readIndex0 = static_cast<int>(readPosition - 1.0f);
-    int readIndex1 = static_cast<int>(readPosition);
-    int readIndex2 = static_cast<int>(readPosition + 1.0f);
-    int readIndex3 = static_cast<int>(readPosition + 2.0f);
-    
-    // Wrap indices
-    if (readIndex0 < 0) readIndex0 += maxDelaySamples;
-    if (readIndex2 >= maxDelaySamples) readIndex2 -= maxDelaySamples;
-    if (readIndex3 >= maxDelaySamples) readIndex3 -= maxDelaySamples;
-    
-    float fraction = readPosition - readIndex1;
-    
-    auto* bufferData = buffer.getReadPointer(0);
-    
-    // Cubic interpolation
-    float y0 = bufferData[readIndex0];
-    float y1 = bufferData[readIndex1];
-    float y2 = bufferData[readIndex2];
-    float y3 = bufferData[readIndex3];
-    
-    float a0 = -0.5f * y0 + 1.5f * y1 - 1.5f * y2 + 0.5f * y3;
-    float a1 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
-    float a2 = -0.5f * y0 + 0.5f * y2;
-    float a3 = y1;
-    
-    float delayedSample = ((a0 * fraction + a1) * fraction + a2) * fraction + a3;
-    
-    // Write input plus feedback to delay line
-    auto* writeData = buffer.getWritePointer(0);
-    writeData[writeIndex] = input + (delayedSample * feedback);
-    
-    // Advance write index
-    writeIndex = (writeIndex + 1) % maxDelaySamples;
-    
-    return delayedSample;
-}
\ No newline at end of file
@@ -5,8 +5,15 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../DSP/DelayLine.h"
+#include "../DSP/Lfo.h"
+#include "../DSP/ParameterRamp.h"
 
-class VibratoProcessor : public juce::AudioProcessor
+class VibratoProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     VibratoProcessor();
@@ -20,7 +27,11 @@ public:
     
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
     
     // Program/State
     const juce::String getName() const override { return "HyperPrism Reimagined Vibrato"; }
@@ -49,6 +60,12 @@ public:
     static const juce::String DELAY_ID;
     static const juce::String FEEDBACK_ID;
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     // Parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -56,29 +73,18 @@ private:
     // Audio processing
     void processVibrato(juce::AudioBuffer<float>& buffer);
     
-    // Vibrato delay line class
-    class VibratoDelayLine
-    {
-    public:
-        void prepare(double sampleRate, float maxDelayMs);
-        void reset();
-        float processSample(float input, float delayMs, float feedback);
-        
-    private:
-        juce::AudioBuffer<float> buffer;
-        int writeIndex = 0;
-        int maxDelaySamples = 0;
-        double sampleRate = 44100.0;
-    };
-    
     // State
     juce::AudioProcessorValueTreeState valueTreeState;
     
     // DSP components
-    VibratoDelayLine leftDelayLine, rightDelayLine;
+    HyperPrismDSP::DelayLine leftDelayLine, rightDelayLine;
     
     // LFO for modulation
-    float lfoPhase = 0.0f;
+    HyperPrismDSP::SineLfo lfo;
+
+    // Mix ramp, rendered once per block
+    HyperPrismDSP::ParameterRamp mixRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
     
     // Cached parameters
     std::atomic<float>* bypassParam = nullptr;
@@ -91,5 +97,8 @@ private:
     // Processing state
     double currentSampleRate = 44100.0;
     
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VibratoProcessor)
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "VocoderEditor.h"
 
+namespace HyperPrismVocoderUI
+{
 //==============================================================================
 // XYPad Implementation (matching AutoPan style)
 //==============================================================================
@@ -229,6 +231,7 @@ void VocoderMeter::paint(juce::Graphics& g)
 
 void VocoderMeter::timerCallback()
 {
+    HYPERPRISM_TRACE_SCOPE("VocoderMeter::timerCallback");
     // Get current levels from processor
     carrierLevel = processor.getCarrierLevel();
     modulatorLevel = processor.getModulatorLevel();
@@ -255,9 +258,10 @@ void VocoderMeter::timerCallback()
 // VocoderEditor Implementation
 //==============================================================================
 VocoderEditor::VocoderEditor(VocoderProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), vocoderMeter(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), vocoderMeter(p), loadReadout(p.getLoadMeter())
 {
     setLookAndFeel(&customLookAndFeel);
+    addAndMakeVisible(loadReadout);
     
     // Initialize default parameter assignments
     xParameterIDs.add(VocoderProcessor::CARRIER_FREQ_ID);
@@ -389,6 +393,7 @@ VocoderEditor::~VocoderEditor()
 
 void VocoderEditor::paint(juce::Graphics& g)
 {
+    HYPERPRISM_TRACE_SCOPE("VocoderEditor::paint");
     g.fillAll(HyperPrismLookAndFeel::Colors::background);
 
     // Accent line
@@ -435,7 +440,7 @@ void VocoderEditor::resized()
     bypassButton.setBounds(header.getRight() - 90, 36, 80, 26);
 
     // === FOOTER ===
-    bounds.removeFromBottom(20);
+    loadReadout.setBounds(bounds.removeFromBottom(20).withTrimmedLeft(12).withWidth(160));
 
     // === CONTENT ===
     bounds.reduce(12, 4);
@@ -715,4 +720,6 @@ void VocoderEditor::updateXYPadLabel()
         yLabel = "Multiple";
         
     xyPadLabel.setText(xLabel + " / " + yLabel, juce::dontSendNotification);
-}
\ No newline at end of file
+}
+
+} // namespace HyperPrismVocoderUI
\ No newline at end of file
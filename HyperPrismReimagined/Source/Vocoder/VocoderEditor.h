@@ -8,7 +8,10 @@
 #include <JuceHeader.h>
 #include "VocoderProcessor.h"
 #include "../Shared/HyperPrismLookAndFeel.h"
+#include "../Shared/StandardLayout.h"
 
+namespace HyperPrismVocoderUI
+{
 //==============================================================================
 // Clickable parameter label for X/Y assignment
 //==============================================================================
@@ -156,5 +159,12 @@ private:
 
     juce::TooltipWindow tooltipWindow { this, 500 };
 
+    // Footer
+    HyperPrismLayout::LoadReadout loadReadout;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VocoderEditor)
-};
\ No newline at end of file
+};
+
+} // namespace HyperPrismVocoderUI
+
+using HyperPrismVocoderUI::VocoderEditor;
\ No newline at end of file
@@ -3,47 +3,37 @@
 //==============================================================================
 
 #include "VocoderProcessor.h"
-#include "VocoderEditor.h"
+#if ! HYPERPRISM_HEADLESS
+ #include "VocoderEditor.h"
+#endif
 
 //==============================================================================
 // VocoderBand Implementation
 //==============================================================================
-void VocoderProcessor::VocoderBand::prepare(double sampleRate, int samplesPerBlock)
+void VocoderProcessor::VocoderBand::prepare(double sampleRate)
 {
     currentSampleRate = sampleRate;
-
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = 1;
-
-    carrierFilter.prepare(spec);
-    modulatorFilter.prepare(spec);
-
     updateEnvelopeCoeff();
     reset();
 }
 
-void VocoderProcessor::VocoderBand::setFrequency(float frequency, float bandwidth)
+void VocoderProcessor::VocoderBand::setCoefficients(const HyperPrismDSP::BiquadCoefficients& coefficients, int rampSamples)
 {
-    // Create bandpass filters using second-order sections
-    auto coefficients = juce::dsp::IIR::Coefficients<float>::makeBandPass(
-        currentSampleRate, frequency, bandwidth);
-    
-    carrierFilter.coefficients = coefficients;
-    modulatorFilter.coefficients = coefficients;
+    carrierFilter.rampTo(coefficients, rampSamples);
+    modulatorFilter.rampTo(coefficients, rampSamples);
 }
 
 void VocoderProcessor::VocoderBand::setReleaseTime(float releaseMs)
 {
-    releaseCoeff = std::exp(-1.0f / (releaseMs * 0.001f * static_cast<float>(currentSampleRate)));
+    // Fast attack, slower release
+    envelope.setPoles(0.1f, HyperPrismDSP::poleForTime(releaseMs, currentSampleRate));
 }
 
 void VocoderProcessor::VocoderBand::reset()
 {
     carrierFilter.reset();
     modulatorFilter.reset();
-    envelopeLevel = 0.0f;
+    envelope.reset();
     processedCarrier = 0.0f;
 }
 
@@ -62,24 +52,13 @@ float VocoderProcessor::VocoderBand::processModulator(float modulatorSample)
     float rectified = std::abs(filteredModulator);
     
     // Envelope follower with attack/release
-    if (rectified > envelopeLevel)
-    {
-        // Fast attack
-        envelopeLevel = rectified + (envelopeLevel - rectified) * 0.1f;
-    }
-    else
-    {
-        // Slower release
-        envelopeLevel = rectified + (envelopeLevel - rectified) * releaseCoeff;
-    }
-    
-    return envelopeLevel;
+    return envelope.process(rectified);
 }
 
 float VocoderProcessor::VocoderBand::getOutput()
 {
     // Apply modulator envelope to carrier
-    return processedCarrier * envelopeLevel;
+    return processedCarrier * envelope.getValue();
 }
 
 void VocoderProcessor::VocoderBand::updateEnvelopeCoeff()
@@ -136,13 +115,18 @@ const juce::String VocoderProcessor::MODULATOR_GAIN_ID = "modulatorGain";
 const juce::String VocoderProcessor::BAND_COUNT_ID = "bandCount";
 const juce::String VocoderProcessor::RELEASE_TIME_ID = "releaseTime";
 const juce::String VocoderProcessor::OUTPUT_LEVEL_ID = "outputLevel";
+const juce::String VocoderProcessor::BACKGROUND_ID = "backgroundThread";
 
 //==============================================================================
 VocoderProcessor::VocoderProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input",  juce::AudioChannelSet::stereo(), true)
                      .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      valueTreeState(*this, nullptr, "Parameters", createParameterLayout())
+      valueTreeState(*this, nullptr, "Parameters", createParameterLayout()),
+      bandFilters(valueTreeState, { BAND_COUNT_ID },
+                  [this](double sampleRate) { return designVocoderBands(sampleRate); }),
+      backgroundWorker(*this, valueTreeState, BACKGROUND_ID,
+                       [this](juce::AudioBuffer<float>& block) { renderBlock(block); })
 {
     // Cache parameter pointers for performance
     bypassParam = valueTreeState.getRawParameterValue(BYPASS_ID);
@@ -156,7 +140,7 @@ VocoderProcessor::VocoderProcessor()
     bandLevels.resize(maxBands, 0.0f);
     bandLevelSums.resize(maxBands, 0.0f);
 
-    setupVocoderBands();
+    vocoderBands.resize(maxBands);
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout VocoderProcessor::createParameterLayout()
@@ -199,17 +183,34 @@ juce::AudioProcessorValueTreeState::ParameterLayout VocoderProcessor::createPara
         juce::String(), juce::AudioProcessorParameter::genericParameter,
         [](float value, int) { return juce::String(value, 1) + " dB"; }));
 
+    // At 16 bands every sample runs 32 band filters
+    parameters.push_back(HyperPrismBackground::Worker::createParameter(BACKGROUND_ID));
+
     return { parameters.begin(), parameters.end() };
 }
 
 //==============================================================================
 void VocoderProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Prepare DSP components with actual buffer size (fixes 512-sample artifact bug)
+    backgroundWorker.prepare(sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+    loadMeter.prepare(sampleRate);
+
+    // Prepare DSP components
     for (auto& band : vocoderBands)
-        band.prepare(sampleRate, samplesPerBlock);
+        band.prepare(sampleRate);
+
+    // Bands are designed for this sample rate, and start on it rather than gliding
+    bandFilters.prepare(sampleRate);
+    applyBandFilters(0);
     
     carrierOscillator.prepare(sampleRate);
+
+    scratchCapacity = HyperPrismLargeBlocks::getScratchCapacity(*this, samplesPerBlock);
+    const double rampTime = 0.02; // 20ms
+    modulatorGainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    outputGainRamp.prepare(sampleRate, rampTime, scratchCapacity);
+    modulatorGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(modulatorGainParam->load()));
+    outputGainRamp.setCurrentAndTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
     
     // Reset metering
     carrierLevel.store(0.0f);
@@ -220,6 +221,8 @@ void VocoderProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 
 void VocoderProcessor::releaseResources()
 {
+    backgroundWorker.release();
+
     for (auto& band : vocoderBands)
         band.reset();
     
@@ -237,8 +240,18 @@ bool VocoderProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
     return true;
 }
 
-void VocoderProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
+void VocoderProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    if (HyperPrismLargeBlocks::processInSlices(*this, buffer, midiMessages, scratchCapacity))
+        return;
+
+    backgroundWorker.process(buffer);
+}
+
+void VocoderProcessor::renderBlock(juce::AudioBuffer<float>& buffer)
+{
+    const HyperPrismLoad::LoadMeter::ScopedTimer loadTimer(loadMeter, buffer.getNumSamples());
+    HYPERPRISM_TRACE_SCOPE("Vocoder::processBlock");
     juce::ScopedNoDenormals noDenormals;
     
     if (bypassParam->load() > 0.5f)
@@ -258,21 +271,21 @@ void VocoderProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Midi
 
 void VocoderProcessor::processVocoding(juce::AudioBuffer<float>& buffer)
 {
+    HYPERPRISM_TRACE_SCOPE("Vocoder::processVocoding");
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
     
     const float carrierFreq = carrierFreqParam->load();
-    const float modulatorGain = juce::Decibels::decibelsToGain(modulatorGainParam->load());
-    const int bandCount = static_cast<int>(bandCountParam->load());
     const float releaseTime = releaseTimeParam->load();
-    const float outputGain = juce::Decibels::decibelsToGain(outputLevelParam->load());
+
+    modulatorGainRamp.setTarget(juce::Decibels::decibelsToGain(modulatorGainParam->load()));
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(outputLevelParam->load()));
+    const auto* modulatorGains = modulatorGainRamp.process(numSamples);
+    const auto* outputGains = outputGainRamp.process(numSamples);
     
-    // Update band count if changed
-    if (bandCount != currentBandCount)
-    {
-        currentBandCount = bandCount;
-        setupVocoderBands();
-    }
+    // Glide to a band design published since the last block
+    if (bandFilters.update(isNonRealtime()))
+        applyBandFilters(HyperPrismCoefficients::rampSamples);
     
     // Update carrier frequency
     carrierOscillator.setFrequency(carrierFreq);
@@ -295,7 +308,7 @@ void VocoderProcessor::processVocoding(juce::AudioBuffer<float>& buffer)
         for (int sample = 0; sample < numSamples; ++sample)
         {
             // Use input as modulator
-            float modulator = channelData[sample] * modulatorGain;
+            float modulator = channelData[sample] * modulatorGains[sample];
             modulatorLevelSum += std::abs(modulator);
             
             // Generate carrier signal
@@ -320,7 +333,7 @@ void VocoderProcessor::processVocoding(juce::AudioBuffer<float>& buffer)
             }
             
             // Apply output level
-            output *= outputGain;
+            output *= outputGains[sample];
             
             channelData[sample] = output;
             outputLevelSum += std::abs(output);
@@ -342,27 +355,26 @@ void VocoderProcessor::processVocoding(juce::AudioBuffer<float>& buffer)
     }
 }
 
-void VocoderProcessor::setupVocoderBands()
+VocoderProcessor::BandFilters VocoderProcessor::designVocoderBands(double sampleRate) const
 {
-    // Ensure we have enough bands
-    if (vocoderBands.size() < static_cast<size_t>(maxBands))
-        vocoderBands.resize(maxBands);
-    
+    BandFilters design;
+    design.numBands = static_cast<int>(bandCountParam->load());
+    const int numBands = design.numBands;
+
     // Calculate logarithmically spaced band frequencies
-    bandFrequencies.clear();
-    bandFrequencies.resize(currentBandCount);
+    std::array<float, maxBands> bandFrequencies {};
     
     const float minFreq = 80.0f;   // Lowest band frequency
     const float maxFreq = 8000.0f; // Highest band frequency
     
-    for (int i = 0; i < currentBandCount; ++i)
+    for (int i = 0; i < numBands; ++i)
     {
-        float ratio = static_cast<float>(i) / (currentBandCount - 1);
+        float ratio = static_cast<float>(i) / (numBands - 1);
         bandFrequencies[i] = minFreq * std::pow(maxFreq / minFreq, ratio);
     }
     
     // Setup each band with appropriate frequency and bandwidth
-    for (int i = 0; i < currentBandCount; ++i)
+    for (int i = 0; i < numBands; ++i)
     {
         float centerFreq = bandFrequencies[i];
         float bandwidth;
@@ -372,7 +384,7 @@ void VocoderProcessor::setupVocoderBands()
             // First band
             bandwidth = (bandFrequencies[1] - centerFreq) * 0.8f;
         }
-        else if (i == currentBandCount - 1)
+        else if (i == numBands - 1)
         {
             // Last band
             bandwidth = (centerFreq - bandFrequencies[i - 1]) * 0.8f;
@@ -383,14 +395,31 @@ void VocoderProcessor::setupVocoderBands()
             bandwidth = (bandFrequencies[i + 1] - bandFrequencies[i - 1]) * 0.4f;
         }
         
-        vocoderBands[i].setFrequency(centerFreq, bandwidth);
+        // Bandpass filters using second-order sections
+        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeBandPass(sampleRate, centerFreq, bandwidth);
+        design.bands[i] = HyperPrismCoefficients::fromJuce(*coefficients);
     }
+
+    return design;
+}
+
+void VocoderProcessor::applyBandFilters(int rampSamples)
+{
+    const auto& design = bandFilters.get();
+    currentBandCount = design.numBands;
+
+    for (int i = 0; i < currentBandCount; ++i)
+        vocoderBands[i].setCoefficients(design.bands[i], rampSamples);
 }
 
 //==============================================================================
 juce::AudioProcessorEditor* VocoderProcessor::createEditor()
 {
+   #if HYPERPRISM_HEADLESS
+    return nullptr;
+   #else
     return new VocoderEditor(*this);
+   #endif
 }
 
 //==============================================================================
@@ -405,4 +434,14 @@ void VocoderProcessor::setStateInformation(const void* data, int sizeInBytes)
     auto xml = getXmlFromBinary(data, sizeInBytes);
     if (xml != nullptr && xml->hasTagName(valueTreeState.state.getType()))
         valueTreeState.replaceState(juce::ValueTree::fromXml(*xml));
+}
+
+void VocoderProcessor::describeMemory(HyperPrismMemory::Footprint& footprint) const
+{
+    footprint.add("processor object", sizeof(*this));
+    footprint.add("vocoder bands", vocoderBands);
+    footprint.add("band state", bandLevelSums);
+    footprint.add("band state", bandLevels);
+    footprint.add("parameter ramps", modulatorGainRamp.getAllocatedBytes() + outputGainRamp.getAllocatedBytes());
+    backgroundWorker.describeMemory(footprint);
 }
\ No newline at end of file
@@ -5,8 +5,16 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../Shared/ProcessorLoadMeter.h"
+#include "../Shared/MemoryFootprint.h"
+#include "../Shared/LargeBlocks.h"
+#include "../Shared/BackgroundWorker.h"
+#include "../Shared/HyperPrismTrace.h"
+#include "../Shared/CoefficientCache.h"
+#include "../DSP/EnvelopeFollower.h"
+#include "../DSP/ParameterRamp.h"
 
-class VocoderProcessor : public juce::AudioProcessor
+class VocoderProcessor : public juce::AudioProcessor, public HyperPrismMemory::Reporter
 {
 public:
     //==============================================================================
@@ -23,7 +31,11 @@ public:
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
+   #if HYPERPRISM_HEADLESS
+    bool hasEditor() const override { return false; }
+   #else
     bool hasEditor() const override { return true; }
+   #endif
 
     //==============================================================================
     const juce::String getName() const override { return "HyperPrism Reimagined Vocoder"; }
@@ -54,6 +66,7 @@ public:
     static const juce::String BAND_COUNT_ID;
     static const juce::String RELEASE_TIME_ID;
     static const juce::String OUTPUT_LEVEL_ID;
+    static const juce::String BACKGROUND_ID;
     
     // Metering
     float getCarrierLevel() const { return carrierLevel.load(); }
@@ -61,6 +74,12 @@ public:
     float getOutputLevel() const { return outputLevel.load(); }
     const std::vector<float>& getBandLevels() const { return bandLevels; }
 
+    // DSP load measured in processBlock, shown in the editor footer
+    const HyperPrismLoad::LoadMeter& getLoadMeter() const { return loadMeter; }
+
+    // Heap held after prepareToPlay, by component
+    void describeMemory(HyperPrismMemory::Footprint& footprint) const override;
+
 private:
     //==============================================================================
     static constexpr int maxBands = 16;
@@ -71,26 +90,25 @@ private:
     public:
         VocoderBand() = default;
 
-        void prepare(double sampleRate, int samplesPerBlock);
-        void setFrequency(float frequency, float bandwidth);
+        void prepare(double sampleRate);
+        void setCoefficients(const HyperPrismDSP::BiquadCoefficients& coefficients, int rampSamples);
         void setReleaseTime(float releaseMs);
         void reset();
         
         float processCarrier(float carrierSample);
         float processModulator(float modulatorSample);
         float getOutput();
-        float getEnvelopeLevel() const { return envelopeLevel; }
+        float getEnvelopeLevel() const { return envelope.getValue(); }
         
     private:
         double currentSampleRate = 44100.0;
         
         // Bandpass filters for carrier and modulator
-        juce::dsp::IIR::Filter<float> carrierFilter;
-        juce::dsp::IIR::Filter<float> modulatorFilter;
+        HyperPrismDSP::Biquad carrierFilter;
+        HyperPrismDSP::Biquad modulatorFilter;
         
         // Envelope follower for modulator
-        float envelopeLevel = 0.0f;
-        float releaseCoeff = 0.95f;
+        HyperPrismDSP::EnvelopeFollower envelope;
         
         // Processed carrier signal
         float processedCarrier = 0.0f;
@@ -118,9 +136,18 @@ private:
         void updatePhaseIncrement();
     };
     
+    // Band-pass coefficients for the current band count, designed off the audio thread
+    struct BandFilters
+    {
+        std::array<HyperPrismDSP::BiquadCoefficients, maxBands> bands;
+        int numBands = defaultBands;
+    };
+
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    void renderBlock(juce::AudioBuffer<float>& buffer);
     void processVocoding(juce::AudioBuffer<float>& buffer);
-    void setupVocoderBands();
+    BandFilters designVocoderBands(double sampleRate) const;
+    void applyBandFilters(int rampSamples);
     
     juce::AudioProcessorValueTreeState valueTreeState;
     
@@ -134,20 +161,31 @@ private:
     
     // DSP components
     std::vector<VocoderBand> vocoderBands;
+    HyperPrismCoefficients::Cache<BandFilters> bandFilters;
     CarrierOscillator carrierOscillator;
     
     // State variables
     int currentBandCount = defaultBands;
-    std::vector<float> bandFrequencies;
     
     // Pre-allocated buffer for band level accumulation (real-time safe)
     std::vector<float> bandLevelSums;
 
+    // Gain ramps, rendered once per block and shared by the channels
+    HyperPrismDSP::ParameterRamp modulatorGainRamp;
+    HyperPrismDSP::ParameterRamp outputGainRamp;
+    int scratchCapacity = 0;            // Samples of ramp prepared; longer blocks are sliced
+
     // Metering
     std::atomic<float> carrierLevel { 0.0f };
     std::atomic<float> modulatorLevel { 0.0f };
     std::atomic<float> outputLevel { 0.0f };
     mutable std::vector<float> bandLevels;
 
+    HyperPrismLoad::LoadMeter loadMeter;
+    HYPERPRISM_DECLARE_TRACE_SESSION
+
+    // Declared last: its thread calls renderBlock until it is destroyed
+    HyperPrismBackground::Worker backgroundWorker;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VocoderProcessor)
 };
\ No newline at end of file